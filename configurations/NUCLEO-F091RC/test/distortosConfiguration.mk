@@ -213,6 +213,7 @@ CONFIG_CHIP_INCLUDES="source/chip/STM32/STM32F0/include source/chip/STM32/periph
 # CONFIG_CHIP_STM32_GPIOV1 is not set
 CONFIG_CHIP_STM32_GPIOV2=y
 # CONFIG_CHIP_STM32_SPIV1 is not set
+# CONFIG_CHIP_STM32_TIMV1 is not set
 # CONFIG_CHIP_STM32_USARTV1 is not set
 
 #
@@ -267,6 +268,7 @@ CONFIG_CHIP_HAS_WLCSP64=y
 # CONFIG_CHIP_HAS_WLCSP90 is not set
 # CONFIG_CHIP_HAS_WLCSP143 is not set
 # CONFIG_CHIP_HAS_WLCSP168 is not set
+# CONFIG_CHIP_HAS_HIGH_PRECISION_TIMER is not set
 # CONFIG_CHIP_LFBGA100 is not set
 # CONFIG_CHIP_LFBGA144 is not set
 # CONFIG_CHIP_LQFP32 is not set
@@ -304,6 +306,14 @@ CONFIG_CHIP_PACKAGE="LQFP64"
 CONFIG_TICK_FREQUENCY=1000
 CONFIG_ROUND_ROBIN_FREQUENCY=10
 CONFIG_THREAD_DETACH_ENABLE=y
+CONFIG_TICKLESS_IDLE_ENABLE=y
+# CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE is not set
+CONFIG_SOFTWARE_TIMER_SUPERVISOR_SORTED_LIST=y
+# CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL is not set
+# CONFIG_SOFTWARE_TIMER_THREAD_ENABLE is not set
+# CONFIG_STACK_PAINTING_FULL is not set
+# CONFIG_STACK_PAINTING_GUARD_BAND is not set
+CONFIG_STACK_PAINTING_NONE=y
 
 #
 # main() thread options
@@ -314,6 +324,11 @@ CONFIG_MAIN_THREAD_CAN_RECEIVE_SIGNALS=y
 CONFIG_MAIN_THREAD_QUEUED_SIGNALS=10
 CONFIG_MAIN_THREAD_SIGNAL_ACTIONS=10
 
+#
+# Trace configuration
+#
+# CONFIG_TRACE_ENABLE is not set
+
 #
 # Applications configuration
 #
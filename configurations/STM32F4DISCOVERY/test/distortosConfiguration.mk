@@ -317,6 +317,7 @@ CONFIG_CHIP_STM32_GPIOV2_HAS_HIGH_SPEED=y
 # CONFIG_CHIP_STM32_GPIOV1 is not set
 CONFIG_CHIP_STM32_GPIOV2=y
 CONFIG_CHIP_STM32_SPIV1=y
+# CONFIG_CHIP_STM32_TIMV1 is not set
 CONFIG_CHIP_STM32_USARTV1=y
 # CONFIG_CHIP_STM32_SPIV1_SPI1_ENABLE is not set
 # CONFIG_CHIP_STM32_SPIV1_SPI2_ENABLE is not set
@@ -355,6 +356,7 @@ CONFIG_ARCHITECTURE_FLAGS="-mcpu=cortex-m4 -mthumb -mfloat-abi=hard -mfpu=fpv4-s
 # ARMv7-M architecture options
 #
 CONFIG_ARCHITECTURE_ARMV7_M_KERNEL_BASEPRI=0
+# CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE is not set
 # CONFIG_ARCHITECTURE_ARM_CORTEX_M3 is not set
 CONFIG_ARCHITECTURE_ARM_CORTEX_M4=y
 # CONFIG_ARCHITECTURE_ARM_CORTEX_M7 is not set
@@ -397,6 +399,7 @@ CONFIG_CHIP_HAS_LQFP100=y
 # CONFIG_CHIP_HAS_WLCSP90 is not set
 # CONFIG_CHIP_HAS_WLCSP143 is not set
 # CONFIG_CHIP_HAS_WLCSP168 is not set
+CONFIG_CHIP_HAS_HIGH_PRECISION_TIMER=y
 # CONFIG_CHIP_LFBGA100 is not set
 # CONFIG_CHIP_LFBGA144 is not set
 # CONFIG_CHIP_LQFP32 is not set
@@ -434,6 +437,15 @@ CONFIG_CHIP_PACKAGE="LQFP100"
 CONFIG_TICK_FREQUENCY=1000
 CONFIG_ROUND_ROBIN_FREQUENCY=10
 CONFIG_THREAD_DETACH_ENABLE=y
+# CONFIG_TICKLESS_IDLE_ENABLE is not set
+# CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE is not set
+CONFIG_SOFTWARE_TIMER_SUPERVISOR_SORTED_LIST=y
+# CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL is not set
+# CONFIG_SOFTWARE_TIMER_THREAD_ENABLE is not set
+# CONFIG_HIGH_PRECISION_TIMER_ENABLE is not set
+CONFIG_STACK_PAINTING_FULL=y
+# CONFIG_STACK_PAINTING_GUARD_BAND is not set
+# CONFIG_STACK_PAINTING_NONE is not set
 
 #
 # main() thread options
@@ -444,6 +456,11 @@ CONFIG_MAIN_THREAD_CAN_RECEIVE_SIGNALS=y
 CONFIG_MAIN_THREAD_QUEUED_SIGNALS=10
 CONFIG_MAIN_THREAD_SIGNAL_ACTIONS=10
 
+#
+# Trace configuration
+#
+# CONFIG_TRACE_ENABLE is not set
+
 #
 # Applications configuration
 #
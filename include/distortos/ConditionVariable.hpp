@@ -2,7 +2,7 @@
  * \file
  * \brief ConditionVariable class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -56,12 +56,34 @@ public:
 	 * Similar to pthread_cond_broadcast() -
 	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_cond_signal.html
 	 *
-	 * Unblocks all threads waiting on this condition variable. The notifying thread does not need to hold the same
-	 * mutex as the one held by the waiting thread(s).
+	 * Unblocks all threads waiting on this condition variable in a single pass. The notifying thread does not need to
+	 * hold the same mutex as the one held by the waiting thread(s).
 	 */
 
 	void notifyAll();
 
+	/**
+	 * \brief Notifies all waiting threads, transferring them directly to the mutex ("wait morphing").
+	 *
+	 * Similar to std::condition_variable::notify_all() -
+	 * http://en.cppreference.com/w/cpp/thread/condition_variable/notify_all
+	 * Similar to pthread_cond_broadcast() -
+	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_cond_signal.html
+	 *
+	 * If \a mutex is owned by the calling thread, all threads waiting on this condition variable are transferred to the
+	 * list of threads blocked on \a mutex, without unblocking them. The threads will be unblocked one by one, each
+	 * of them already owning the mutex, as it is unlocked by its subsequent owners - this avoids the situation in which
+	 * all notified threads are unblocked only to block again on the mutex held by the notifying thread. Otherwise - or
+	 * if the protocol of \a mutex is PriorityInheritance, or if the protocol of \a mutex is PriorityProtect and any
+	 * waiting thread has priority higher than the priority ceiling - this function is equivalent to notifyAll().
+	 *
+	 * \warning All threads waiting on this condition variable must use \a mutex.
+	 *
+	 * \param [in] mutex is a reference to mutex used by all threads waiting on this condition variable
+	 */
+
+	void notifyAll(Mutex& mutex);
+
 	/**
 	 * \brief Notifies one waiting thread.
 	 *
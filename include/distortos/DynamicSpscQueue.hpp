@@ -0,0 +1,56 @@
+/**
+ * \file
+ * \brief DynamicSpscQueue class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DYNAMICSPSCQUEUE_HPP_
+#define INCLUDE_DISTORTOS_DYNAMICSPSCQUEUE_HPP_
+
+#include "SpscQueue.hpp"
+
+#include "distortos/internal/memory/storageDeleter.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief DynamicSpscQueue class is a variant of SpscQueue that has dynamic storage for queue's contents.
+ *
+ * \tparam T is the type of data in queue
+ *
+ * \ingroup queues
+ */
+
+template<typename T>
+class DynamicSpscQueue : public SpscQueue<T>
+{
+public:
+
+	/// import Storage type from base class
+	using typename SpscQueue<T>::Storage;
+
+	/**
+	 * \brief DynamicSpscQueue's constructor
+	 *
+	 * \param [in] queueSize is the maximum number of elements in queue
+	 */
+
+	explicit DynamicSpscQueue(size_t queueSize);
+};
+
+template<typename T>
+DynamicSpscQueue<T>::DynamicSpscQueue(const size_t queueSize) :
+		SpscQueue<T>{{new Storage[queueSize], internal::storageDeleter<Storage>}, queueSize}
+{
+
+}
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DYNAMICSPSCQUEUE_HPP_
@@ -73,7 +73,8 @@ public:
 					parameters.signalActions, parameters.priority, parameters.schedulingPolicy,
 					std::forward<Function>(function), std::forward<Args>(args)...}
 	{
-
+		// out-of-range length of round-robin quantum is clamped, as constructor cannot report an error
+		setRoundRobinQuantum(internal::RoundRobinQuantum::clamp(parameters.roundRobinQuantum));
 	}
 
 	/**
@@ -117,6 +118,18 @@ public:
 
 	int generateSignal(uint8_t signalNumber) override;
 
+	/**
+	 * \return CPU time used by thread, core clock cycles
+	 */
+
+	uint64_t getCpuTime() const override;
+
+	/**
+	 * \return number of periods in which the thread missed its deadline
+	 */
+
+	uint32_t getDeadlineMissCount() const override;
+
 	/**
 	 * \return effective priority of thread
 	 */
@@ -143,18 +156,49 @@ public:
 
 	uint8_t getPriority() const override;
 
+	/**
+	 * \return length of round-robin quantum of the thread
+	 */
+
+	TickClock::duration getRoundRobinQuantum() const override;
+
 	/**
 	 * \return scheduling policy of the thread
 	 */
 
 	SchedulingPolicy getSchedulingPolicy() const override;
 
+	/**
+	 * \brief Gets high-water mark of thread's stack.
+	 *
+	 * Stack is painted with a known pattern when the thread is constructed, the boundary of the painted part which was
+	 * not overwritten is found with binary search. A buffer on the stack which was never written may hide deeper usage.
+	 * If only a guard band of stack is painted (CONFIG_STACK_PAINTING_GUARD_BAND) or stack is not painted at all
+	 * (CONFIG_STACK_PAINTING_NONE), the part which is not painted is reported as used.
+	 *
+	 * \return max number of bytes of thread's stack used so far
+	 */
+
+	size_t getStackHighWaterMark() const override;
+
+	/**
+	 * \return size of thread's stack, bytes
+	 */
+
+	size_t getStackSize() const override;
+
 	/**
 	 * \return current state of thread
 	 */
 
 	ThreadState getState() const override;
 
+	/**
+	 * \return slack of timeouts of blocking functions called by the thread, 0 if internal thread object was detached
+	 */
+
+	TickClock::duration getTimerSlack() const override;
+
 	/**
 	 * \brief Waits for thread termination.
 	 *
@@ -198,6 +242,19 @@ public:
 
 	int queueSignal(uint8_t signalNumber, sigval value) override;
 
+	/**
+	 * \brief Sets deadline parameters of thread.
+	 *
+	 * Deadline parameters are used only when the thread uses SchedulingPolicy::earliestDeadlineFirst. Current period of
+	 * the thread starts when this function is called. Next periods are started with ThisThread::waitForNextPeriod().
+	 *
+	 * \param [in] relativeDeadline is the deadline of each period, relative to the beginning of the period
+	 * \param [in] period is the period of the thread, 0 if the thread is aperiodic (each call to
+	 * ThisThread::waitForNextPeriod() starts new period immediately)
+	 */
+
+	void setDeadline(TickClock::duration relativeDeadline, TickClock::duration period) override;
+
 	/**
 	 * \brief Changes priority of thread.
 	 *
@@ -211,12 +268,57 @@ public:
 
 	void setPriority(uint8_t priority, bool alwaysBehind = {}) override;
 
+	/**
+	 * \brief Sets length of round-robin quantum of the thread.
+	 *
+	 * Round-robin quantum is used only when the thread uses SchedulingPolicy::roundRobin. When the thread used its
+	 * whole quantum, it is moved to the end of the group of runnable threads with the same priority. Long quantum is
+	 * suitable for throughput-bound threads, which should not be rotated needlessly, short quantum - for interactive
+	 * threads. If current quantum of the thread is longer than new length, it is truncated immediately.
+	 *
+	 * \param [in] roundRobinQuantum is the new length of round-robin quantum of the thread, 0 to restore the default
+	 * value derived from CONFIG_ROUND_ROBIN_FREQUENCY
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - \a roundRobinQuantum is negative or too long;
+	 */
+
+	int setRoundRobinQuantum(TickClock::duration roundRobinQuantum) override;
+
 	/**
 	 * param [in] schedulingPolicy is the new scheduling policy of the thread
 	 */
 
 	void setSchedulingPolicy(SchedulingPolicy schedulingPolicy) override;
 
+	/**
+	 * \brief Sets thread group of thread.
+	 *
+	 * This operation can be performed on threads in "New" state only. If thread group is not set, the thread inherits
+	 * the group of the thread which starts it.
+	 *
+	 * \param [in] threadGroup is a reference to ThreadGroup to which the thread will be added when it is started
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - thread is already started;
+	 * - EINVAL - internal thread object was detached;
+	 */
+
+	int setThreadGroup(ThreadGroup& threadGroup) override;
+
+	/**
+	 * \brief Sets slack of timeouts of blocking functions called by the thread.
+	 *
+	 * Timeouts of blocking functions (sleeps and all "try...For()" / "try...Until()" functions) called by the thread
+	 * may be delayed by not more than the slack, so that they expire together with other software timers and cause
+	 * fewer separate wake-ups. See SoftwareTimerCommon::setSlack() for details.
+	 *
+	 * \param [in] timerSlack is the slack of timeouts of blocking functions called by the thread, 0 (default) to
+	 * disable coalescing
+	 */
+
+	void setTimerSlack(TickClock::duration timerSlack) override;
+
 	/**
 	 * \brief Starts the thread.
 	 *
@@ -13,6 +13,7 @@
 #define INCLUDE_DISTORTOS_DYNAMICTHREADPARAMETERS_HPP_
 
 #include "distortos/SchedulingPolicy.hpp"
+#include "distortos/TickClock.hpp"
 
 #include <cstddef>
 
@@ -43,14 +44,18 @@ struct DynamicThreadParameters
 	 * \a canReceiveSignals == true, 0 to disable catching of signals for this thread
 	 * \param [in] priorityy is the thread's priority, 0 - lowest, UINT8_MAX - highest
 	 * \param [in] schedulingPolicyy is the scheduling policy of the thread, default - SchedulingPolicy::roundRobin
+	 * \param [in] roundRobinQuantumm is the length of round-robin quantum of the thread, default - 0 (value derived
+	 * from CONFIG_ROUND_ROBIN_FREQUENCY)
 	 */
 
 	constexpr DynamicThreadParameters(const size_t stackSizee, const bool canReceiveSignalss,
 			const size_t queuedSignalss, const size_t signalActionss, const uint8_t priorityy,
-			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin) :
+			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin,
+			const TickClock::duration roundRobinQuantumm = {}) :
 					queuedSignals{queuedSignalss},
 					signalActions{signalActionss},
 					stackSize{stackSizee},
+					roundRobinQuantum{roundRobinQuantumm},
 					canReceiveSignals{canReceiveSignalss},
 					priority{priorityy},
 					schedulingPolicy{schedulingPolicyy}
@@ -64,11 +69,14 @@ struct DynamicThreadParameters
 	 * \param [in] stackSizee is the size of stack, bytes
 	 * \param [in] priorityy is the thread's priority, 0 - lowest, UINT8_MAX - highest
 	 * \param [in] schedulingPolicyy is the scheduling policy of the thread, default - SchedulingPolicy::roundRobin
+	 * \param [in] roundRobinQuantumm is the length of round-robin quantum of the thread, default - 0 (value derived
+	 * from CONFIG_ROUND_ROBIN_FREQUENCY)
 	 */
 
 	constexpr DynamicThreadParameters(const size_t stackSizee, const uint8_t priorityy,
-			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin) :
-					DynamicThreadParameters{stackSizee, false, 0, 0, priorityy, schedulingPolicyy}
+			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin,
+			const TickClock::duration roundRobinQuantumm = {}) :
+					DynamicThreadParameters{stackSizee, false, 0, 0, priorityy, schedulingPolicyy, roundRobinQuantumm}
 	{
 
 	}
@@ -84,6 +92,10 @@ struct DynamicThreadParameters
 	/// size of stack, bytes
 	size_t stackSize;
 
+	/// length of round-robin quantum of the thread, 0 to use value derived from CONFIG_ROUND_ROBIN_FREQUENCY; values
+	/// out of the range accepted by Thread::setRoundRobinQuantum() are clamped
+	TickClock::duration roundRobinQuantum;
+
 	/// selects whether reception of signals is enabled (true) or disabled (false) for this thread
 	bool canReceiveSignals;
 
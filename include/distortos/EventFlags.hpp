@@ -0,0 +1,370 @@
+/**
+ * \file
+ * \brief EventFlags class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_EVENTFLAGS_HPP_
+#define INCLUDE_DISTORTOS_EVENTFLAGS_HPP_
+
+#include "distortos/internal/scheduler/ThreadList.hpp"
+
+#include "distortos/TickClock.hpp"
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+#include "distortos/HighResolutionClock.hpp"
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+#include "estd/IntrusiveList.hpp"
+
+#include <utility>
+
+namespace distortos
+{
+
+/**
+ * \brief EventFlags is a synchronization primitive with 32 independent flags, which allows threads to wait for any or
+ * all of selected flags.
+ *
+ * Flags may be set from interrupt context. All threads whose wait is satisfied by set() are unblocked at once - the
+ * wait of each thread is checked against the same value of flags, and flags which are cleared on exit from wait are
+ * cleared only after all threads are checked.
+ *
+ * This object doesn't need any storage, so it can be used as a static object or as a dynamically allocated one without
+ * any changes.
+ *
+ * \ingroup synchronization
+ */
+
+class EventFlags
+{
+public:
+
+	/// type of flags
+	using Flags = uint32_t;
+
+	/// mode of waiting for flags
+	enum class WaitMode : uint8_t
+	{
+		/// wait is satisfied if any of selected flags is set
+		any,
+		/// wait is satisfied if all of selected flags are set
+		all,
+	};
+
+	/**
+	 * \brief EventFlags's constructor
+	 *
+	 * \param [in] flags is the initial value of flags, default - all flags cleared
+	 */
+
+	constexpr explicit EventFlags(const Flags flags = {}) :
+			blockedList_{},
+			waiterList_{},
+			flags_{flags}
+	{
+
+	}
+
+	/**
+	 * \brief EventFlags's destructor
+	 *
+	 * It is safe to destroy event flags upon which no threads are currently blocked. The effect of destroying event
+	 * flags upon which other threads are currently blocked is system error.
+	 */
+
+	~EventFlags()
+	{
+
+	}
+
+	/**
+	 * \brief Clears selected flags.
+	 *
+	 * \param [in] mask selects flags which will be cleared
+	 *
+	 * \return value of flags before clearing
+	 */
+
+	Flags clear(Flags mask);
+
+	/**
+	 * \return current value of flags
+	 */
+
+	Flags get() const
+	{
+		return flags_;
+	}
+
+	/**
+	 * \brief Sets selected flags.
+	 *
+	 * All threads whose wait is satisfied by new value of flags are unblocked. Flags which were waited for by unblocked
+	 * threads with "clear on exit" option are cleared.
+	 *
+	 * \note This function may be used from interrupt context.
+	 *
+	 * \param [in] mask selects flags which will be set
+	 *
+	 * \return value of flags after the operation
+	 */
+
+	Flags set(Flags mask);
+
+	/**
+	 * \brief Tries to wait for selected flags.
+	 *
+	 * \param [in] mask selects flags which will be waited for, must not be 0
+	 * \param [in] waitMode selects whether any or all of selected flags must be set
+	 * \param [in] clearOnExit selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags - before clearing - which
+	 * satisfied the wait (current value of flags in case of error); error codes:
+	 * - EAGAIN - wait could not be satisfied immediately;
+	 * - EINVAL - \a mask is 0;
+	 */
+
+	std::pair<int, Flags> tryWait(Flags mask, WaitMode waitMode, bool clearOnExit = {});
+
+	/**
+	 * \brief Tries to wait for selected flags for given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without success
+	 * \param [in] mask selects flags which will be waited for, must not be 0
+	 * \param [in] waitMode selects whether any or all of selected flags must be set
+	 * \param [in] clearOnExit selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags - before clearing - which
+	 * satisfied the wait (current value of flags in case of error); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 * - ETIMEDOUT - the wait could not be satisfied before the specified timeout expired;
+	 */
+
+	std::pair<int, Flags> tryWaitFor(TickClock::duration duration, Flags mask, WaitMode waitMode,
+			bool clearOnExit = {});
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	/**
+	 * \brief Tries to wait for selected flags for given duration of time, with sub-tick precision of timeout.
+	 *
+	 * Variant of tryWaitFor(TickClock::duration duration, Flags mask, WaitMode waitMode, bool clearOnExit) in which
+	 * the timeout is handled by high precision timer. Template variant of tryWaitFor() never uses this function, so
+	 * sub-tick precision must be requested explicitly.
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without success
+	 * \param [in] mask selects flags which will be waited for, must not be 0
+	 * \param [in] waitMode selects whether any or all of selected flags must be set
+	 * \param [in] clearOnExit selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags - before clearing - which
+	 * satisfied the wait (current value of flags in case of error); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 * - ETIMEDOUT - the wait could not be satisfied before the specified timeout expired;
+	 */
+
+	std::pair<int, Flags> tryWaitForPrecise(HighResolutionClock::duration duration, Flags mask, WaitMode waitMode,
+			bool clearOnExit = {});
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	/**
+	 * \brief Tries to wait for selected flags for given duration of time.
+	 *
+	 * Template variant of tryWaitFor(TickClock::duration duration, Flags mask, WaitMode waitMode, bool clearOnExit).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without success
+	 * \param [in] mask selects flags which will be waited for, must not be 0
+	 * \param [in] waitMode selects whether any or all of selected flags must be set
+	 * \param [in] clearOnExit selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags - before clearing - which
+	 * satisfied the wait (current value of flags in case of error); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 * - ETIMEDOUT - the wait could not be satisfied before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, Flags> tryWaitFor(const std::chrono::duration<Rep, Period> duration, const Flags mask,
+			const WaitMode waitMode, const bool clearOnExit = {})
+	{
+		return tryWaitFor(std::chrono::duration_cast<TickClock::duration>(duration), mask, waitMode, clearOnExit);
+	}
+
+	/**
+	 * \brief Tries to wait for selected flags until given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without success
+	 * \param [in] mask selects flags which will be waited for, must not be 0
+	 * \param [in] waitMode selects whether any or all of selected flags must be set
+	 * \param [in] clearOnExit selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags - before clearing - which
+	 * satisfied the wait (current value of flags in case of error); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 * - ETIMEDOUT - the wait could not be satisfied before the specified timeout expired;
+	 */
+
+	std::pair<int, Flags> tryWaitUntil(TickClock::time_point timePoint, Flags mask, WaitMode waitMode,
+			bool clearOnExit = {});
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	/**
+	 * \brief Tries to wait for selected flags until given time point, with sub-tick precision of timeout.
+	 *
+	 * Variant of tryWaitUntil(TickClock::time_point timePoint, Flags mask, WaitMode waitMode, bool clearOnExit) in
+	 * which the timeout is handled by high precision timer.
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without success
+	 * \param [in] mask selects flags which will be waited for, must not be 0
+	 * \param [in] waitMode selects whether any or all of selected flags must be set
+	 * \param [in] clearOnExit selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags - before clearing - which
+	 * satisfied the wait (current value of flags in case of error); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 * - ETIMEDOUT - the wait could not be satisfied before the specified timeout expired;
+	 */
+
+	std::pair<int, Flags> tryWaitUntilPrecise(HighResolutionClock::time_point timePoint, Flags mask, WaitMode waitMode,
+			bool clearOnExit = {});
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	/**
+	 * \brief Tries to wait for selected flags until given time point.
+	 *
+	 * Template variant of tryWaitUntil(TickClock::time_point timePoint, Flags mask, WaitMode waitMode,
+	 * bool clearOnExit).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without success
+	 * \param [in] mask selects flags which will be waited for, must not be 0
+	 * \param [in] waitMode selects whether any or all of selected flags must be set
+	 * \param [in] clearOnExit selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags - before clearing - which
+	 * satisfied the wait (current value of flags in case of error); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 * - ETIMEDOUT - the wait could not be satisfied before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	std::pair<int, Flags> tryWaitUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const Flags mask,
+			const WaitMode waitMode, const bool clearOnExit = {})
+	{
+		return tryWaitUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), mask, waitMode, clearOnExit);
+	}
+
+	/**
+	 * \brief Waits for selected flags.
+	 *
+	 * \param [in] mask selects flags which will be waited for, must not be 0
+	 * \param [in] waitMode selects whether any or all of selected flags must be set
+	 * \param [in] clearOnExit selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags - before clearing - which
+	 * satisfied the wait (current value of flags in case of error); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 */
+
+	std::pair<int, Flags> wait(Flags mask, WaitMode waitMode, bool clearOnExit = {});
+
+	EventFlags(const EventFlags&) = delete;
+	EventFlags(EventFlags&&) = default;
+	const EventFlags& operator=(const EventFlags&) = delete;
+	EventFlags& operator=(EventFlags&&) = delete;
+
+private:
+
+	/// description of wait of a thread blocked on EventFlags
+	struct Waiter
+	{
+		/// node of intrusive list of waiters
+		estd::IntrusiveListNode node;
+
+		/// ThreadControlBlock of waiting thread
+		internal::ThreadControlBlock& threadControlBlock;
+
+		/// selected flags which are waited for
+		Flags mask;
+
+		/// value of flags which satisfied the wait, valid only if the wait was satisfied
+		Flags flags;
+
+		/// selects whether any or all of selected flags must be set
+		WaitMode waitMode;
+
+		/// selects whether flags selected by \a mask will be cleared when the wait is satisfied
+		bool clearOnExit;
+	};
+
+	/// intrusive list of Waiter objects
+	using WaiterList = estd::IntrusiveList<Waiter, &Waiter::node>;
+
+	/**
+	 * \brief Implementation of wait(), tryWait() and tryWaitUntil().
+	 *
+	 * \tparam TimePoint is the type of time point
+	 *
+	 * \param [in] timePoint is a pointer to time point at which the wait will be terminated, nullptr to block without
+	 * timeout
+	 * \param [in] nonBlocking selects whether this function operates in blocking mode (false) or non-blocking mode
+	 * (true)
+	 * \param [in] mask selects flags which will be waited for, must not be 0
+	 * \param [in] waitMode selects whether any or all of selected flags must be set
+	 * \param [in] clearOnExit selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags - before clearing - which
+	 * satisfied the wait (current value of flags in case of error); error codes:
+	 * - EAGAIN - wait could not be satisfied immediately and non-blocking mode was selected;
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 * - ETIMEDOUT - the wait could not be satisfied before the specified timeout expired;
+	 */
+
+	template<typename TimePoint>
+	std::pair<int, Flags> waitImplementation(const TimePoint* timePoint, bool nonBlocking, Flags mask,
+			WaitMode waitMode, bool clearOnExit);
+
+	/// ThreadControlBlock objects blocked on this object
+	internal::ThreadList blockedList_;
+
+	/// descriptions of waits of threads blocked on this object
+	WaiterList waiterList_;
+
+	/// current value of flags
+	Flags flags_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_EVENTFLAGS_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief FifoQueue class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -22,6 +22,8 @@
 #include "distortos/internal/synchronization/SemaphoreTryWaitForFunctor.hpp"
 #include "distortos/internal/synchronization/SemaphoreTryWaitUntilFunctor.hpp"
 
+#include <cerrno>
+
 /// GCC 4.9 is needed for all FifoQueue::*emplace*() functions - earlier versions don't support parameter pack expansion
 /// in lambdas
 #define DISTORTOS_FIFOQUEUE_EMPLACE_SUPPORTED	__GNUC_PREREQ(4, 9)
@@ -42,6 +44,8 @@ namespace distortos
 template<typename T>
 class FifoQueue
 {
+	friend class WaitAnyObject;
+
 public:
 
 	/// type of uninitialized storage for data
@@ -556,6 +560,551 @@ public:
 		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), std::move(value));
 	}
 
+	/**
+	 * \brief Pops up to \a count of the oldest (first) elements from the queue.
+	 *
+	 * Blocks until at least one element can be popped, then pops as many elements as possible - up to \a count - in
+	 * one critical section, adjusting semaphores of the queue only once.
+	 *
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their
+	 * contents are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the maximum number of elements that will be popped
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popN(T* const values, const size_t count)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return popNInternal(semaphoreWaitFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count of the oldest (first) elements from the queue.
+	 *
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their
+	 * contents are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the maximum number of elements that will be popped
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopN(T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return popNInternal(semaphoreTryWaitFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count of the oldest (first) elements from the queue for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping any element
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their
+	 * contents are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the maximum number of elements that will be popped
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopNFor(const TickClock::duration duration, T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		return popNInternal(semaphoreTryWaitForFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count of the oldest (first) elements from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopNFor(TickClock::duration, T*, size_t).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping any element
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their
+	 * contents are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the maximum number of elements that will be popped
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPopNFor(const std::chrono::duration<Rep, Period> duration, T* const values,
+			const size_t count)
+	{
+		return tryPopNFor(std::chrono::duration_cast<TickClock::duration>(duration), values, count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count of the oldest (first) elements from the queue until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping any element
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their
+	 * contents are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the maximum number of elements that will be popped
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopNUntil(const TickClock::time_point timePoint, T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return popNInternal(semaphoreTryWaitUntilFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count of the oldest (first) elements from the queue until a given time point.
+	 *
+	 * Template variant of tryPopNUntil(TickClock::time_point, T*, size_t).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping any element
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their
+	 * contents are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the maximum number of elements that will be popped
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPopNUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T* const values,
+			const size_t count)
+	{
+		return tryPopNUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), values, count);
+	}
+
+	/**
+	 * \brief Pushes up to \a count of the elements to the queue.
+	 *
+	 * Blocks until at least one element can be pushed, then pushes as many elements as possible - up to \a count - in
+	 * one critical section, adjusting semaphores of the queue only once.
+	 *
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushN(const T* const values, const size_t count)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return pushNInternal(semaphoreWaitFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a count of the elements to the queue.
+	 *
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushN(const T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return pushNInternal(semaphoreTryWaitFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a count of the elements to the queue for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing any element
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushNFor(const TickClock::duration duration, const T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		return pushNInternal(semaphoreTryWaitForFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a count of the elements to the queue for a given duration of time.
+	 *
+	 * Template variant of tryPushNFor(TickClock::duration, const T*, size_t).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing any element
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPushNFor(const std::chrono::duration<Rep, Period> duration, const T* const values,
+			const size_t count)
+	{
+		return tryPushNFor(std::chrono::duration_cast<TickClock::duration>(duration), values, count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a count of the elements to the queue until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing any element
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushNUntil(const TickClock::time_point timePoint, const T* const values,
+			const size_t count)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return pushNInternal(semaphoreTryWaitUntilFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a count of the elements to the queue until a given time point.
+	 *
+	 * Template variant of tryPushNUntil(TickClock::time_point, const T*, size_t).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing any element
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPushNUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const T* const values, const size_t count)
+	{
+		return tryPushNUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), values, count);
+	}
+
+	/**
+	 * \brief Peeks the oldest (first) element in the queue.
+	 *
+	 * The element is removed from the queue, but it stays in queue's storage and may be accessed in place. The slot
+	 * is not available for "push" functions until release() is called.
+	 *
+	 * \return pair with return code (zero if element was peeked successfully, error code otherwise) and pointer to
+	 * peeked element; error codes:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	std::pair<int, T*> peek()
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return peekInternal(semaphoreWaitFunctor);
+	}
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue.
+	 *
+	 * \return pair with return code (zero if element was peeked successfully, error code otherwise) and pointer to
+	 * peeked element; error codes:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	std::pair<int, T*> tryPeek()
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return peekInternal(semaphoreTryWaitFunctor);
+	}
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without peeking the element
+	 *
+	 * \return pair with return code (zero if element was peeked successfully, error code otherwise) and pointer to
+	 * peeked element; error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	std::pair<int, T*> tryPeekFor(const TickClock::duration duration)
+	{
+		const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		return peekInternal(semaphoreTryWaitForFunctor);
+	}
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue for a given duration of time.
+	 *
+	 * Template variant of tryPeekFor(TickClock::duration).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without peeking the element
+	 *
+	 * \return pair with return code (zero if element was peeked successfully, error code otherwise) and pointer to
+	 * peeked element; error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, T*> tryPeekFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryPeekFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without peeking the element
+	 *
+	 * \return pair with return code (zero if element was peeked successfully, error code otherwise) and pointer to
+	 * peeked element; error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	std::pair<int, T*> tryPeekUntil(const TickClock::time_point timePoint)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return peekInternal(semaphoreTryWaitUntilFunctor);
+	}
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue until a given time point.
+	 *
+	 * Template variant of tryPeekUntil(TickClock::time_point).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without peeking the element
+	 *
+	 * \return pair with return code (zero if element was peeked successfully, error code otherwise) and pointer to
+	 * peeked element; error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	std::pair<int, T*> tryPeekUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryPeekUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	/**
+	 * \brief Releases the slot of element peeked with one of peek() functions.
+	 *
+	 * The element is destructed. Slots freed by pop() (and similar functions) and release() are made available for
+	 * "push" functions when the last outstanding peek is released.
+	 *
+	 * \param [in] element is a pointer to element returned by one of peek() functions
+	 *
+	 * \return zero if slot was released successfully, error code otherwise:
+	 * - EPERM - there is no outstanding peek;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int release(T* const element)
+	{
+		element->~T();
+		return fifoQueueBase_.release();
+	}
+
+	/**
+	 * \brief Reserves the slot for element in the queue.
+	 *
+	 * The element must be constructed in the returned storage (for example with placement new) and then published
+	 * with commit(). No element is available for "pop" functions until commit() is called. Returned pointer is void*
+	 * and not T* (like in peek()), because there is no object of type T in the storage until it is constructed there.
+	 *
+	 * \warning Each reservation must be finished with commit() or cancel(). While any reservation is outstanding,
+	 * elements pushed with other functions are not available for "pop" functions.
+	 *
+	 * \return pair with return code (zero if slot was reserved successfully, error code otherwise) and pointer to
+	 * storage for element; error codes:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	std::pair<int, void*> reserve()
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return fifoQueueBase_.reserve(semaphoreWaitFunctor);
+	}
+
+	/**
+	 * \brief Tries to reserve the slot for element in the queue.
+	 *
+	 * \return pair with return code (zero if slot was reserved successfully, error code otherwise) and pointer to
+	 * storage for element; error codes:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	std::pair<int, void*> tryReserve()
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return fifoQueueBase_.reserve(semaphoreTryWaitFunctor);
+	}
+
+	/**
+	 * \brief Tries to reserve the slot for element in the queue for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the slot
+	 *
+	 * \return pair with return code (zero if slot was reserved successfully, error code otherwise) and pointer to
+	 * storage for element; error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	std::pair<int, void*> tryReserveFor(const TickClock::duration duration)
+	{
+		const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		return fifoQueueBase_.reserve(semaphoreTryWaitForFunctor);
+	}
+
+	/**
+	 * \brief Tries to reserve the slot for element in the queue for a given duration of time.
+	 *
+	 * Template variant of tryReserveFor(TickClock::duration).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the slot
+	 *
+	 * \return pair with return code (zero if slot was reserved successfully, error code otherwise) and pointer to
+	 * storage for element; error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, void*> tryReserveFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryReserveFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to reserve the slot for element in the queue until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the slot
+	 *
+	 * \return pair with return code (zero if slot was reserved successfully, error code otherwise) and pointer to
+	 * storage for element; error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	std::pair<int, void*> tryReserveUntil(const TickClock::time_point timePoint)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return fifoQueueBase_.reserve(semaphoreTryWaitUntilFunctor);
+	}
+
+	/**
+	 * \brief Tries to reserve the slot for element in the queue until a given time point.
+	 *
+	 * Template variant of tryReserveUntil(TickClock::time_point).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the slot
+	 *
+	 * \return pair with return code (zero if slot was reserved successfully, error code otherwise) and pointer to
+	 * storage for element; error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	std::pair<int, void*> tryReserveUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryReserveUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	/**
+	 * \brief Commits the element written to the slot reserved with one of reserve() functions.
+	 *
+	 * Elements pushed with push() (and similar functions) and commit() are made available for "pop" functions when the
+	 * last outstanding reservation is committed.
+	 *
+	 * \return zero if element was committed successfully, error code otherwise:
+	 * - EPERM - there is no outstanding reservation;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int commit()
+	{
+		return fifoQueueBase_.commit();
+	}
+
+	/**
+	 * \brief Cancels reservation made with one of reserve() functions.
+	 *
+	 * The slot is returned to the queue without publishing any element. Only the last slot taken for writing may be
+	 * returned - if other slot was reserved or other element was pushed after \a storage, the reservation must be
+	 * finished with commit().
+	 *
+	 * \param [in] storage is a pointer to storage for element returned by one of reserve() functions, element in this
+	 * storage must not be constructed (or must be already destructed)
+	 *
+	 * \return zero if reservation was cancelled successfully, error code otherwise:
+	 * - EBUSY - \a storage is not the last slot taken for writing;
+	 * - EPERM - there is no outstanding reservation;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int cancel(void* const storage)
+	{
+		return fifoQueueBase_.cancel(storage);
+	}
+
 private:
 
 #if DISTORTOS_FIFOQUEUE_EMPLACE_SUPPORTED == 1 || DOXYGEN == 1
@@ -598,6 +1147,40 @@ private:
 
 	int popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T& value);
 
+	/**
+	 * \brief Peeks the oldest (first) element in the queue.
+	 *
+	 * Internal version - converts the pointer returned by internal::FifoQueueBase::peek().
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 *
+	 * \return pair with return code (zero if element was peeked successfully, error code otherwise) and pointer to
+	 * peeked element; error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	std::pair<int, T*> peekInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor);
+
+	/**
+	 * \brief Pops up to \a count of the oldest (first) elements from the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the maximum number of elements that will be popped
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T* values,
+			size_t count);
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -629,6 +1212,26 @@ private:
 
 	int pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T&& value);
 
+	/**
+	 * \brief Pushes up to \a count of elements to the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const T* values,
+			size_t count);
+
 	/// contained internal::FifoQueueBase object which implements whole functionality
 	internal::FifoQueueBase fifoQueueBase_;
 };
@@ -663,6 +1266,31 @@ int FifoQueue<T>::popInternal(const internal::SemaphoreFunctor& waitSemaphoreFun
 	return fifoQueueBase_.pop(waitSemaphoreFunctor, swapPopQueueFunctor);
 }
 
+template<typename T>
+std::pair<int, size_t> FifoQueue<T>::popNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		T* values, const size_t count)
+{
+	if (count == 0)
+		return {EINVAL, {}};
+
+	const auto popNFunctor = internal::makeBoundQueueFunctor(
+			[&values](void* const storage)
+			{
+				const internal::SwapPopQueueFunctor<T> swapPopQueueFunctor {*values++};
+				swapPopQueueFunctor(storage);
+			});
+	size_t popped;
+	const auto ret = fifoQueueBase_.popN(waitSemaphoreFunctor, popNFunctor, count, popped);
+	return {ret, popped};
+}
+
+template<typename T>
+std::pair<int, T*> FifoQueue<T>::peekInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor)
+{
+	const auto ret = fifoQueueBase_.peek(waitSemaphoreFunctor);
+	return {ret.first, reinterpret_cast<T*>(ret.second)};
+}
+
 template<typename T>
 int FifoQueue<T>::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const T& value)
 {
@@ -677,6 +1305,24 @@ int FifoQueue<T>::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFu
 	return fifoQueueBase_.push(waitSemaphoreFunctor, moveConstructQueueFunctor);
 }
 
+template<typename T>
+std::pair<int, size_t> FifoQueue<T>::pushNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		const T* values, const size_t count)
+{
+	if (count == 0)
+		return {EINVAL, {}};
+
+	const auto pushNFunctor = internal::makeBoundQueueFunctor(
+			[&values](void* const storage)
+			{
+				const internal::CopyConstructQueueFunctor<T> copyConstructQueueFunctor {*values++};
+				copyConstructQueueFunctor(storage);
+			});
+	size_t pushed;
+	const auto ret = fifoQueueBase_.pushN(waitSemaphoreFunctor, pushNFunctor, count, pushed);
+	return {ret, pushed};
+}
+
 }	// namespace distortos
 
 #endif	// INCLUDE_DISTORTOS_FIFOQUEUE_HPP_
@@ -0,0 +1,87 @@
+/**
+ * \file
+ * \brief HighResolutionClock class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_HIGHRESOLUTIONCLOCK_HPP_
+#define INCLUDE_DISTORTOS_HIGHRESOLUTIONCLOCK_HPP_
+
+#include "distortos/TickClock.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief HighResolutionClock is a std::chrono clock with sub-tick resolution, equivalent of
+ * std::chrono::high_resolution_clock
+ *
+ * Time is calculated from tick count and the elapsed part of current tick, read from the timer which generates tick
+ * interrupt, so the real resolution is the period of this timer's clock. The clock has the same epoch as TickClock and
+ * its values are always in the range [TickClock::now(); TickClock::now() + 1 tick).
+ *
+ * \note now() may be called from thread and interrupt context.
+ *
+ * \ingroup clocks
+ */
+
+class HighResolutionClock
+{
+public:
+
+	/// type of counter
+	using rep = uint64_t;
+
+	/// std::ratio type representing the period of the clock, seconds
+	using period = std::nano;
+
+	/// basic duration type of clock
+	using duration = std::chrono::duration<rep, period>;
+
+	/// basic time_point type of clock
+	using time_point = std::chrono::time_point<HighResolutionClock>;
+
+	/**
+	 * \brief Converts TickClock's time point to HighResolutionClock's time point.
+	 *
+	 * \param [in] timePoint is the TickClock's time point which will be converted
+	 *
+	 * \return time point of HighResolutionClock equivalent to \a timePoint
+	 */
+
+	constexpr static time_point fromTickClock(const TickClock::time_point timePoint)
+	{
+		return time_point{std::chrono::duration_cast<duration>(timePoint.time_since_epoch())};
+	}
+
+	/**
+	 * \return time_point representing the current value of the clock
+	 */
+
+	static time_point now();
+
+	/**
+	 * \brief Converts HighResolutionClock's time point to TickClock's time point.
+	 *
+	 * \param [in] timePoint is the HighResolutionClock's time point which will be converted
+	 *
+	 * \return time point of TickClock with the tick in which \a timePoint lies
+	 */
+
+	constexpr static TickClock::time_point toTickClock(const time_point timePoint)
+	{
+		return TickClock::time_point{std::chrono::duration_cast<TickClock::duration>(timePoint.time_since_epoch())};
+	}
+
+	/// this is a steady clock - it cannot be adjusted
+	constexpr static bool is_steady {true};
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_HIGHRESOLUTIONCLOCK_HPP_
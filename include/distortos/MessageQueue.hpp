@@ -2,7 +2,7 @@
  * \file
  * \brief MessageQueue class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -44,6 +44,8 @@ namespace distortos
 template<typename T>
 class MessageQueue
 {
+	friend class WaitAnyObject;
+
 public:
 
 	/// type of uninitialized storage for Entry with link
@@ -59,6 +61,9 @@ public:
 	using ValueStorageUniquePointer =
 			std::unique_ptr<ValueStorage[], internal::MessageQueueBase::ValueStorageUniquePointer::deleter_type>;
 
+	/// import PriorityBuckets type from internal::MessageQueueBase class
+	using PriorityBuckets = internal::MessageQueueBase::PriorityBuckets;
+
 	/**
 	 * \brief MessageQueue's constructor
 	 *
@@ -67,13 +72,17 @@ public:
 	 * \param [in] valueStorageUniquePointer is a rvalue reference to ValueStorageUniquePointer with storage for queue
 	 * elements (sufficiently large for \a maxElements, each sizeof(T) bytes long) and appropriate deleter
 	 * \param [in] maxElements is the number of elements in \a entryStorage and \a valueStorage arrays
+	 * \param [in] priorityBuckets is a pointer to PriorityBuckets object which will be used to make all "push"
+	 * functions constant-time operations, nullptr to use plain sorted list of entries (insertion time depends on the
+	 * number of elements in the queue), default - nullptr
 	 */
 
 	MessageQueue(EntryStorageUniquePointer&& entryStorageUniquePointer,
-			ValueStorageUniquePointer&& valueStorageUniquePointer, const size_t maxElements) :
+			ValueStorageUniquePointer&& valueStorageUniquePointer, const size_t maxElements,
+			PriorityBuckets* const priorityBuckets = {}) :
 			messageQueueBase_{std::move(entryStorageUniquePointer),
 					{valueStorageUniquePointer.release(), valueStorageUniquePointer.get_deleter()},
-					sizeof(*valueStorageUniquePointer.get()), maxElements}
+					sizeof(*valueStorageUniquePointer.get()), maxElements, priorityBuckets}
 	{
 
 	}
@@ -2,7 +2,7 @@
  * \file
  * \brief RawFifoQueue class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -29,6 +29,8 @@ namespace distortos
 
 class RawFifoQueue
 {
+	friend class WaitAnyObject;
+
 public:
 
 	/// unique_ptr (with deleter) to storage
@@ -418,6 +420,690 @@ public:
 		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), &data, sizeof(data));
 	}
 
+	/**
+	 * \brief Pops up to \a count of the oldest (first) elements from the queue.
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped elements, sufficiently large for \a count elements
+	 * \param [in] count is the maximum number of elements that will be popped
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popN(void* buffer, size_t count, size_t size);
+
+	/**
+	 * \brief Pops up to \a count of the oldest (first) elements from the queue.
+	 *
+	 * \tparam T is the type of data popped from the queue
+	 *
+	 * \param [out] buffer is a pointer to array of objects that will be used to return popped values
+	 * \param [in] count is the maximum number of elements that will be popped
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename T>
+	std::pair<int, size_t> popN(T* const buffer, const size_t count)
+	{
+		return popN(buffer, count, sizeof(*buffer));
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count of the oldest (first) elements from the queue.
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped elements, sufficiently large for \a count elements
+	 * \param [in] count is the maximum number of elements that will be popped
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopN(void* buffer, size_t count, size_t size);
+
+	/**
+	 * \brief Tries to pop up to \a count of the oldest (first) elements from the queue.
+	 *
+	 * \tparam T is the type of data popped from the queue
+	 *
+	 * \param [out] buffer is a pointer to array of objects that will be used to return popped values
+	 * \param [in] count is the maximum number of elements that will be popped
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename T>
+	std::pair<int, size_t> tryPopN(T* const buffer, const size_t count)
+	{
+		return tryPopN(buffer, count, sizeof(*buffer));
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count of the oldest (first) elements from the queue for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping any element
+	 * \param [out] buffer is a pointer to buffer for popped elements, sufficiently large for \a count elements
+	 * \param [in] count is the maximum number of elements that will be popped
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopNFor(TickClock::duration duration, void* buffer, size_t count, size_t size);
+
+	/**
+	 * \brief Tries to pop up to \a count of the oldest (first) elements from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopNFor(TickClock::duration, void*, size_t, size_t).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping any element
+	 * \param [out] buffer is a pointer to buffer for popped elements, sufficiently large for \a count elements
+	 * \param [in] count is the maximum number of elements that will be popped
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPopNFor(const std::chrono::duration<Rep, Period> duration, void* const buffer,
+			const size_t count, const size_t size)
+	{
+		return tryPopNFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, count, size);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count of the oldest (first) elements from the queue for a given duration of time.
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 * \tparam T is the type of data popped from the queue
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping any element
+	 * \param [out] buffer is a pointer to array of objects that will be used to return popped values
+	 * \param [in] count is the maximum number of elements that will be popped
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period, typename T>
+	std::pair<int, size_t> tryPopNFor(const std::chrono::duration<Rep, Period> duration, T* const buffer,
+			const size_t count)
+	{
+		return tryPopNFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, count, sizeof(*buffer));
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count of the oldest (first) elements from the queue until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping any element
+	 * \param [out] buffer is a pointer to buffer for popped elements, sufficiently large for \a count elements
+	 * \param [in] count is the maximum number of elements that will be popped
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopNUntil(TickClock::time_point timePoint, void* buffer, size_t count, size_t size);
+
+	/**
+	 * \brief Tries to pop up to \a count of the oldest (first) elements from the queue until a given time point.
+	 *
+	 * Template variant of tryPopNUntil(TickClock::time_point, void*, size_t, size_t).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping any element
+	 * \param [out] buffer is a pointer to buffer for popped elements, sufficiently large for \a count elements
+	 * \param [in] count is the maximum number of elements that will be popped
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPopNUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			void* const buffer, const size_t count, const size_t size)
+	{
+		return tryPopNUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, count, size);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a count of the oldest (first) elements from the queue until a given time point.
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 * \tparam T is the type of data popped from the queue
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping any element
+	 * \param [out] buffer is a pointer to array of objects that will be used to return popped values
+	 * \param [in] count is the maximum number of elements that will be popped
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration, typename T>
+	std::pair<int, size_t> tryPopNUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T* const buffer,
+			const size_t count)
+	{
+		return tryPopNUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, count,
+				sizeof(*buffer));
+	}
+
+	/**
+	 * \brief Pushes up to \a count of the elements to the queue.
+	 *
+	 * \param [in] data is a pointer to array of elements that will be pushed to RawFifoQueue
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushN(const void* data, size_t count, size_t size);
+
+	/**
+	 * \brief Pushes up to \a count of the elements to the queue.
+	 *
+	 * \tparam T is the type of data pushed to the queue
+	 *
+	 * \param [in] data is a pointer to array of objects that will be pushed to RawFifoQueue
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename T>
+	std::pair<int, size_t> pushN(const T* const data, const size_t count)
+	{
+		return pushN(data, count, sizeof(*data));
+	}
+
+	/**
+	 * \brief Tries to push up to \a count of the elements to the queue.
+	 *
+	 * \param [in] data is a pointer to array of elements that will be pushed to RawFifoQueue
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushN(const void* data, size_t count, size_t size);
+
+	/**
+	 * \brief Tries to push up to \a count of the elements to the queue.
+	 *
+	 * \tparam T is the type of data pushed to the queue
+	 *
+	 * \param [in] data is a pointer to array of objects that will be pushed to RawFifoQueue
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename T>
+	std::pair<int, size_t> tryPushN(const T* const data, const size_t count)
+	{
+		return tryPushN(data, count, sizeof(*data));
+	}
+
+	/**
+	 * \brief Tries to push up to \a count of the elements to the queue for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing any element
+	 * \param [in] data is a pointer to array of elements that will be pushed to RawFifoQueue
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushNFor(TickClock::duration duration, const void* data, size_t count, size_t size);
+
+	/**
+	 * \brief Tries to push up to \a count of the elements to the queue for a given duration of time.
+	 *
+	 * Template variant of tryPushNFor(TickClock::duration, const void*, size_t, size_t).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing any element
+	 * \param [in] data is a pointer to array of elements that will be pushed to RawFifoQueue
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPushNFor(const std::chrono::duration<Rep, Period> duration, const void* const data,
+			const size_t count, const size_t size)
+	{
+		return tryPushNFor(std::chrono::duration_cast<TickClock::duration>(duration), data, count, size);
+	}
+
+	/**
+	 * \brief Tries to push up to \a count of the elements to the queue for a given duration of time.
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 * \tparam T is the type of data pushed to the queue
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing any element
+	 * \param [in] data is a pointer to array of objects that will be pushed to RawFifoQueue
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period, typename T>
+	std::pair<int, size_t> tryPushNFor(const std::chrono::duration<Rep, Period> duration, const T* const data,
+			const size_t count)
+	{
+		return tryPushNFor(std::chrono::duration_cast<TickClock::duration>(duration), data, count, sizeof(*data));
+	}
+
+	/**
+	 * \brief Tries to push up to \a count of the elements to the queue until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing any element
+	 * \param [in] data is a pointer to array of elements that will be pushed to RawFifoQueue
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushNUntil(TickClock::time_point timePoint, const void* data, size_t count, size_t size);
+
+	/**
+	 * \brief Tries to push up to \a count of the elements to the queue until a given time point.
+	 *
+	 * Template variant of tryPushNUntil(TickClock::time_point, const void*, size_t, size_t).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing any element
+	 * \param [in] data is a pointer to array of elements that will be pushed to RawFifoQueue
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPushNUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const void* const data, const size_t count, const size_t size)
+	{
+		return tryPushNUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), data, count, size);
+	}
+
+	/**
+	 * \brief Tries to push up to \a count of the elements to the queue until a given time point.
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 * \tparam T is the type of data pushed to the queue
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing any element
+	 * \param [in] data is a pointer to array of objects that will be pushed to RawFifoQueue
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration, typename T>
+	std::pair<int, size_t> tryPushNUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const T* const data, const size_t count)
+	{
+		return tryPushNUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), data, count, sizeof(*data));
+	}
+
+	/**
+	 * \brief Peeks the oldest (first) element in the queue.
+	 *
+	 * The element is removed from the queue, but it stays in queue's storage and may be accessed in place. The slot
+	 * is not available for "push" functions until release() is called.
+	 *
+	 * \return pair with return code (zero if element was peeked successfully, error code otherwise) and pointer to
+	 * peeked element; error codes:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	std::pair<int, void*> peek();
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue.
+	 *
+	 * \return pair with return code (zero if element was peeked successfully, error code otherwise) and pointer to
+	 * peeked element; error codes:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	std::pair<int, void*> tryPeek();
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without peeking the element
+	 *
+	 * \return pair with return code (zero if element was peeked successfully, error code otherwise) and pointer to
+	 * peeked element; error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	std::pair<int, void*> tryPeekFor(TickClock::duration duration);
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue for a given duration of time.
+	 *
+	 * Template variant of tryPeekFor(TickClock::duration).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without peeking the element
+	 *
+	 * \return pair with return code (zero if element was peeked successfully, error code otherwise) and pointer to
+	 * peeked element; error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, void*> tryPeekFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryPeekFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without peeking the element
+	 *
+	 * \return pair with return code (zero if element was peeked successfully, error code otherwise) and pointer to
+	 * peeked element; error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	std::pair<int, void*> tryPeekUntil(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue until a given time point.
+	 *
+	 * Template variant of tryPeekUntil(TickClock::time_point).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without peeking the element
+	 *
+	 * \return pair with return code (zero if element was peeked successfully, error code otherwise) and pointer to
+	 * peeked element; error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	std::pair<int, void*> tryPeekUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryPeekUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	/**
+	 * \brief Releases the slot of element peeked with one of peek() functions.
+	 *
+	 * Slots freed by pop() (and similar functions) and release() are made available for "push" functions when the last
+	 * outstanding peek is released.
+	 *
+	 * \return zero if slot was released successfully, error code otherwise:
+	 * - EPERM - there is no outstanding peek;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int release()
+	{
+		return fifoQueueBase_.release();
+	}
+
+	/**
+	 * \brief Reserves the slot for element in the queue.
+	 *
+	 * The element must be written to the returned storage and then published with commit(). No element is
+	 * available for "pop" functions until commit() is called.
+	 *
+	 * \warning Each reservation must be finished with commit() or cancel(). While any reservation is outstanding,
+	 * elements pushed with other functions are not available for "pop" functions.
+	 *
+	 * \return pair with return code (zero if slot was reserved successfully, error code otherwise) and pointer to
+	 * storage for element; error codes:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	std::pair<int, void*> reserve();
+
+	/**
+	 * \brief Tries to reserve the slot for element in the queue.
+	 *
+	 * \return pair with return code (zero if slot was reserved successfully, error code otherwise) and pointer to
+	 * storage for element; error codes:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	std::pair<int, void*> tryReserve();
+
+	/**
+	 * \brief Tries to reserve the slot for element in the queue for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the slot
+	 *
+	 * \return pair with return code (zero if slot was reserved successfully, error code otherwise) and pointer to
+	 * storage for element; error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	std::pair<int, void*> tryReserveFor(TickClock::duration duration);
+
+	/**
+	 * \brief Tries to reserve the slot for element in the queue for a given duration of time.
+	 *
+	 * Template variant of tryReserveFor(TickClock::duration).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the slot
+	 *
+	 * \return pair with return code (zero if slot was reserved successfully, error code otherwise) and pointer to
+	 * storage for element; error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, void*> tryReserveFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryReserveFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to reserve the slot for element in the queue until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the slot
+	 *
+	 * \return pair with return code (zero if slot was reserved successfully, error code otherwise) and pointer to
+	 * storage for element; error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	std::pair<int, void*> tryReserveUntil(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to reserve the slot for element in the queue until a given time point.
+	 *
+	 * Template variant of tryReserveUntil(TickClock::time_point).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the slot
+	 *
+	 * \return pair with return code (zero if slot was reserved successfully, error code otherwise) and pointer to
+	 * storage for element; error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	std::pair<int, void*> tryReserveUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryReserveUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	/**
+	 * \brief Commits the element written to the slot reserved with one of reserve() functions.
+	 *
+	 * Elements pushed with push() (and similar functions) and commit() are made available for "pop" functions when the
+	 * last outstanding reservation is committed.
+	 *
+	 * \return zero if element was committed successfully, error code otherwise:
+	 * - EPERM - there is no outstanding reservation;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int commit()
+	{
+		return fifoQueueBase_.commit();
+	}
+
+	/**
+	 * \brief Cancels reservation made with one of reserve() functions.
+	 *
+	 * The slot is returned to the queue without publishing any element. Only the last slot taken for writing may be
+	 * returned - if other slot was reserved or other element was pushed after \a storage, the reservation must be
+	 * finished with commit().
+	 *
+	 * \param [in] storage is a pointer to storage for element returned by one of reserve() functions
+	 *
+	 * \return zero if reservation was cancelled successfully, error code otherwise:
+	 * - EBUSY - \a storage is not the last slot taken for writing;
+	 * - EPERM - there is no outstanding reservation;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int cancel(void* const storage)
+	{
+		return fifoQueueBase_.cancel(storage);
+	}
+
 private:
 
 	/**
@@ -437,6 +1123,28 @@ private:
 
 	int popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, void* buffer, size_t size);
 
+	/**
+	 * \brief Pops up to \a count of the oldest (first) elements from the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] buffer is a pointer to buffer for popped elements, sufficiently large for \a count elements
+	 * \param [in] count is the maximum number of elements that will be popped
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (zero if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, void* buffer,
+			size_t count, size_t size);
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -454,6 +1162,28 @@ private:
 
 	int pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* data, size_t size);
 
+	/**
+	 * \brief Pushes up to \a count of elements to the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] data is a pointer to array of elements that will be pushed to RawFifoQueue
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 * \param [in] size is the size of single element, bytes - must be equal to the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (zero if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EINVAL - \a count is zero;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* data,
+			size_t count, size_t size);
+
 	/// contained internal::FifoQueueBase object which implements base functionality
 	internal::FifoQueueBase fifoQueueBase_;
 };
@@ -2,7 +2,7 @@
  * \file
  * \brief RawMessageQueue class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -32,6 +32,8 @@ namespace distortos
 
 class RawMessageQueue
 {
+	friend class WaitAnyObject;
+
 public:
 
 	/// type of uninitialized storage for Entry with link
@@ -51,6 +53,9 @@ public:
 
 	using ValueStorageUniquePointer = internal::MessageQueueBase::ValueStorageUniquePointer;
 
+	/// import PriorityBuckets type from internal::MessageQueueBase class
+	using PriorityBuckets = internal::MessageQueueBase::PriorityBuckets;
+
 	/**
 	 * \brief RawMessageQueue's constructor
 	 *
@@ -60,10 +65,14 @@ public:
 	 * elements (sufficiently large for \a maxElements, each \a elementSize bytes long) and appropriate deleter
 	 * \param [in] elementSize is the size of single queue element, bytes
 	 * \param [in] maxElements is the number of elements in \a entryStorage array and \a valueStorage memory block
+	 * \param [in] priorityBuckets is a pointer to PriorityBuckets object which will be used to make all "push"
+	 * functions constant-time operations, nullptr to use plain sorted list of entries (insertion time depends on the
+	 * number of elements in the queue), default - nullptr
 	 */
 
 	RawMessageQueue(EntryStorageUniquePointer&& entryStorageUniquePointer,
-			ValueStorageUniquePointer&& valueStorageUniquePointer, size_t elementSize, size_t maxElements);
+			ValueStorageUniquePointer&& valueStorageUniquePointer, size_t elementSize, size_t maxElements,
+			PriorityBuckets* priorityBuckets = {});
 
 	/**
 	 * \brief Pops oldest element with highest priority from the queue.
@@ -29,6 +29,9 @@ enum class SchedulingPolicy : uint8_t
 	fifo,
 	/// round-robin scheduling policy
 	roundRobin,
+	/// earliest-deadline-first scheduling policy - among threads with the same priority, runnable threads with this
+	/// policy are ordered by absolute deadline and are placed before threads with other policies
+	earliestDeadlineFirst,
 };
 
 }	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief Semaphore class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -16,9 +16,23 @@
 
 #include "distortos/TickClock.hpp"
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+#include "distortos/HighResolutionClock.hpp"
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 namespace distortos
 {
 
+namespace internal
+{
+
+class FifoQueueBase;
+class WaitAnyRegistration;
+
+}	// namespace internal
+
 /**
  * \brief Semaphore is the basic synchronization primitive
  *
@@ -29,6 +43,9 @@ namespace distortos
 
 class Semaphore
 {
+	friend class internal::FifoQueueBase;
+	friend class internal::WaitAnyRegistration;
+
 public:
 
 	/// type used for semaphore's "value"
@@ -48,7 +65,8 @@ public:
 	constexpr explicit Semaphore(const Value value, const Value maxValue = std::numeric_limits<Value>::max()) :
 			blockedList_{},
 			value_{value <= maxValue ? value : maxValue},
-			maxValue_{maxValue}
+			maxValue_{maxValue},
+			waitAnyCount_{}
 	{
 
 	}
@@ -134,6 +152,25 @@ public:
 
 	int tryWaitFor(TickClock::duration duration);
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	/**
+	 * \brief Tries to lock the semaphore for given duration of time, with sub-tick precision of timeout.
+	 *
+	 * Variant of tryWaitFor(TickClock::duration duration) in which the timeout is handled by high precision timer.
+	 * Template variant of tryWaitFor() never uses this function, so sub-tick precision must be requested explicitly.
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the semaphore
+	 *
+	 * \return zero if the calling process successfully performed the semaphore lock operation, error code otherwise:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - the semaphore could not be locked before the specified timeout expired;
+	 */
+
+	int tryWaitForPrecise(HighResolutionClock::duration duration);
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 	/**
 	 * \brief Tries to lock the semaphore for given duration of time.
 	 *
@@ -176,6 +213,24 @@ public:
 
 	int tryWaitUntil(TickClock::time_point timePoint);
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	/**
+	 * \brief Tries to lock the semaphore until given time point, with sub-tick precision of timeout.
+	 *
+	 * Variant of tryWaitUntil(TickClock::time_point timePoint) in which the timeout is handled by high precision timer.
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the semaphore
+	 *
+	 * \return zero if the calling process successfully performed the semaphore lock operation, error code otherwise:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - ETIMEDOUT - the semaphore could not be locked before the specified timeout expired;
+	 */
+
+	int tryWaitUntilPrecise(HighResolutionClock::time_point timePoint);
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 	/**
 	 * \brief Tries to lock the semaphore until given time point.
 	 *
@@ -219,6 +274,36 @@ public:
 
 private:
 
+	/**
+	 * \brief Posts the semaphore \a count times.
+	 *
+	 * Internal function used by batched operations of queues. Up to \a count threads blocked on the semaphore are
+	 * unblocked and the value of semaphore is incremented by the rest of \a count.
+	 *
+	 * \warning This function must be called with interrupts masked.
+	 *
+	 * \param [in] count is the number of "post" operations
+	 *
+	 * \return zero if the semaphore was posted \a count times, error code otherwise:
+	 * - EOVERFLOW - the maximum allowable value for a semaphore would be exceeded;
+	 */
+
+	int postNInternal(Value count);
+
+	/**
+	 * \brief Decrements the value of semaphore by up to \a count, without blocking.
+	 *
+	 * Internal function used by batched operations of queues.
+	 *
+	 * \warning This function must be called with interrupts masked.
+	 *
+	 * \param [in] count is the requested number of "wait" operations
+	 *
+	 * \return number of successful "wait" operations, which is equal to the lower of \a count and value of semaphore
+	 */
+
+	Value tryWaitNInternal(Value count);
+
 	/**
 	 * \brief Internal version of tryWait().
 	 *
@@ -238,6 +323,9 @@ private:
 
 	/// max value of the semaphore
 	Value maxValue_;
+
+	/// number of references to this semaphore in ranges of objects waited for by threads blocked in waitAny()
+	mutable size_t waitAnyCount_;
 };
 
 }	// namespace distortos
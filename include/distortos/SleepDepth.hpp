@@ -0,0 +1,40 @@
+/**
+ * \file
+ * \brief SleepDepth enum class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_SLEEPDEPTH_HPP_
+#define INCLUDE_DISTORTOS_SLEEPDEPTH_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+/**
+ * \brief depth of sleep of idle thread
+ *
+ * \ingroup threads
+ */
+
+enum class SleepDepth : uint8_t
+{
+	/// no sleep - idle thread keeps the core running
+	none,
+	/// core is stopped until any interrupt becomes pending
+	waitForInterrupt,
+	/// core is stopped until any event is signaled or any interrupt becomes pending
+	waitForEvent,
+	/// core and chip-specific parts of the system (e.g. clocks) are stopped until wake-up interrupt becomes pending
+	deepSleep,
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_SLEEPDEPTH_HPP_
@@ -45,12 +45,58 @@ public:
 
 	~SoftwareTimerCommon() override;
 
+	/**
+	 * \return slack of software timer
+	 */
+
+	TickClock::duration getSlack() const
+	{
+		return softwareTimerControlBlock_.getSlack();
+	}
+
 	/**
 	 * \return true if the timer is running, false otherwise
 	 */
 
 	bool isRunning() const override;
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/**
+	 * \brief Selects the context in which software timer's function is executed.
+	 *
+	 * By default functions of all software timers are executed in software timer thread. Functions of software timers
+	 * that must be executed with minimal latency - and are short - may be executed directly in "tick" interrupt.
+	 *
+	 * \param [in] interruptContext selects whether software timer's function is executed in interrupt context (true)
+	 * or in software timer thread (false)
+	 */
+
+	void setInterruptContext(const bool interruptContext)
+	{
+		softwareTimerControlBlock_.setInterruptContext(interruptContext);
+	}
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/**
+	 * \brief Sets slack of software timer.
+	 *
+	 * Slack is the maximal delay of execution of software timer's function which is acceptable for the application.
+	 * When the timer is started, its expiration is moved within the window [time point; time point + slack] to a
+	 * "coarse" tick, so software timers with overlapping windows are likely to expire together - this reduces the
+	 * number of separate wake-ups (and - in tickless idle mode - the number of reprogramming events). Periodic
+	 * software timers do not drift - each period is calculated from the requested time point. The new value is used
+	 * the next time the timer is started.
+	 *
+	 * \param [in] slack is the slack of software timer, 0 (default) to disable coalescing
+	 */
+
+	void setSlack(const TickClock::duration slack)
+	{
+		softwareTimerControlBlock_.setSlack(slack);
+	}
+
 	/**
 	 * \brief Starts the timer.
 	 *
@@ -63,6 +109,23 @@ public:
 
 	int start(TickClock::time_point timePoint, TickClock::duration period = {}) override;
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	/**
+	 * \brief Starts the timer as one-shot software timer with sub-tick precision.
+	 *
+	 * The function is executed in the interrupt of high precision timer (or in software timer thread, if enabled and
+	 * selected with setInterruptContext()), with the precision of microseconds. Slack of software timer is not used.
+	 *
+	 * \param [in] timePoint is the time point at which the function will be executed
+	 *
+	 * \return 0 on success, error code otherwise
+	 */
+
+	int start(HighResolutionClock::time_point timePoint);
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 	using SoftwareTimer::start;
 
 	/**
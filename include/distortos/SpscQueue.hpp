@@ -0,0 +1,475 @@
+/**
+ * \file
+ * \brief SpscQueue class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_SPSCQUEUE_HPP_
+#define INCLUDE_DISTORTOS_SPSCQUEUE_HPP_
+
+#include "distortos/internal/synchronization/SpscQueueBase.hpp"
+#include "distortos/internal/synchronization/CopyConstructQueueFunctor.hpp"
+#include "distortos/internal/synchronization/MoveConstructQueueFunctor.hpp"
+#include "distortos/internal/synchronization/SwapPopQueueFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreWaitFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitUntilFunctor.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief SpscQueue class is a lock-free FIFO queue for thread-thread, thread-interrupt or interrupt-thread
+ * communication. It supports only single reader and single writer. It is implemented as a wrapper for
+ * internal::SpscQueueBase.
+ *
+ * Kernel is not involved as long as the queue is neither empty nor full - elements are transferred without masking
+ * interrupts, so this queue is suited for high-rate data streams (like data received in interrupt handler). Blocking
+ * variants of functions wait on internal semaphores only when the queue is empty (for pop) or full (for push).
+ *
+ * \warning All "pop" functions may be used only by one consumer (thread or interrupt handler) and all "push" functions
+ * may be used only by one producer (thread or interrupt handler), otherwise the behaviour is undefined.
+ *
+ * \tparam T is the type of data in queue
+ *
+ * \ingroup queues
+ */
+
+template<typename T>
+class SpscQueue
+{
+public:
+
+	/// type of uninitialized storage for data
+	using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+	/// unique_ptr (with deleter) to Storage[]
+	using StorageUniquePointer =
+			std::unique_ptr<Storage[], internal::SpscQueueBase::StorageUniquePointer::deleter_type>;
+
+	/**
+	 * \brief SpscQueue's constructor
+	 *
+	 * \param [in] storageUniquePointer is a rvalue reference to StorageUniquePointer with storage for queue elements
+	 * (sufficiently large for \a maxElements, each sizeof(T) bytes long) and appropriate deleter
+	 * \param [in] maxElements is the number of elements in storage array
+	 */
+
+	SpscQueue(StorageUniquePointer&& storageUniquePointer, const size_t maxElements) :
+			spscQueueBase_{{storageUniquePointer.release(), storageUniquePointer.get_deleter()}, sizeof(T), maxElements}
+	{
+
+	}
+
+	/**
+	 * \brief SpscQueue's destructor
+	 *
+	 * Pops all remaining elements from the queue.
+	 */
+
+	~SpscQueue();
+
+	/**
+	 * \brief Pops the oldest (first) element from the queue.
+	 *
+	 * \param [out] value is a reference to object that will be used to return popped value, its contents are swapped
+	 * with the value in the queue's storage and destructed when no longer needed
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int pop(T& value)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return popInternal(semaphoreWaitFunctor, value);
+	}
+
+	/**
+	 * \brief Pushes the element to the queue.
+	 *
+	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int push(const T& value)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return pushInternal(semaphoreWaitFunctor, value);
+	}
+
+	/**
+	 * \brief Pushes the element to the queue.
+	 *
+	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
+	 * move-constructed
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int push(T&& value)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return pushInternal(semaphoreWaitFunctor, std::move(value));
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue.
+	 *
+	 * \param [out] value is a reference to object that will be used to return popped value, its contents are swapped
+	 * with the value in the queue's storage and destructed when no longer needed
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	int tryPop(T& value)
+	{
+		internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return popInternal(semaphoreTryWaitFunctor, value);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the element
+	 * \param [out] value is a reference to object that will be used to return popped value, its contents are swapped
+	 * with the value in the queue's storage and destructed when no longer needed
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPopFor(const TickClock::duration duration, T& value)
+	{
+		return tryPopUntil(TickClock::now() + duration + TickClock::duration{1}, value);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopFor(TickClock::duration, T&).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the element
+	 * \param [out] value is a reference to object that will be used to return popped value, its contents are swapped
+	 * with the value in the queue's storage and destructed when no longer needed
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPopFor(const std::chrono::duration<Rep, Period> duration, T& value)
+	{
+		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), value);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
+	 * \param [out] value is a reference to object that will be used to return popped value, its contents are swapped
+	 * with the value in the queue's storage and destructed when no longer needed
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPopUntil(const TickClock::time_point timePoint, T& value)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return popInternal(semaphoreTryWaitUntilFunctor, value);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
+	 *
+	 * Template variant of tryPopUntil(TickClock::time_point, T&).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
+	 * \param [out] value is a reference to object that will be used to return popped value, its contents are swapped
+	 * with the value in the queue's storage and destructed when no longer needed
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T& value)
+	{
+		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), value);
+	}
+
+	/**
+	 * \brief Tries to push the element to the queue.
+	 *
+	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	int tryPush(const T& value)
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return pushInternal(semaphoreTryWaitFunctor, value);
+	}
+
+	/**
+	 * \brief Tries to push the element to the queue.
+	 *
+	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
+	 * move-constructed
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	int tryPush(T&& value)
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return pushInternal(semaphoreTryWaitFunctor, std::move(value));
+	}
+
+	/**
+	 * \brief Tries to push the element to the queue for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without pushing the element
+	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPushFor(const TickClock::duration duration, const T& value)
+	{
+		return tryPushUntil(TickClock::now() + duration + TickClock::duration{1}, value);
+	}
+
+	/**
+	 * \brief Tries to push the element to the queue for a given duration of time.
+	 *
+	 * Template variant of tryPushFor(TickClock::duration, const T&).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without pushing the element
+	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPushFor(const std::chrono::duration<Rep, Period> duration, const T& value)
+	{
+		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), value);
+	}
+
+	/**
+	 * \brief Tries to push the element to the queue for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing the element
+	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
+	 * move-constructed
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPushFor(const TickClock::duration duration, T&& value)
+	{
+		return tryPushUntil(TickClock::now() + duration + TickClock::duration{1}, std::move(value));
+	}
+
+	/**
+	 * \brief Tries to push the element to the queue for a given duration of time.
+	 *
+	 * Template variant of tryPushFor(TickClock::duration, T&&).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing the element
+	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
+	 * move-constructed
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPushFor(const std::chrono::duration<Rep, Period> duration, T&& value)
+	{
+		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), std::move(value));
+	}
+
+	/**
+	 * \brief Tries to push the element to the queue until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the element
+	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPushUntil(const TickClock::time_point timePoint, const T& value)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return pushInternal(semaphoreTryWaitUntilFunctor, value);
+	}
+
+	/**
+	 * \brief Tries to push the element to the queue until a given time point.
+	 *
+	 * Template variant of tryPushUntil(TickClock::time_point, const T&).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the element
+	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryPushUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const T& value)
+	{
+		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), value);
+	}
+
+	/**
+	 * \brief Tries to push the element to the queue until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the element
+	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
+	 * move-constructed
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPushUntil(const TickClock::time_point timePoint, T&& value)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return pushInternal(semaphoreTryWaitUntilFunctor, std::move(value));
+	}
+
+	/**
+	 * \brief Tries to push the element to the queue until a given time point.
+	 *
+	 * Template variant of tryPushUntil(TickClock::time_point, T&&).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the element
+	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
+	 * move-constructed
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryPushUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T&& value)
+	{
+		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), std::move(value));
+	}
+
+private:
+
+	/**
+	 * \brief Pops the oldest (first) element from the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] value is a reference to object that will be used to return popped value, its contents are swapped
+	 * with the value in the queue's storage and destructed when no longer needed
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T& value);
+
+	/**
+	 * \brief Pushes the element to the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const T& value);
+
+	/**
+	 * \brief Pushes the element to the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
+	 * move-constructed
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T&& value);
+
+	/// contained internal::SpscQueueBase object which implements whole functionality
+	internal::SpscQueueBase spscQueueBase_;
+};
+
+template<typename T>
+SpscQueue<T>::~SpscQueue()
+{
+	T value;
+	while (tryPop(value) == 0);
+}
+
+template<typename T>
+int SpscQueue<T>::popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T& value)
+{
+	const internal::SwapPopQueueFunctor<T> swapPopQueueFunctor {value};
+	return spscQueueBase_.pop(waitSemaphoreFunctor, swapPopQueueFunctor);
+}
+
+template<typename T>
+int SpscQueue<T>::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const T& value)
+{
+	const internal::CopyConstructQueueFunctor<T> copyConstructQueueFunctor {value};
+	return spscQueueBase_.push(waitSemaphoreFunctor, copyConstructQueueFunctor);
+}
+
+template<typename T>
+int SpscQueue<T>::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T&& value)
+{
+	const internal::MoveConstructQueueFunctor<T> moveConstructQueueFunctor {std::move(value)};
+	return spscQueueBase_.push(waitSemaphoreFunctor, moveConstructQueueFunctor);
+}
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_SPSCQUEUE_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief StaticMessageQueue class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -24,11 +24,13 @@ namespace distortos
  *
  * \tparam T is the type of data in queue
  * \tparam QueueSize is the maximum number of elements in queue
+ * \tparam PriorityBucketsEnabled selects whether the queue has PriorityBuckets object (true) - which makes all "push"
+ * functions constant-time operations at the cost of additional memory - or not (false), default - false
  *
  * \ingroup queues
  */
 
-template<typename T, size_t QueueSize>
+template<typename T, size_t QueueSize, bool PriorityBucketsEnabled = false>
 class StaticMessageQueue : public MessageQueue<T>
 {
 public:
@@ -39,13 +41,17 @@ public:
 	/// import ValueStorage type from base class
 	using typename MessageQueue<T>::ValueStorage;
 
+	/// import PriorityBuckets type from base class
+	using typename MessageQueue<T>::PriorityBuckets;
+
 	/**
 	 * \brief StaticMessageQueue's constructor
 	 */
 
 	explicit StaticMessageQueue() :
 			MessageQueue<T>{{entryStorage_.data(), internal::dummyDeleter<EntryStorage>},
-					{valueStorage_.data(), internal::dummyDeleter<ValueStorage>}, valueStorage_.size()}
+					{valueStorage_.data(), internal::dummyDeleter<ValueStorage>}, valueStorage_.size(),
+					PriorityBucketsEnabled == true ? priorityBuckets_.data() : nullptr}
 	{
 
 	}
@@ -57,6 +63,9 @@ private:
 
 	/// storage for queue's contents
 	std::array<ValueStorage, QueueSize> valueStorage_;
+
+	/// index of queue's entries, present only if \a PriorityBucketsEnabled is true
+	std::array<PriorityBuckets, PriorityBucketsEnabled == true ? 1 : 0> priorityBuckets_;
 };
 
 }	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief StaticRawMessageQueue class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -24,11 +24,13 @@ namespace distortos
  *
  * \tparam T is the type of data in queue
  * \tparam QueueSize is the maximum number of elements in queue
+ * \tparam PriorityBucketsEnabled selects whether the queue has PriorityBuckets object (true) - which makes all "push"
+ * functions constant-time operations at the cost of additional memory - or not (false), default - false
  *
  * \ingroup queues
  */
 
-template<typename T, size_t QueueSize>
+template<typename T, size_t QueueSize, bool PriorityBucketsEnabled = false>
 class StaticRawMessageQueue : public RawMessageQueue
 {
 public:
@@ -40,7 +42,7 @@ public:
 	explicit StaticRawMessageQueue() :
 			RawMessageQueue{{entryStorage_.data(), internal::dummyDeleter<EntryStorage>},
 					{valueStorage_.data(), internal::dummyDeleter<ValueStorage<T>>}, sizeof(*valueStorage_.data()),
-					valueStorage_.size()}
+					valueStorage_.size(), PriorityBucketsEnabled == true ? priorityBuckets_.data() : nullptr}
 	{
 
 	}
@@ -52,6 +54,9 @@ private:
 
 	/// storage for queue's contents
 	std::array<ValueStorage<T>, QueueSize> valueStorage_;
+
+	/// index of queue's entries, present only if \a PriorityBucketsEnabled is true
+	std::array<PriorityBuckets, PriorityBucketsEnabled == true ? 1 : 0> priorityBuckets_;
 };
 
 /**
@@ -60,11 +65,13 @@ private:
  *
  * \tparam ElementSize is the size of single queue element, bytes
  * \tparam QueueSize is the maximum number of elements in queue
+ * \tparam PriorityBucketsEnabled selects whether the queue has PriorityBuckets object, default - false
  */
 
-template<size_t ElementSize, size_t QueueSize>
+template<size_t ElementSize, size_t QueueSize, bool PriorityBucketsEnabled = false>
 using StaticRawMessageQueueFromSize =
-		StaticRawMessageQueue<typename std::aligned_storage<ElementSize, ElementSize>::type, QueueSize>;
+		StaticRawMessageQueue<typename std::aligned_storage<ElementSize, ElementSize>::type, QueueSize,
+		PriorityBucketsEnabled>;
 
 }	// namespace distortos
 
@@ -0,0 +1,57 @@
+/**
+ * \file
+ * \brief StaticSpscQueue class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICSPSCQUEUE_HPP_
+#define INCLUDE_DISTORTOS_STATICSPSCQUEUE_HPP_
+
+#include "SpscQueue.hpp"
+
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief StaticSpscQueue class is a variant of SpscQueue that has automatic storage for queue's contents.
+ *
+ * \tparam T is the type of data in queue
+ * \tparam QueueSize is the maximum number of elements in queue
+ *
+ * \ingroup queues
+ */
+
+template<typename T, size_t QueueSize>
+class StaticSpscQueue : public SpscQueue<T>
+{
+public:
+
+	/// import Storage type from base class
+	using typename SpscQueue<T>::Storage;
+
+	/**
+	 * \brief StaticSpscQueue's constructor
+	 */
+
+	explicit StaticSpscQueue() :
+			SpscQueue<T>{{storage_.data(), internal::dummyDeleter<Storage>}, storage_.size()}
+	{
+
+	}
+
+private:
+
+	/// storage for queue's contents
+	std::array<Storage, QueueSize> storage_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICSPSCQUEUE_HPP_
@@ -14,6 +14,12 @@
 
 #include "distortos/TickClock.hpp"
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+#include "distortos/HighResolutionClock.hpp"
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 namespace distortos
 {
 
@@ -89,6 +95,27 @@ void setPriority(uint8_t priority, bool alwaysBehind = {});
 
 int sleepFor(TickClock::duration duration);
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+/**
+ * \brief Makes the calling (current) thread sleep for at least given duration, with sub-tick precision.
+ *
+ * Current thread's state is changed to "sleeping". The thread is woken by high precision timer, so the sleep is
+ * precise to microseconds - no additional tick is added to the sleep duration.
+ *
+ * \note This function has a distinct name, so that calls like `sleepFor({})` are not ambiguous. Template variant of
+ * sleepFor() never uses this function, so sub-tick precision must be requested explicitly.
+ *
+ * \param [in] duration is the duration after which the thread will be woken
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINTR - the sleep was interrupted by an unmasked, caught signal;
+ */
+
+int sleepForPrecise(HighResolutionClock::duration duration);
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 /**
  * \brief Makes the calling (current) thread sleep for at least given duration.
  *
@@ -124,6 +151,24 @@ int sleepFor(const std::chrono::duration<Rep, Period> duration)
 
 int sleepUntil(TickClock::time_point timePoint);
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+/**
+ * \brief Makes the calling (current) thread sleep until some time point is reached, with sub-tick precision.
+ *
+ * Current thread's state is changed to "sleeping". The thread is woken by high precision timer, so the sleep is
+ * precise to microseconds.
+ *
+ * \param [in] timePoint is the time point at which the thread will be woken
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINTR - the sleep was interrupted by an unmasked, caught signal;
+ */
+
+int sleepUntilPrecise(HighResolutionClock::time_point timePoint);
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 /**
  * \brief Makes the calling (current) thread sleep until some time point is reached.
  *
@@ -143,6 +188,22 @@ int sleepUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
 	return sleepUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
 }
 
+/**
+ * \brief Finishes current period of the calling (current) thread and waits for the beginning of next period.
+ *
+ * This function should be used by threads with SchedulingPolicy::earliestDeadlineFirst at the end of each period. If
+ * current time is after absolute deadline of current period, deadline miss is counted. Beginning of next period is
+ * calculated by adding period to the beginning of current period and absolute deadline is set to beginning of next
+ * period plus relative deadline (see Thread::setDeadline()). If next period already started, the thread is only moved
+ * to a position on the list of runnable threads according to its new deadline, otherwise current thread's state is
+ * changed to "sleeping" until the beginning of next period.
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINTR - the sleep was interrupted by an unmasked, caught signal;
+ */
+
+int waitForNextPeriod();
+
 /**
  * \brief Yields time slot of the scheduler to next thread.
  */
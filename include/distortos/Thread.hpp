@@ -17,12 +17,16 @@
 #include "distortos/SchedulingPolicy.hpp"
 #include "distortos/SignalSet.hpp"
 #include "distortos/ThreadState.hpp"
+#include "distortos/TickClock.hpp"
 
 #include <csignal>
+#include <cstddef>
 
 namespace distortos
 {
 
+class ThreadGroup;
+
 /**
  * \brief Thread class is a pure abstract interface for threads
  *
@@ -78,6 +82,18 @@ public:
 
 	virtual int generateSignal(uint8_t signalNumber) = 0;
 
+	/**
+	 * \return CPU time used by thread, core clock cycles
+	 */
+
+	virtual uint64_t getCpuTime() const = 0;
+
+	/**
+	 * \return number of periods in which the thread missed its deadline
+	 */
+
+	virtual uint32_t getDeadlineMissCount() const = 0;
+
 	/**
 	 * \return effective priority of thread
 	 */
@@ -104,18 +120,49 @@ public:
 
 	virtual uint8_t getPriority() const = 0;
 
+	/**
+	 * \return length of round-robin quantum of the thread
+	 */
+
+	virtual TickClock::duration getRoundRobinQuantum() const = 0;
+
 	/**
 	 * \return scheduling policy of the thread
 	 */
 
 	virtual SchedulingPolicy getSchedulingPolicy() const = 0;
 
+	/**
+	 * \brief Gets high-water mark of thread's stack.
+	 *
+	 * Stack is painted with a known pattern when the thread is constructed, the boundary of the painted part which was
+	 * not overwritten is found with binary search. A buffer on the stack which was never written may hide deeper usage.
+	 * If only a guard band of stack is painted (CONFIG_STACK_PAINTING_GUARD_BAND) or stack is not painted at all
+	 * (CONFIG_STACK_PAINTING_NONE), the part which is not painted is reported as used.
+	 *
+	 * \return max number of bytes of thread's stack used so far
+	 */
+
+	virtual size_t getStackHighWaterMark() const = 0;
+
+	/**
+	 * \return size of thread's stack, bytes
+	 */
+
+	virtual size_t getStackSize() const = 0;
+
 	/**
 	 * \return current state of thread
 	 */
 
 	virtual ThreadState getState() const = 0;
 
+	/**
+	 * \return slack of timeouts of blocking functions called by the thread
+	 */
+
+	virtual TickClock::duration getTimerSlack() const = 0;
+
 	/**
 	 * \brief Waits for thread termination.
 	 *
@@ -157,6 +204,19 @@ public:
 
 	virtual int queueSignal(uint8_t signalNumber, sigval value) = 0;
 
+	/**
+	 * \brief Sets deadline parameters of thread.
+	 *
+	 * Deadline parameters are used only when the thread uses SchedulingPolicy::earliestDeadlineFirst. Current period of
+	 * the thread starts when this function is called. Next periods are started with ThisThread::waitForNextPeriod().
+	 *
+	 * \param [in] relativeDeadline is the deadline of each period, relative to the beginning of the period
+	 * \param [in] period is the period of the thread, 0 if the thread is aperiodic (each call to
+	 * ThisThread::waitForNextPeriod() starts new period immediately)
+	 */
+
+	virtual void setDeadline(TickClock::duration relativeDeadline, TickClock::duration period) = 0;
+
 	/**
 	 * \brief Changes priority of thread.
 	 *
@@ -170,12 +230,56 @@ public:
 
 	virtual void setPriority(uint8_t priority, bool alwaysBehind = {}) = 0;
 
+	/**
+	 * \brief Sets length of round-robin quantum of the thread.
+	 *
+	 * Round-robin quantum is used only when the thread uses SchedulingPolicy::roundRobin. When the thread used its
+	 * whole quantum, it is moved to the end of the group of runnable threads with the same priority. Long quantum is
+	 * suitable for throughput-bound threads, which should not be rotated needlessly, short quantum - for interactive
+	 * threads. If current quantum of the thread is longer than new length, it is truncated immediately.
+	 *
+	 * \param [in] roundRobinQuantum is the new length of round-robin quantum of the thread, 0 to restore the default
+	 * value derived from CONFIG_ROUND_ROBIN_FREQUENCY
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - \a roundRobinQuantum is negative or too long;
+	 */
+
+	virtual int setRoundRobinQuantum(TickClock::duration roundRobinQuantum) = 0;
+
 	/**
 	 * param [in] schedulingPolicy is the new scheduling policy of the thread
 	 */
 
 	virtual void setSchedulingPolicy(SchedulingPolicy schedulingPolicy) = 0;
 
+	/**
+	 * \brief Sets thread group of thread.
+	 *
+	 * This operation can be performed on threads in "New" state only. If thread group is not set, the thread inherits
+	 * the group of the thread which starts it.
+	 *
+	 * \param [in] threadGroup is a reference to ThreadGroup to which the thread will be added when it is started
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - thread is already started;
+	 */
+
+	virtual int setThreadGroup(ThreadGroup& threadGroup) = 0;
+
+	/**
+	 * \brief Sets slack of timeouts of blocking functions called by the thread.
+	 *
+	 * Timeouts of blocking functions (sleeps and all "try...For()" / "try...Until()" functions) called by the thread
+	 * may be delayed by not more than the slack, so that they expire together with other software timers and cause
+	 * fewer separate wake-ups. See SoftwareTimerCommon::setSlack() for details.
+	 *
+	 * \param [in] timerSlack is the slack of timeouts of blocking functions called by the thread, 0 (default) to
+	 * disable coalescing
+	 */
+
+	virtual void setTimerSlack(TickClock::duration timerSlack) = 0;
+
 	/**
 	 * \brief Starts the thread.
 	 *
@@ -0,0 +1,136 @@
+/**
+ * \file
+ * \brief ThreadGroup class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_THREADGROUP_HPP_
+#define INCLUDE_DISTORTOS_THREADGROUP_HPP_
+
+#include "distortos/internal/scheduler/ThreadGroupControlBlock.hpp"
+
+namespace distortos
+{
+
+class ThreadCommon;
+
+/**
+ * \brief ThreadGroup class is a container for internal::ThreadGroupControlBlock
+ *
+ * Thread is added to the group with Thread::setThreadGroup() before it is started - otherwise it inherits the group of
+ * the thread which started it. CPU usage of all threads in the group may be limited with setBudget().
+ *
+ * \attention ThreadGroup object must outlive all threads added to it.
+ *
+ * \ingroup threads
+ */
+
+class ThreadGroup
+{
+	friend class ThreadCommon;
+
+public:
+
+	/**
+	 * \brief ThreadGroup's constructor
+	 */
+
+	constexpr ThreadGroup() :
+			threadGroupControlBlock_{}
+	{
+
+	}
+
+	/**
+	 * \return CPU budget of the group per replenishment period, 0 if the group has no budget
+	 */
+
+	TickClock::duration getBudget() const
+	{
+		return threadGroupControlBlock_.getBudget();
+	}
+
+	/**
+	 * \return number of replenishment periods in which the group used its budget and was throttled
+	 */
+
+	uint32_t getOverrunCount() const
+	{
+		return threadGroupControlBlock_.getOverrunCount();
+	}
+
+	/**
+	 * \return true if the group used its budget and is throttled, false otherwise
+	 */
+
+	bool isThrottled() const
+	{
+		return threadGroupControlBlock_.isThrottled();
+	}
+
+	/**
+	 * \brief Sets CPU budget of the group.
+	 *
+	 * Threads of the group may use \a budget ticks of CPU time in each \a period. When the budget is used, the group is
+	 * throttled until the end of the period - its threads run only when no other thread is runnable (or when they hold
+	 * a mutex needed by a higher-priority thread). Current period begins when this function is called.
+	 *
+	 * \note Throttling and its end change effective priority of all threads of the group with interrupt masking
+	 * enabled, so the interrupt latency in these two moments of each period grows linearly with the number of threads
+	 * in the group - large groups with budget should be avoided if interrupt latency is critical.
+	 *
+	 * \param [in] budget is the CPU budget of the group per replenishment period, 0 to disable budget enforcement
+	 * \param [in] period is the replenishment period, must be greater than \a budget (ignored if \a budget is 0)
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - \a budget is negative or \a period is not greater than \a budget;
+	 */
+
+	int setBudget(const TickClock::duration budget, const TickClock::duration period)
+	{
+		return threadGroupControlBlock_.setBudget(budget, period);
+	}
+
+	/**
+	 * \brief Sets CPU budget of the group.
+	 *
+	 * Template variant of setBudget(TickClock::duration, TickClock::duration).
+	 *
+	 * \tparam Rep1 is type of tick counter of \a budget
+	 * \tparam Period1 is std::ratio type representing the tick period of the clock of \a budget, seconds
+	 * \tparam Rep2 is type of tick counter of \a period
+	 * \tparam Period2 is std::ratio type representing the tick period of the clock of \a period, seconds
+	 *
+	 * \param [in] budget is the CPU budget of the group per replenishment period, 0 to disable budget enforcement
+	 * \param [in] period is the replenishment period, must be greater than \a budget (ignored if \a budget is 0)
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - \a budget is negative or \a period is not greater than \a budget;
+	 */
+
+	template<typename Rep1, typename Period1, typename Rep2, typename Period2>
+	int setBudget(const std::chrono::duration<Rep1, Period1> budget, const std::chrono::duration<Rep2, Period2> period)
+	{
+		return setBudget(std::chrono::duration_cast<TickClock::duration>(budget),
+				std::chrono::duration_cast<TickClock::duration>(period));
+	}
+
+	ThreadGroup(const ThreadGroup&) = delete;
+	ThreadGroup(ThreadGroup&&) = delete;
+	const ThreadGroup& operator=(const ThreadGroup&) = delete;
+	ThreadGroup& operator=(ThreadGroup&&) = delete;
+
+private:
+
+	/// contained internal::ThreadGroupControlBlock object
+	internal::ThreadGroupControlBlock threadGroupControlBlock_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_THREADGROUP_HPP_
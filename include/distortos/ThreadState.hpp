@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadState enum class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -47,6 +47,10 @@ enum class ThreadState : uint8_t
 	blockedOnOnceFlag,
 	/// internal thread object was detached
 	detached,
+	/// thread is blocked on EventFlags
+	blockedOnEventFlags,
+	/// thread is blocked in waitAny()
+	blockedOnWaitAny,
 };
 
 }	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief InterruptMaskingLock class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,6 +12,8 @@
 #ifndef INCLUDE_DISTORTOS_ARCHITECTURE_INTERRUPTMASKINGLOCK_HPP_
 #define INCLUDE_DISTORTOS_ARCHITECTURE_INTERRUPTMASKINGLOCK_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
 #include "distortos/architecture/InterruptMaskingUnmaskingLock.hpp"
 #include "distortos/architecture/enableInterruptMasking.hpp"
 
@@ -21,12 +23,66 @@ namespace distortos
 namespace architecture
 {
 
+#ifdef CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
+
+/**
+ * \brief InterruptMaskingLock class is a RAII wrapper for enableInterruptMasking() / restoreInterruptMasking()
+ *
+ * Version with profiler of interrupt masking - duration of each section executed with interrupt masking enabled is
+ * measured from the construction of the outermost lock to its destruction (or to the construction of
+ * InterruptUnmaskingLock) and accounted to the place in code which started the section. Results are available with
+ * statistics::getInterruptMaskingStatistics().
+ */
+
+class InterruptMaskingLock
+{
+public:
+
+	/**
+	 * \brief InterruptMaskingLock's constructor
+	 *
+	 * Enables interrupt masking, saving current interrupt mask for use in destructor. If no section is measured,
+	 * measurement of new section is started.
+	 *
+	 * \note The constructor is never inlined - its return address identifies the place in code which started the
+	 * section.
+	 */
+
+	InterruptMaskingLock();
+
+	/**
+	 * \brief InterruptMaskingLock's destructor
+	 *
+	 * If this lock started measurement of current section, the section is accounted. Restores previous interrupt
+	 * masking state by restoring interrupt mask saved in constructor.
+	 */
+
+	~InterruptMaskingLock();
+
+	InterruptMaskingLock(const InterruptMaskingLock&) = delete;
+	InterruptMaskingLock(InterruptMaskingLock&&) = delete;
+	InterruptMaskingLock& operator=(const InterruptMaskingLock&) = delete;
+	InterruptMaskingLock& operator=(InterruptMaskingLock&&) = delete;
+
+private:
+
+	/// interrupt mask
+	const InterruptMask interruptMask_;
+
+	/// true if this lock started measurement of current section, false otherwise
+	const bool sectionStarted_;
+};
+
+#else	// !def CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
+
 /// InterruptMaskingLock class is a RAII wrapper for enableInterruptMasking() / restoreInterruptMasking()
 class InterruptMaskingLock : private InterruptMaskingUnmaskingLock<enableInterruptMasking>
 {
 
 };
 
+#endif	// !def CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
+
 }	// namespace architecture
 
 }	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief InterruptUnmaskingLock class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,6 +12,8 @@
 #ifndef INCLUDE_DISTORTOS_ARCHITECTURE_INTERRUPTUNMASKINGLOCK_HPP_
 #define INCLUDE_DISTORTOS_ARCHITECTURE_INTERRUPTUNMASKINGLOCK_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
 #include "distortos/architecture/InterruptMaskingUnmaskingLock.hpp"
 #include "distortos/architecture/disableInterruptMasking.hpp"
 
@@ -21,12 +23,61 @@ namespace distortos
 namespace architecture
 {
 
+#ifdef CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
+
+/**
+ * \brief InterruptUnmaskingLock class is a RAII wrapper for disableInterruptMasking() / restoreInterruptMasking()
+ *
+ * Version with profiler of interrupt masking - measured section is accounted when interrupt masking is disabled and
+ * measurement of new section is started when it is restored.
+ */
+
+class InterruptUnmaskingLock
+{
+public:
+
+	/**
+	 * \brief InterruptUnmaskingLock's constructor
+	 *
+	 * If a section is measured, it is accounted. Disables interrupt masking, saving current interrupt mask for use in
+	 * destructor.
+	 */
+
+	InterruptUnmaskingLock();
+
+	/**
+	 * \brief InterruptUnmaskingLock's destructor
+	 *
+	 * Restores previous interrupt masking state by restoring interrupt mask saved in constructor. If constructor
+	 * accounted a section, measurement of new section is started.
+	 */
+
+	~InterruptUnmaskingLock();
+
+	InterruptUnmaskingLock(const InterruptUnmaskingLock&) = delete;
+	InterruptUnmaskingLock(InterruptUnmaskingLock&&) = delete;
+	InterruptUnmaskingLock& operator=(const InterruptUnmaskingLock&) = delete;
+	InterruptUnmaskingLock& operator=(InterruptUnmaskingLock&&) = delete;
+
+private:
+
+	/// true if constructor accounted a section, false otherwise
+	const bool sectionEnded_;
+
+	/// interrupt mask
+	const InterruptMask interruptMask_;
+};
+
+#else	// !def CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
+
 /// InterruptUnmaskingLock class is a RAII wrapper for disableInterruptMasking() / restoreInterruptMasking()
 class InterruptUnmaskingLock : private InterruptMaskingUnmaskingLock<disableInterruptMasking>
 {
 
 };
 
+#endif	// !def CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
+
 }	// namespace architecture
 
 }	// namespace distortos
@@ -59,7 +59,8 @@ public:
 	 * This function adopts existing valid architecture-specific stack in provided storage. No adjustments are done,
 	 * no stack frame is created and stack pointer register's value is not calculated.
 	 *
-	 * This is meant to adopt main()'s stack.
+	 * This is meant to adopt main()'s stack. The part of this stack below current stack pointer is painted, so that its
+	 * usage can be measured with getHighWaterMark().
 	 *
 	 * \param [in] storage is a pointer to stack's storage
 	 * \param [in] size is the size of stack's storage, bytes
@@ -73,6 +74,32 @@ public:
 
 	~Stack();
 
+	/**
+	 * \brief Gets high-water mark of stack.
+	 *
+	 * \return max number of bytes of stack used so far, see getStackHighWaterMark() for details
+	 */
+
+	size_t getHighWaterMark() const;
+
+	/**
+	 * \return adjusted size of stack's storage, bytes
+	 */
+
+	size_t getSize() const
+	{
+		return adjustedSize_;
+	}
+
+	/**
+	 * \return adjusted address of stack's storage
+	 */
+
+	void* getStorage() const
+	{
+		return adjustedStorage_;
+	}
+
 	/**
 	 * \brief Gets current value of stack pointer.
 	 *
@@ -0,0 +1,35 @@
+/**
+ * \file
+ * \brief enterDeepSleep() header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_ENTERDEEPSLEEP_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_ENTERDEEPSLEEP_HPP_
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific entry to deep sleep.
+ *
+ * Works like waitForInterrupt(), but the core signals to the chip that deep sleep is requested, so chip-specific
+ * low-power mode (e.g. STOP mode of STM32) may be entered. Selection of this mode and restoration of chip's
+ * configuration after wake-up are not handled by this function.
+ */
+
+void enterDeepSleep();
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_ENTERDEEPSLEEP_HPP_
@@ -0,0 +1,39 @@
+/**
+ * \file
+ * \brief getCycleCount() header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_GETCYCLECOUNT_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_GETCYCLECOUNT_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Gets value of free-running counter of core clock cycles.
+ *
+ * The counter wraps around at 2^32, so only differences between values read less than 2^32 cycles apart are meaningful.
+ *
+ * \attention This function must be called with interrupt masking enabled.
+ *
+ * \return current value of free-running counter of core clock cycles
+ */
+
+uint32_t getCycleCount();
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_GETCYCLECOUNT_HPP_
@@ -0,0 +1,42 @@
+/**
+ * \file
+ * \brief getHighResolutionTickCount() header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_GETHIGHRESOLUTIONTICKCOUNT_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_GETHIGHRESOLUTIONTICKCOUNT_HPP_
+
+#include <utility>
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Gets tick count together with the elapsed part of current tick.
+ *
+ * The elapsed part of current tick is read from the timer which generates tick interrupt. If this interrupt is
+ * already pending, the tick which just ended is included in tick count.
+ *
+ * \note This function may be called from thread and interrupt context.
+ *
+ * \return pair with tick count and the elapsed part of current tick, as a fraction of tick in units of 1 / 2^32
+ */
+
+std::pair<uint64_t, uint32_t> getHighResolutionTickCount();
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_GETHIGHRESOLUTIONTICKCOUNT_HPP_
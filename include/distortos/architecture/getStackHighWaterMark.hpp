@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \brief getStackHighWaterMark() declaration
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_GETSTACKHIGHWATERMARK_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_GETSTACKHIGHWATERMARK_HPP_
+
+#include <cstddef>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Gets high-water mark of stack painted with paintStack().
+ *
+ * Stack grows towards lower addresses, so its unused part is a contiguous range of words equal to stackSentinel at the
+ * beginning of storage. The boundary of this range is found with binary search - O(log n) - which assumes that all
+ * words above the deepest used one were written. A buffer on the stack which was never written may therefore hide
+ * deeper usage.
+ *
+ * \param [in] storage is a pointer to stack's storage, must be aligned to 4
+ * \param [in] size is the size of stack's storage, bytes
+ *
+ * \return max number of bytes of stack used so far
+ */
+
+size_t getStackHighWaterMark(const void* storage, size_t size);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_GETSTACKHIGHWATERMARK_HPP_
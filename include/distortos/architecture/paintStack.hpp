@@ -0,0 +1,39 @@
+/**
+ * \file
+ * \brief paintStack() declaration
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_PAINTSTACK_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_PAINTSTACK_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/// value of each word of stack which was never used
+constexpr uint32_t stackSentinel {0xed419f25};
+
+/**
+ * \brief Paints stack with stackSentinel, so that its usage can be measured with getStackHighWaterMark().
+ *
+ * \param [in] begin is a pointer to beginning of painted range, must be aligned to 4
+ * \param [in] end is a pointer to end of painted range, only whole words before it are painted
+ */
+
+void paintStack(void* begin, const void* end);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_PAINTSTACK_HPP_
@@ -0,0 +1,40 @@
+/**
+ * \file
+ * \brief resumeTickInterrupt() header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_RESUMETICKINTERRUPT_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_RESUMETICKINTERRUPT_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific restoration of periodic tick interrupt after suppressTickInterrupt().
+ *
+ * Tick source is reprogrammed to generate interrupts periodically again, with the phase of tick boundaries preserved.
+ *
+ * \attention This function must be called with interrupt masking enabled.
+ *
+ * \return number of tick boundaries that were crossed since the call to suppressTickInterrupt(), excluding the one for
+ * which tick interrupt is pending (if any) - this value should be added to tick count to keep it exact
+ */
+
+uint64_t resumeTickInterrupt();
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_RESUMETICKINTERRUPT_HPP_
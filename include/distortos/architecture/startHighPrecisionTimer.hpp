@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \brief startHighPrecisionTimer() header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_STARTHIGHPRECISIONTIMER_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_STARTHIGHPRECISIONTIMER_HPP_
+
+#include "distortos/HighResolutionClock.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Starts one-shot high precision timer.
+ *
+ * After \a duration the interrupt of high precision timer calls Scheduler::highPrecisionTimerInterruptHandler(). If
+ * the timer is already running, it is restarted with the new duration. Duration is rounded up to the resolution of
+ * the timer, so the interrupt never comes too early. Durations longer than the range of the timer are truncated - the
+ * interrupt comes earlier, but the handler will start the timer again.
+ *
+ * \note This function must be called with enabled interrupt masking.
+ *
+ * \param [in] duration is the duration after which the interrupt of high precision timer will be generated, 0 to
+ * generate it as soon as possible
+ */
+
+void startHighPrecisionTimer(HighResolutionClock::duration duration);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_STARTHIGHPRECISIONTIMER_HPP_
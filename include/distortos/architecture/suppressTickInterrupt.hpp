@@ -0,0 +1,45 @@
+/**
+ * \file
+ * \brief suppressTickInterrupt() header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_SUPPRESSTICKINTERRUPT_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_SUPPRESSTICKINTERRUPT_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific suppression of periodic tick interrupt.
+ *
+ * Tick source is reprogrammed to generate next interrupt at the tick boundary which is \a ticks ticks in the future -
+ * the next tick boundary is the first one. If this time is too long for the tick source, the interrupt is generated
+ * at the last tick boundary which can be reached. Periodic operation must be restored with resumeTickInterrupt().
+ *
+ * \attention This function must be called with interrupt masking enabled.
+ *
+ * \param [in] ticks is the number of tick boundaries after which the interrupt should be generated, must be greater
+ * than 1
+ *
+ * \return true if tick interrupt was suppressed, false otherwise (e.g. tick interrupt is already pending) - in that
+ * case resumeTickInterrupt() must not be called
+ */
+
+bool suppressTickInterrupt(uint64_t ticks);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_SUPPRESSTICKINTERRUPT_HPP_
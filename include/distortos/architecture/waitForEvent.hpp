@@ -0,0 +1,35 @@
+/**
+ * \file
+ * \brief waitForEvent() header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_WAITFOREVENT_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_WAITFOREVENT_HPP_
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific wait for event.
+ *
+ * Puts the core in low-power state until any event is signaled or any enabled interrupt becomes pending. This function
+ * may be called with interrupt masking enabled - masked interrupts also wake the core, but their handlers are executed
+ * only when interrupt masking is restored. The function may return spuriously.
+ */
+
+void waitForEvent();
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_WAITFOREVENT_HPP_
@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief idleSleepDepthHook() declaration
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_IDLESLEEPDEPTHHOOK_HPP_
+#define INCLUDE_DISTORTOS_IDLESLEEPDEPTHHOOK_HPP_
+
+#include "distortos/SleepDepth.hpp"
+#include "distortos/TickClock.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief Hook function which selects depth of sleep of idle thread.
+ *
+ * This function is called by idle thread each time it is about to put the core to sleep - when there are no other
+ * runnable threads. It may be used to implement application-specific power policy, for example to select deeper sleep
+ * only if the time until next expiration of software timers is long enough to compensate for the wake-up latency.
+ *
+ * \note Use of this function is optional - it may be left undefined, in which case SleepDepth::waitForInterrupt is
+ * used.
+ *
+ * \warning This function is called with interrupt masking enabled, so it should execute quickly and it must not use
+ * any blocking functions.
+ *
+ * \attention SleepDepth::deepSleep is entered with core's SLEEPDEEP bit set - on most chips (e.g. STOP mode of
+ * STM32) this stops system tick timer and clocks of the chip, so time spent in such sleep is not accounted for by
+ * TickClock, an interrupt which can wake the chip must be enabled and chip-specific configuration (e.g. selection of
+ * low-power mode and restoration of clocks after wake-up) must be done by the application.
+ *
+ * \param [in] timeToNextExpiry is the duration until the earliest expiration of software timers,
+ * TickClock::duration::max() if no software timer is active
+ *
+ * \return depth of sleep which will be used by idle thread
+ */
+
+SleepDepth idleSleepDepthHook(TickClock::duration timeToNextExpiry) __attribute__ ((weak));
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_IDLESLEEPDEPTHHOOK_HPP_
@@ -127,7 +127,8 @@ public:
 					parameters.signalActions, parameters.priority, parameters.schedulingPolicy,
 					std::forward<Function>(function), std::forward<Args>(args)...}
 	{
-
+		// out-of-range length of round-robin quantum is clamped, as constructor cannot report an error
+		setRoundRobinQuantum(internal::RoundRobinQuantum::clamp(parameters.roundRobinQuantum));
 	}
 
 #endif	// !def CONFIG_THREAD_DETACH_ENABLE
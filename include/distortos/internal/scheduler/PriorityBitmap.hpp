@@ -0,0 +1,202 @@
+/**
+ * \file
+ * \brief PriorityBitmap class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_PRIORITYBITMAP_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_PRIORITYBITMAP_HPP_
+
+#include <array>
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief PriorityBitmap class is a two-level bitmap with one bit for each of 256 priority levels.
+ *
+ * First level is a single word in which each bit marks non-empty word of the second level. Second level has one bit
+ * for each priority. All operations - including search for highest set bit - execute in constant time, using
+ * "count leading zeros" instruction.
+ */
+
+class PriorityBitmap
+{
+public:
+
+	/**
+	 * \brief PriorityBitmap's constructor
+	 */
+
+	constexpr PriorityBitmap() :
+			words_{},
+			summary_{}
+	{
+
+	}
+
+	/**
+	 * \return true if no bit is set, false otherwise
+	 */
+
+	bool empty() const
+	{
+		return summary_ == 0;
+	}
+
+	/**
+	 * \brief Finds highest priority with set bit.
+	 *
+	 * \return highest priority with set bit, -1 if no bit is set
+	 */
+
+	int findHighest() const
+	{
+		if (summary_ == 0)
+			return -1;
+
+		const auto wordIndex = findHighestBit(summary_);
+		return wordIndex * bitsPerWord + findHighestBit(words_[wordIndex]);
+	}
+
+	/**
+	 * \brief Finds highest priority with set bit that is lower than \a priority.
+	 *
+	 * \param [in] priority is the priority which limits the search, bit for this priority is not considered
+	 *
+	 * \return highest priority with set bit that is lower than \a priority, -1 if no such bit is set
+	 */
+
+	int findHighestBelow(const uint8_t priority) const
+	{
+		const auto wordIndex = priority / bitsPerWord;
+		const auto word = words_[wordIndex] & ((Word{1} << priority % bitsPerWord) - 1);
+		if (word != 0)
+			return wordIndex * bitsPerWord + findHighestBit(word);
+
+		const auto summary = summary_ & ((Word{1} << wordIndex) - 1);
+		if (summary == 0)
+			return -1;
+
+		const auto lowerWordIndex = findHighestBit(summary);
+		return lowerWordIndex * bitsPerWord + findHighestBit(words_[lowerWordIndex]);
+	}
+
+	/**
+	 * \brief Finds lowest priority with set bit that is higher than \a priority.
+	 *
+	 * \param [in] priority is the priority which limits the search, bit for this priority is not considered
+	 *
+	 * \return lowest priority with set bit that is higher than \a priority, -1 if no such bit is set
+	 */
+
+	int findLowestAbove(const uint8_t priority) const
+	{
+		const auto wordIndex = priority / bitsPerWord;
+		const auto word = words_[wordIndex] & (~Word{1} << priority % bitsPerWord);
+		if (word != 0)
+			return wordIndex * bitsPerWord + findLowestBit(word);
+
+		const auto summary = summary_ & (~Word{1} << wordIndex);
+		if (summary == 0)
+			return -1;
+
+		const auto higherWordIndex = findLowestBit(summary);
+		return higherWordIndex * bitsPerWord + findLowestBit(words_[higherWordIndex]);
+	}
+
+	/**
+	 * \brief Clears bit of \a priority.
+	 *
+	 * \param [in] priority is the priority which will be cleared
+	 */
+
+	void reset(const uint8_t priority)
+	{
+		const auto wordIndex = priority / bitsPerWord;
+		words_[wordIndex] &= ~(Word{1} << priority % bitsPerWord);
+		if (words_[wordIndex] == 0)
+			summary_ &= ~(Word{1} << wordIndex);
+	}
+
+	/**
+	 * \brief Sets bit of \a priority.
+	 *
+	 * \param [in] priority is the priority which will be set
+	 */
+
+	void set(const uint8_t priority)
+	{
+		const auto wordIndex = priority / bitsPerWord;
+		words_[wordIndex] |= Word{1} << priority % bitsPerWord;
+		summary_ |= Word{1} << wordIndex;
+	}
+
+	/**
+	 * \param [in] priority is the priority which will be tested
+	 *
+	 * \return true if bit of \a priority is set, false otherwise
+	 */
+
+	bool test(const uint8_t priority) const
+	{
+		return (words_[priority / bitsPerWord] & (Word{1} << priority % bitsPerWord)) != 0;
+	}
+
+private:
+
+	/// type of single word of the bitmap
+	using Word = uint32_t;
+
+	/// number of bits in Word
+	constexpr static int bitsPerWord {sizeof(Word) * 8};
+
+	/// number of words in second level of bitmap
+	constexpr static int words {(UINT8_MAX + 1) / bitsPerWord};
+
+	static_assert(words <= bitsPerWord, "Single summary word is not enough for all words of the bitmap!");
+
+	/**
+	 * \param [in] word is the word which will be searched, must not be 0
+	 *
+	 * \return index of most significant set bit in \a word
+	 */
+
+	constexpr static int findHighestBit(const Word word)
+	{
+		return bitsPerWord - 1 - __builtin_clz(word);
+	}
+
+	/**
+	 * \param [in] word is the word which will be searched, must not be 0
+	 *
+	 * \return index of least significant set bit in \a word
+	 */
+
+	constexpr static int findLowestBit(const Word word)
+	{
+		return __builtin_ctz(word);
+	}
+
+	/// second level of bitmap, each bit represents one priority
+	std::array<Word, words> words_;
+
+	/// first level of bitmap, each bit represents one word of second level that has at least one bit set
+	Word summary_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_PRIORITYBITMAP_HPP_
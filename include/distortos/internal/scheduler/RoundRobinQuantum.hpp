@@ -14,6 +14,8 @@
 
 #include "distortos/TickClock.hpp"
 
+#include <limits>
+
 namespace distortos
 {
 
@@ -26,13 +28,13 @@ class RoundRobinQuantum
 public:
 
 	/// type of quantum counter
-	using Representation = uint8_t;
+	using Representation = uint16_t;
 
 	/// duration type used for quantum
 	using Duration = std::chrono::duration<Representation, TickClock::period>;
 
 	/**
-	 * \return initial value for round-robin quantum
+	 * \return default value for round-robin quantum, derived from CONFIG_ROUND_ROBIN_FREQUENCY
 	 */
 
 	constexpr static Duration getInitial()
@@ -40,14 +42,43 @@ public:
 		return Duration{quantumRawInitializer_};
 	}
 
+	/**
+	 * \return max value for round-robin quantum
+	 */
+
+	constexpr static Duration getMax()
+	{
+		return Duration{std::numeric_limits<Representation>::max()};
+	}
+
+	/**
+	 * \brief Clamps length of round-robin quantum to the range accepted by ThreadCommon::setRoundRobinQuantum().
+	 *
+	 * \param [in] length is the length of round-robin quantum
+	 *
+	 * \return \a length limited to range [0; getMax()]
+	 */
+
+	static TickClock::duration clamp(const TickClock::duration length)
+	{
+		if (length < TickClock::duration{})
+			return TickClock::duration{};
+		if (length > getMax())
+			return getMax();
+		return length;
+	}
+
 	/**
 	 * \brief RoundRobinQuantum's constructor
 	 *
-	 * Initializes quantum value to initial value - just like after call to reset().
+	 * Initializes quantum value to \a length - just like after call to reset().
+	 *
+	 * \param [in] length is the length of round-robin quantum, default - getInitial()
 	 */
 
-	constexpr RoundRobinQuantum() :
-			quantum_{getInitial()}
+	constexpr explicit RoundRobinQuantum(const Duration length = getInitial()) :
+			quantum_{length},
+			length_{length}
 	{
 
 	}
@@ -78,6 +109,15 @@ public:
 		return quantum_;
 	}
 
+	/**
+	 * \return length of round-robin quantum, which is used by reset()
+	 */
+
+	Duration getLength() const
+	{
+		return length_;
+	}
+
 	/**
 	 * \brief Convenience function to test whether the quantum is already at 0.
 	 *
@@ -97,7 +137,23 @@ public:
 
 	void reset()
 	{
-		quantum_ = getInitial();
+		quantum_ = length_;
+	}
+
+	/**
+	 * \brief Sets length of round-robin quantum.
+	 *
+	 * If current value of quantum is greater than new length, it is truncated, so that shortening the quantum takes
+	 * effect immediately.
+	 *
+	 * \param [in] length is the new length of round-robin quantum, must be greater than 0
+	 */
+
+	void setLength(const Duration length)
+	{
+		length_ = length;
+		if (quantum_ > length_)
+			quantum_ = length_;
 	}
 
 private:
@@ -109,11 +165,14 @@ private:
 	constexpr static auto quantumRawInitializer_ = (CONFIG_TICK_FREQUENCY + CONFIG_ROUND_ROBIN_FREQUENCY / 2) /
 			CONFIG_ROUND_ROBIN_FREQUENCY;
 
-	static_assert(quantumRawInitializer_ > 0 || quantumRawInitializer_ <= UINT8_MAX,
+	static_assert(quantumRawInitializer_ > 0 && quantumRawInitializer_ <= std::numeric_limits<Representation>::max(),
 			"CONFIG_TICK_FREQUENCY and CONFIG_ROUND_ROBIN_FREQUENCY values produce invalid round-robin quantum!");
 
 	/// round-robin quantum
 	Duration quantum_;
+
+	/// length of round-robin quantum
+	Duration length_;
 };
 
 }	// namespace internal
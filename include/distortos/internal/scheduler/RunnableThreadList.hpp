@@ -0,0 +1,174 @@
+/**
+ * \file
+ * \brief RunnableThreadList class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RUNNABLETHREADLIST_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RUNNABLETHREADLIST_HPP_
+
+#include "distortos/internal/scheduler/PriorityBitmap.hpp"
+#include "distortos/internal/scheduler/ThreadList.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief RunnableThreadList class is a ThreadList with constant-time insertion and removal of elements.
+ *
+ * Elements are kept in exactly the same order as in ThreadList - sorted by effective priority in descending order,
+ * with FIFO order among threads with the same effective priority - so the highest-priority runnable thread is always
+ * the first element. Each non-empty priority level is a contiguous group of elements on the list. First element of
+ * each group is remembered in an array indexed with priority and the set of non-empty groups is tracked with
+ * PriorityBitmap, so insert position can be found without traversing the list.
+ *
+ * Threads with SchedulingPolicy::earliestDeadlineFirst are kept at the beginning of their group, sorted by absolute
+ * deadline in ascending order (with FIFO order among threads with the same deadline) - insertion of such threads
+ * traverses only these elements of their own group.
+ *
+ * ThreadList is a private base, so elements can be added, removed and moved only with the functions of this class -
+ * using functions of ThreadList directly would corrupt the index.
+ */
+
+class RunnableThreadList : private ThreadList
+{
+public:
+
+	using ThreadList::const_iterator;
+	using ThreadList::iterator;
+	using ThreadList::reference;
+	using ThreadList::begin;
+	using ThreadList::cbegin;
+	using ThreadList::cend;
+	using ThreadList::empty;
+	using ThreadList::end;
+
+	/**
+	 * \brief RunnableThreadList's constructor
+	 */
+
+	constexpr RunnableThreadList() :
+			ThreadList{},
+			groupHeads_{},
+			priorityBitmap_{}
+	{
+
+	}
+
+	/**
+	 * \brief Unlinks the element from the list.
+	 *
+	 * \param [in] position is an iterator of the element that will be unlinked from the list
+	 */
+
+	void erase(iterator position);
+
+	/**
+	 * \brief Gets the list as ThreadList.
+	 *
+	 * \attention Returned pointer may be used only to identify the list (with ThreadControlBlock::setList() and
+	 * ThreadControlBlock::getList()), it must not be used to modify the list.
+	 *
+	 * \return pointer to this list as ThreadList
+	 */
+
+	ThreadList* getThreadList()
+	{
+		return this;
+	}
+
+	/**
+	 * \brief Gets the list as ThreadList.
+	 *
+	 * \return pointer to this list as ThreadList, which may be used only to identify the list
+	 */
+
+	const ThreadList* getThreadList() const
+	{
+		return this;
+	}
+
+	/**
+	 * \brief Links the element at the end of the group of elements with the same effective priority.
+	 *
+	 * \param [in] newElement is a reference to the element that will be linked in the list
+	 *
+	 * \return iterator of \a newElement
+	 */
+
+	iterator insert(reference newElement)
+	{
+		return insertInternal(newElement, false);
+	}
+
+	/**
+	 * \brief Moves the element after change of its effective priority.
+	 *
+	 * \param [in] position is an iterator of the element that will be moved, it must be on this list
+	 * \param [in] previousEffectivePriority is the effective priority of the element before the change
+	 * \param [in] front selects the position in the group of elements with new effective priority:
+	 * - false - the element is moved to the end of the group,
+	 * - true - the element is moved to the beginning of the group (but after threads with
+	 * SchedulingPolicy::earliestDeadlineFirst).
+	 */
+
+	void reposition(iterator position, uint8_t previousEffectivePriority, bool front);
+
+	/**
+	 * \brief Transfers the element to the end of the group of elements with the same effective priority.
+	 *
+	 * The element may be on another list or on this list - in the latter case the element is moved to the end of its
+	 * group, which can be used to implement round-robin scheduling.
+	 *
+	 * \param [in] splicedElement is an iterator of the element that will be spliced
+	 */
+
+	void splice(iterator splicedElement);
+
+private:
+
+	/**
+	 * \brief Unlinks the element from the list.
+	 *
+	 * \param [in] position is an iterator of the element that will be unlinked from the list
+	 * \param [in] priority is the effective priority of the group in which the element is linked
+	 */
+
+	void eraseInternal(iterator position, uint8_t priority);
+
+	/**
+	 * \brief Links the element in the group of elements with the same effective priority.
+	 *
+	 * \param [in] newElement is a reference to the element that will be linked in the list
+	 * \param [in] front selects the position in the group:
+	 * - false - the element is linked at the end of the group,
+	 * - true - the element is linked at the beginning of the group (but after threads with
+	 * SchedulingPolicy::earliestDeadlineFirst).
+	 *
+	 * Elements with SchedulingPolicy::earliestDeadlineFirst are always linked according to their deadline.
+	 *
+	 * \return iterator of \a newElement
+	 */
+
+	iterator insertInternal(reference newElement, bool front);
+
+	/// array with iterators of first elements of groups, valid only for priorities set in priorityBitmap_
+	std::array<iterator, UINT8_MAX + 1> groupHeads_;
+
+	/// bitmap of non-empty groups
+	PriorityBitmap priorityBitmap_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RUNNABLETHREADLIST_HPP_
@@ -12,10 +12,16 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SCHEDULER_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SCHEDULER_HPP_
 
+#include "distortos/internal/scheduler/RunnableThreadList.hpp"
 #include "distortos/internal/scheduler/ThreadControlBlock.hpp"
-#include "distortos/internal/scheduler/ThreadList.hpp"
 #include "distortos/internal/scheduler/SoftwareTimerSupervisor.hpp"
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+#include "distortos/HighResolutionClock.hpp"
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 namespace distortos
 {
 
@@ -29,17 +35,28 @@ class Scheduler
 {
 public:
 
+	/// intrusive list of all started threads (thread control blocks)
+	using AllThreadsList = estd::IntrusiveList<ThreadListNode, &ThreadListNode::allThreadsNode, ThreadControlBlock>;
+
 	/**
 	 * \brief Scheduler's constructor
 	 */
 
 	constexpr Scheduler() :
 			currentThreadControlBlock_{},
+			allThreadsList_{},
 			runnableList_{},
 			suspendedList_{},
 			softwareTimerSupervisor_{},
+			idleThreadControlBlock_{},
+			budgetOverrunCount_{},
 			contextSwitchCount_{},
-			tickCount_{}
+			idleTickCount_{},
+			tickCount_{},
+			tickInterruptCpuTime_{},
+			totalCpuTime_{},
+			cpuTimeStamp_{},
+			tickCountSequence_{}
 	{
 
 	}
@@ -112,12 +129,56 @@ public:
 	int blockUntil(ThreadList& container, ThreadState state, TickClock::time_point timePoint,
 			const ThreadControlBlock::UnblockFunctor* unblockFunctor = {});
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	/**
+	 * \brief Blocks current thread with sub-tick precision timeout, transferring it to provided container.
+	 *
+	 * \param [in] container is a reference to destination container to which the thread will be transferred
+	 * \param [in] state is the new state of thread that will be blocked
+	 * \param [in] timePoint is the time point at which the thread will be unblocked (if not already unblocked)
+	 * \param [in] unblockFunctor is a pointer to ThreadControlBlock::UnblockFunctor which will be executed in
+	 * ThreadControlBlock::unblockHook(), default - nullptr (no functor will be executed)
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINTR - thread was unblocked with ThreadControlBlock::UnblockReason::signal;
+	 * - ETIMEDOUT - thread was unblocked because timePoint was reached;
+	 */
+
+	int blockUntil(ThreadList& container, ThreadState state, HighResolutionClock::time_point timePoint,
+			const ThreadControlBlock::UnblockFunctor* unblockFunctor = {});
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	/**
+	 * \return number of replenishment periods in which any thread group used its CPU budget and was throttled
+	 */
+
+	uint64_t getBudgetOverrunCount() const;
+
+	/**
+	 * \return reference to list of all started threads, which were not destroyed yet
+	 */
+
+	AllThreadsList& getAllThreadsList()
+	{
+		return allThreadsList_;
+	}
+
 	/**
 	 * \return number of context switches
 	 */
 
 	uint64_t getContextSwitchCount() const;
 
+	/**
+	 * \param [in] threadControlBlock is a reference to ThreadControlBlock of thread which will be queried
+	 *
+	 * \return CPU time used by thread, core clock cycles
+	 */
+
+	uint64_t getCpuTime(const ThreadControlBlock& threadControlBlock);
+
 	/**
 	 * \return reference to currently active ThreadControlBlock
 	 */
@@ -127,6 +188,18 @@ public:
 		return *currentThreadControlBlock_;
 	}
 
+	/**
+	 * \return number of ticks during which idle thread was running
+	 */
+
+	uint64_t getIdleTickCount() const;
+
+	/**
+	 * \return CPU time used by idle thread, core clock cycles
+	 */
+
+	uint64_t getIdleCpuTime();
+
 	/**
 	 * \return reference to internal SoftwareTimerSupervisor object
 	 */
@@ -146,11 +219,43 @@ public:
 	}
 
 	/**
+	 * \brief Gets current value of tick count.
+	 *
+	 * This function doesn't use interrupt masking. Tick count is modified only with interrupt masking enabled, so
+	 * the modification is never seen "in progress" by this function - if sequence counter did not change during the
+	 * read, the value is consistent, otherwise the read is repeated.
+	 *
 	 * \return current value of tick count
 	 */
 
 	uint64_t getTickCount() const;
 
+	/**
+	 * \return CPU time used by tick interrupt handler, core clock cycles
+	 */
+
+	uint64_t getTickInterruptCpuTime() const;
+
+	/**
+	 * \return total CPU time since start of scheduling, core clock cycles
+	 */
+
+	uint64_t getTotalCpuTime();
+
+	/**
+	 * \brief Puts the core to sleep if there's nothing else to do.
+	 *
+	 * If the current thread is the only runnable thread, depth of sleep is selected with idleSleepDepthHook() (if it is
+	 * defined) using the time until the earliest expiration of active software timers. If tickless idle is enabled,
+	 * tick interrupt is additionally suppressed until that expiration and after wake-up all ticks that elapsed are
+	 * added to tick count in one step, so TickClock stays monotonic and exact. If there are other runnable threads with
+	 * the same priority, the current thread yields to them.
+	 *
+	 * \attention This function should be called only by idleThreadFunction().
+	 */
+
+	void idle();
+
 	/**
 	 * \brief Scheduler's initialization
 	 *
@@ -158,12 +263,14 @@ public:
 	 * be higher than priority of idle thread
 	 *
 	 * \param [in] mainThread is a reference to main thread
+	 * \param [in] idleThreadControlBlock is a reference to ThreadControlBlock of idle thread, it is used only to count
+	 * ticks during which idle thread was running
 	 *
 	 * \return 0 on success, error code otherwise:
 	 * - error codes returned by Scheduler::addInternal();
 	 */
 
-	int initialize(MainThread& mainThread);
+	int initialize(MainThread& mainThread, const ThreadControlBlock& idleThreadControlBlock);
 
 	/**
 	 * \brief Requests context switch if it is needed.
@@ -188,6 +295,37 @@ public:
 
 	int remove();
 
+	/**
+	 * \brief Repositions runnable thread after change of its effective priority.
+	 *
+	 * \attention This function should be called only by ThreadControlBlock::reposition().
+	 *
+	 * \param [in] iterator is the iterator to the thread that will be repositioned, it must be on "runnable" list
+	 * \param [in] previousEffectivePriority is the effective priority of the thread before the change
+	 * \param [in] loweringBefore selects the method of ordering when lowering the priority (it must be false when the
+	 * priority is raised!):
+	 * - true - the thread is moved to the head of the group of threads with the new priority,
+	 * - false - the thread is moved to the tail of the group of threads with the new priority.
+	 */
+
+	void reposition(ThreadList::iterator iterator, uint8_t previousEffectivePriority, bool loweringBefore);
+
+	/**
+	 * \brief Transfers all threads from one "blocked" container to another one, without unblocking them.
+	 *
+	 * Threads are spliced one by one from the beginning of \a sourceContainer, so the order of threads with the same
+	 * effective priority is preserved. Unblock functors and timeouts of transferred threads are kept.
+	 *
+	 * \note This function must be called with masked interrupts.
+	 *
+	 * \param [in] sourceContainer is a reference to container from which all threads will be transferred
+	 * \param [in] destinationContainer is a reference to destination container to which the threads will be
+	 * transferred
+	 * \param [in] state is the new state of transferred threads
+	 */
+
+	void requeue(ThreadList& sourceContainer, ThreadList& destinationContainer, ThreadState state);
+
 	/**
 	 * \brief Resumes suspended thread.
 	 *
@@ -236,6 +374,20 @@ public:
 
 	void* switchContext(void* stackPointer);
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	/**
+	 * \brief Handler of interrupt of high precision timer.
+	 *
+	 * \note this must not be called by user code
+	 *
+	 * \return true if context switch is required, false otherwise
+	 */
+
+	bool highPrecisionTimerInterruptHandler();
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 	/**
 	 * \brief Handler of "tick" interrupt.
 	 *
@@ -259,6 +411,19 @@ public:
 	void unblock(ThreadList::iterator iterator,
 			ThreadControlBlock::UnblockReason unblockReason = ThreadControlBlock::UnblockReason::unblockRequest);
 
+	/**
+	 * \brief Unblocks all threads from provided container, transferring them to "runnable" container.
+	 *
+	 * All threads are unblocked in a single pass and the need for context switch is evaluated only once.
+	 *
+	 * \param [in] container is a reference to container from which all threads will be unblocked
+	 * \param [in] unblockReason is the reason of unblocking of the threads, default -
+	 * ThreadControlBlock::UnblockReason::unblockRequest
+	 */
+
+	void unblockAll(ThreadList& container,
+			ThreadControlBlock::UnblockReason unblockReason = ThreadControlBlock::UnblockReason::unblockRequest);
+
 	/**
 	 * \brief Yields time slot of the scheduler to next thread.
 	 */
@@ -298,6 +463,28 @@ private:
 	int blockInternal(ThreadList& container, ThreadList::iterator iterator, ThreadState state,
 			const ThreadControlBlock::UnblockFunctor* unblockFunctor);
 
+	/**
+	 * \brief Blocks current thread with timeout, transferring it to provided container.
+	 *
+	 * \note Internal version - common for all clocks
+	 *
+	 * \tparam TimePoint is the type of time point, std::chrono::time_point of TickClock or HighResolutionClock
+	 *
+	 * \param [in] container is a reference to destination container to which the thread will be transferred
+	 * \param [in] state is the new state of thread that will be blocked
+	 * \param [in] timePoint is the time point at which the thread will be unblocked (if not already unblocked)
+	 * \param [in] unblockFunctor is a pointer to ThreadControlBlock::UnblockFunctor which will be executed in
+	 * ThreadControlBlock::unblockHook()
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINTR - thread was unblocked with ThreadControlBlock::UnblockReason::signal;
+	 * - ETIMEDOUT - thread was unblocked because timePoint was reached;
+	 */
+
+	template<typename TimePoint>
+	int blockUntilInternal(ThreadList& container, ThreadState state, TimePoint timePoint,
+			const ThreadControlBlock::UnblockFunctor* unblockFunctor);
+
 	/**
 	 * \brief Tests whether context switch is required or not.
 	 *
@@ -325,11 +512,36 @@ private:
 
 	void unblockInternal(ThreadList::iterator iterator, ThreadControlBlock::UnblockReason unblockReason);
 
+	/**
+	 * \brief Adds CPU time used by current thread since last update.
+	 *
+	 * \attention This function must be called with interrupt masking enabled.
+	 */
+
+	void updateCpuTime()
+	{
+		getCurrentThreadControlBlock().addCpuTime(updateCpuTimeStamp());
+	}
+
+	/**
+	 * \brief Updates time stamp used for accounting of CPU time.
+	 *
+	 * \attention This function must be called with interrupt masking enabled.
+	 *
+	 * \return number of core clock cycles since previous update, already added to total CPU time
+	 */
+
+	uint32_t updateCpuTimeStamp();
+
 	/// iterator to the currently active ThreadControlBlock
 	ThreadList::iterator currentThreadControlBlock_;
 
-	/// list of ThreadControlBlock elements in "runnable" state, sorted by priority in descending order
-	ThreadList runnableList_;
+	/// list of all started threads, which were not destroyed yet
+	AllThreadsList allThreadsList_;
+
+	/// list of ThreadControlBlock elements in "runnable" state, sorted by priority in descending order, with
+	/// constant-time insertion and removal
+	RunnableThreadList runnableList_;
 
 	/// list of ThreadControlBlock elements in "suspended" state, sorted by priority in descending order
 	ThreadList suspendedList_;
@@ -337,11 +549,32 @@ private:
 	/// internal SoftwareTimerSupervisor object
 	SoftwareTimerSupervisor softwareTimerSupervisor_;
 
+	/// pointer to ThreadControlBlock of idle thread
+	const ThreadControlBlock* idleThreadControlBlock_;
+
+	/// number of replenishment periods in which any thread group used its CPU budget and was throttled
+	uint64_t budgetOverrunCount_;
+
 	/// number of context switches
 	uint64_t contextSwitchCount_;
 
+	/// number of ticks during which idle thread was running
+	uint64_t idleTickCount_;
+
 	/// tick count
 	uint64_t tickCount_;
+
+	/// CPU time used by tick interrupt handler, core clock cycles
+	uint64_t tickInterruptCpuTime_;
+
+	/// total CPU time since start of scheduling, core clock cycles
+	uint64_t totalCpuTime_;
+
+	/// value of architecture::getCycleCount() at last update of CPU time
+	uint32_t cpuTimeStamp_;
+
+	/// sequence counter incremented with each modification of tickCount_
+	uint32_t tickCountSequence_;
 };
 
 }	// namespace internal
@@ -12,8 +12,16 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERCONTROLBLOCK_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERCONTROLBLOCK_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
 #include "distortos/internal/scheduler/SoftwareTimerListNode.hpp"
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+#include "distortos/HighResolutionClock.hpp"
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 namespace distortos
 {
 
@@ -42,8 +50,13 @@ public:
 	constexpr SoftwareTimerControlBlock(FunctionRunner& functionRunner, SoftwareTimer& owner) :
 			SoftwareTimerListNode{},
 			period_{},
+			slack_{},
+			appliedSlack_{},
 			functionRunner_{functionRunner},
 			owner_{owner}
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+			, interruptContext_{}
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
 	{
 
 	}
@@ -51,15 +64,39 @@ public:
 	/**
 	 * \brief SoftwareTimerControlBlock's destructor
 	 *
-	 * If the timer is running it is stopped.
+	 * If the timer is running it is stopped. If software timer thread is currently executing timer's function, the
+	 * destructor waits until this execution ends.
+	 */
+
+	~SoftwareTimerControlBlock();
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/**
+	 * \return true if software timer's function is executed in interrupt context, false if it is executed in software
+	 * timer thread
+	 */
+
+	bool getInterruptContext() const
+	{
+		return interruptContext_;
+	}
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/**
+	 * \return slack of software timer
 	 */
 
-	~SoftwareTimerControlBlock()
+	TickClock::duration getSlack() const
 	{
-		stop();
+		return slack_;
 	}
 
 	/**
+	 * \note Expired software timer waiting for execution in software timer thread is still running - stop() prevents
+	 * execution of its function.
+	 *
 	 * \return true if the timer is running, false otherwise
 	 */
 
@@ -71,13 +108,38 @@ public:
 	/**
 	 * \brief Runs software timer's function.
 	 *
-	 * \note this should only be called by SoftwareTimerSupervisor::tickInterruptHandler()
+	 * \note this should only be called by SoftwareTimerSupervisor::tickInterruptHandler() or by
+	 * SoftwareTimerSupervisor::runPendingSoftwareTimers()
 	 *
 	 * \param [in] supervisor is a reference to SoftwareTimerSupervisor that manages this object
 	 */
 
 	void run(SoftwareTimerSupervisor& supervisor);
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/**
+	 * \param [in] interruptContext selects whether software timer's function is executed in interrupt context (true)
+	 * or in software timer thread (false)
+	 */
+
+	void setInterruptContext(const bool interruptContext)
+	{
+		interruptContext_ = interruptContext;
+	}
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/**
+	 * \param [in] slack is the slack of software timer - maximal delay of execution that may be used to coalesce its
+	 * expiration with expirations of other software timers, 0 to disable coalescing; used when the timer is started
+	 */
+
+	void setSlack(const TickClock::duration slack)
+	{
+		slack_ = slack;
+	}
+
 	/**
 	 * \brief Starts the timer.
 	 *
@@ -88,6 +150,21 @@ public:
 
 	void start(SoftwareTimerSupervisor& supervisor, TickClock::time_point timePoint, TickClock::duration period);
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	/**
+	 * \brief Starts the timer as one-shot software timer with sub-tick precision.
+	 *
+	 * Slack of software timer is not used.
+	 *
+	 * \param [in] supervisor is a reference to SoftwareTimerSupervisor to which this object will be added
+	 * \param [in] timePoint is the time point at which the function will be executed
+	 */
+
+	void start(SoftwareTimerSupervisor& supervisor, HighResolutionClock::time_point timePoint);
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 	/**
 	 * \brief Stops the timer.
 	 */
@@ -105,8 +182,12 @@ private:
 	 * \brief Starts the timer - internal version, with no interrupt masking, no stopping and no configuration of
 	 * period.
 	 *
+	 * If slack is not 0, the time point of execution is delayed (by not more than the slack) to the "coarsest" time
+	 * point in the allowed window - the one with the most trailing zero bits in tick count. Software timers with
+	 * overlapping windows are therefore likely to expire in the same tick.
+	 *
 	 * \param [in] supervisor is a reference to SoftwareTimerSupervisor to which this object will be added
-	 * \param [in] timePoint is the time point at which the function will be executed
+	 * \param [in] timePoint is the time point at which the function should be executed
 	 */
 
 	void startInternal(SoftwareTimerSupervisor& supervisor, TickClock::time_point timePoint);
@@ -120,11 +201,25 @@ private:
 	/// period used to restart repetitive software timer, 0 for one-shot software timers
 	TickClock::duration period_;
 
+	/// slack of software timer, 0 if coalescing is disabled
+	TickClock::duration slack_;
+
+	/// delay added to time point of execution due to slack
+	TickClock::duration appliedSlack_;
+
 	/// reference to runner for software timer's function
 	FunctionRunner& functionRunner_;
 
 	/// reference to SoftwareTimer object that owns this SoftwareTimerControlBlock
 	SoftwareTimer& owner_;
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/// true if software timer's function is executed in interrupt context, false if it is executed in software timer
+	/// thread
+	bool interruptContext_;
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
 };
 
 }	// namespace internal
@@ -51,10 +51,51 @@ struct SoftwareTimerAscendingTimePoint
 	}
 };
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+/// functor which gives ascending expiration time point order (including sub-tick offset) of elements on the list
+struct SoftwareTimerAscendingPreciseTimePoint
+{
+	/**
+	 * \brief SoftwareTimerAscendingPreciseTimePoint's constructor
+	 */
+
+	constexpr SoftwareTimerAscendingPreciseTimePoint()
+	{
+
+	}
+
+	/**
+	 * \brief SoftwareTimerAscendingPreciseTimePoint's function call operator
+	 *
+	 * \param [in] left is the object on the left side of comparison
+	 * \param [in] right is the object on the right side of comparison
+	 *
+	 * \return true if left's expiration time point (including sub-tick offset) is greater than right's expiration
+	 * time point (including sub-tick offset)
+	 */
+
+	bool operator()(const SoftwareTimerListNode& left, const SoftwareTimerListNode& right) const
+	{
+		return left.getTimePoint() > right.getTimePoint() || (left.getTimePoint() == right.getTimePoint() &&
+				left.getSubTickOffset() > right.getSubTickOffset());
+	}
+};
+
+/// sorted intrusive list of software timers (software timer control blocks) with sub-tick expiration time points
+using PreciseSoftwareTimerList = estd::SortedIntrusiveList<SoftwareTimerAscendingPreciseTimePoint,
+		SoftwareTimerListNode, &SoftwareTimerListNode::node, SoftwareTimerControlBlock>;
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 /// sorted intrusive list of software timers (software timer control blocks)
 using SoftwareTimerList = estd::SortedIntrusiveList<SoftwareTimerAscendingTimePoint, SoftwareTimerListNode,
 		&SoftwareTimerListNode::node, SoftwareTimerControlBlock>;
 
+/// unsorted intrusive list of software timers (software timer control blocks)
+using UnsortedSoftwareTimerList = estd::IntrusiveList<SoftwareTimerListNode, &SoftwareTimerListNode::node,
+		SoftwareTimerControlBlock>;
+
 }	// namespace internal
 
 }	// namespace distortos
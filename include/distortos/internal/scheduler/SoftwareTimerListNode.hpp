@@ -40,6 +40,9 @@ public:
 	constexpr SoftwareTimerListNode() :
 			node{},
 			timePoint_{}
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+			, subTickOffset_{}
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
 	{
 
 	}
@@ -53,6 +56,20 @@ public:
 		return timePoint_;
 	}
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	/**
+	 * \return offset of expiration from the beginning of tick of expiration time point, HighResolutionClock's ticks
+	 * (nanoseconds), 0 if expiration time point has tick resolution
+	 */
+
+	uint32_t getSubTickOffset() const
+	{
+		return subTickOffset_;
+	}
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 	/// node for intrusive list
 	estd::IntrusiveListNode node;
 
@@ -69,10 +86,33 @@ protected:
 		timePoint_ = timePoint;
 	}
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	/**
+	 * \brief Sets offset of expiration from the beginning of tick of expiration time point
+	 *
+	 * \param [in] subTickOffset is the new offset of expiration, HighResolutionClock's ticks (nanoseconds)
+	 */
+
+	void setSubTickOffset(const uint32_t subTickOffset)
+	{
+		subTickOffset_ = subTickOffset;
+	}
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 private:
 
 	///time point of expiration
 	TickClock::time_point timePoint_;
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	/// offset of expiration from the beginning of tick of expiration time point, HighResolutionClock's ticks
+	/// (nanoseconds)
+	uint32_t subTickOffset_;
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
 };
 
 }	// namespace internal
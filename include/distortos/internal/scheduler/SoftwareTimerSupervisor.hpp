@@ -12,8 +12,33 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERSUPERVISOR_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERSUPERVISOR_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
+
+#include "distortos/internal/scheduler/SoftwareTimerWheel.hpp"
+
+#else	// !def CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
+
+#include "distortos/internal/scheduler/SoftwareTimerList.hpp"
+
+#endif	// !def CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+#include "distortos/Mutex.hpp"
+#include "distortos/Semaphore.hpp"
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 #include "distortos/internal/scheduler/SoftwareTimerList.hpp"
 
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+#include <utility>
+
 namespace distortos
 {
 
@@ -30,7 +55,20 @@ public:
 	 */
 
 	constexpr SoftwareTimerSupervisor() :
+#ifdef CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
+			activeWheel_{}
+#else	// !def CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
 			activeList_{}
+#endif	// !def CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+			, pendingList_{},
+			pendingSemaphore_{0, 1},
+			executionMutex_{Mutex::Type::errorChecking, Mutex::Protocol::priorityInheritance},
+			executingSoftwareTimer_{}
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+			, preciseList_{}
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
 	{
 
 	}
@@ -43,9 +81,57 @@ public:
 
 	void add(SoftwareTimerControlBlock& softwareTimerControlBlock);
 
+	/**
+	 * \brief Gets time point of the earliest expiration of active software timers.
+	 *
+	 * \note this function must be called with enabled interrupt masking
+	 *
+	 * \return pair with bool and time point; bool is true if there is at least one active software timer, false
+	 * otherwise - in that case time point is not valid
+	 */
+
+	std::pair<bool, TickClock::time_point> getNextTimePoint() const;
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	/**
+	 * \brief Handler of interrupt of high precision timer.
+	 *
+	 * Software timers with sub-tick expiration time points which were reached are handled just like in
+	 * tickInterruptHandler() and high precision timer is started again for the earliest of the remaining ones.
+	 *
+	 * \note this must not be called by user code
+	 */
+
+	void highPrecisionTimerInterruptHandler();
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/**
+	 * \brief Executes functions of expired software timers which were passed to software timer thread.
+	 *
+	 * Waits until tickInterruptHandler() moves expired software timers to the list of pending software timers and
+	 * executes their functions in thread context. This function never returns.
+	 *
+	 * \attention This function should be called only by softwareTimerThreadFunction().
+	 */
+
+	void runPendingSoftwareTimers();
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 	/**
 	 * \brief Handler of "tick" interrupt.
 	 *
+	 * Functions of expired software timers are executed immediately, unless software timer thread is enabled - then
+	 * only software timers which must run in interrupt context are executed immediately and other software timers are
+	 * moved to the list of pending software timers, which is handled by runPendingSoftwareTimers().
+	 *
+	 * If high precision timer is enabled, software timers with sub-tick expiration time points in current tick are
+	 * moved to the list of software timers handled by high precision timer.
+	 *
 	 * \note this must not be called by user code
 	 *
 	 * \param [in] timePoint is the current time point
@@ -53,10 +139,96 @@ public:
 
 	void tickInterruptHandler(TickClock::time_point timePoint);
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/**
+	 * \brief Waits until software timer thread finishes execution of function of software timer.
+	 *
+	 * Returns immediately if function of software timer is not executed by software timer thread or if this function
+	 * is called by software timer's function itself.
+	 *
+	 * \attention This function must not be called from interrupt context for software timer executed by software timer
+	 * thread.
+	 *
+	 * \param [in] softwareTimer is a reference to software timer
+	 */
+
+	void waitForExecution(const SoftwareTimerControlBlock& softwareTimer);
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 private:
 
+	/**
+	 * \brief Handles expired software timer.
+	 *
+	 * Executes software timer's function or - if software timer thread is enabled and the function should not be
+	 * executed in interrupt context - passes the software timer to software timer thread.
+	 *
+	 * \param [in] softwareTimer is a reference to expired software timer, already removed from active software timers
+	 */
+
+	void expire(SoftwareTimerControlBlock& softwareTimer);
+
+	/**
+	 * \brief Handles software timer which reached its time point in "tick" interrupt.
+	 *
+	 * If high precision timer is enabled and the software timer has sub-tick expiration time point in current tick, it
+	 * is moved to preciseList_, otherwise expire() is called.
+	 *
+	 * \param [in] softwareTimer is a reference to software timer, already removed from active software timers
+	 * \param [in] timePoint is the current time point
+	 */
+
+	void expireOrDefer(SoftwareTimerControlBlock& softwareTimer, TickClock::time_point timePoint);
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	/**
+	 * \brief Starts high precision timer for the earliest software timer from preciseList_.
+	 *
+	 * If preciseList_ is empty, high precision timer is not started - its potential interrupt will have no effect.
+	 */
+
+	void startHighPrecisionTimer() const;
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+#ifdef CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
+
+	/// hierarchical timing wheel of active software timers (waiting for execution)
+	SoftwareTimerWheel activeWheel_;
+
+#else	// !def CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
+
 	/// list of active software timers (waiting for execution)
 	SoftwareTimerList activeList_;
+
+#endif	// !def CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/// list of expired software timers waiting for execution in software timer thread, in order of expiration
+	UnsortedSoftwareTimerList pendingList_;
+
+	/// semaphore used to wake software timer thread when pendingList_ stops being empty
+	Semaphore pendingSemaphore_;
+
+	/// mutex locked by software timer thread while it executes functions of pending software timers
+	Mutex executionMutex_;
+
+	/// pointer to software timer which is executed by software timer thread, nullptr if none
+	const SoftwareTimerControlBlock* executingSoftwareTimer_;
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	/// list of software timers with sub-tick expiration time points in current (or past) tick, handled by high
+	/// precision timer
+	PreciseSoftwareTimerList preciseList_;
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
 };
 
 }	// namespace internal
@@ -0,0 +1,131 @@
+/**
+ * \file
+ * \brief SoftwareTimerWheel class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERWHEEL_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERWHEEL_HPP_
+
+#include "distortos/internal/scheduler/SoftwareTimerList.hpp"
+
+#include <array>
+#include <utility>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief SoftwareTimerWheel class is a hierarchical timing wheel of software timers (software timer control blocks)
+ *
+ * The wheel has several levels of slots, each slot is an unsorted list of software timers. Slots are indexed with
+ * consecutive groups of bits of absolute expiration tick - a software timer is linked in the lowest level at which its
+ * expiration tick differs from the tick being processed only in the bits of this level and lower levels. Level 0 has
+ * one slot per tick, so all software timers in one slot of this level expire in the same tick. When processing crosses
+ * a boundary of a slot of higher level, software timers from that slot are redistributed to lower levels ("cascade").
+ * Software timers expiring beyond the range of all levels are kept on an overflow list, which is redistributed when
+ * processing crosses the boundary of the whole wheel.
+ *
+ * Insertion is done in constant time and removal is done in constant time by unlinking the software timer from its
+ * list (SoftwareTimerControlBlock::stop()). Each software timer is cascaded at most once per level, so the processing
+ * of expirations takes amortized constant time per software timer.
+ *
+ * Software timers which expire in the same tick are executed in the order of insertion, software timers with
+ * expiration time point in the past are executed in the nearest processed tick.
+ */
+
+class SoftwareTimerWheel
+{
+public:
+
+	/// number of bits of expiration tick used to index slots of one level
+	constexpr static uint8_t levelBits {5};
+
+	/// number of slots in one level
+	constexpr static size_t slotsPerLevel {1 << levelBits};
+
+	/// number of levels
+	constexpr static uint8_t levels {4};
+
+	/**
+	 * \brief SoftwareTimerWheel's constructor
+	 */
+
+	constexpr SoftwareTimerWheel() :
+			slots_(),
+			overflowList_{},
+			nextTick_{}
+	{
+
+	}
+
+	/**
+	 * \brief Gets next expired software timer.
+	 *
+	 * Advances processing of the wheel up to \a timePoint (including it) and unlinks the first software timer which
+	 * expired in that period.
+	 *
+	 * \param [in] timePoint is the current time point
+	 *
+	 * \return pointer to unlinked expired software timer, nullptr if there are no more software timers which expired
+	 * up to \a timePoint
+	 */
+
+	SoftwareTimerControlBlock* getExpired(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Gets time point of the earliest expiration of software timers in the wheel.
+	 *
+	 * \note Complexity of this function is linear in the number of slots and in the number of software timers in the
+	 * first non-empty slot of the lowest non-empty level above level 0.
+	 *
+	 * \return pair with bool and time point; bool is true if there is at least one software timer in the wheel, false
+	 * otherwise - in that case time point is not valid
+	 */
+
+	std::pair<bool, TickClock::time_point> getNextTimePoint() const;
+
+	/**
+	 * \brief Links software timer in the wheel.
+	 *
+	 * \param [in] softwareTimerControlBlock is a reference to software timer that will be linked
+	 */
+
+	void insert(SoftwareTimerControlBlock& softwareTimerControlBlock);
+
+private:
+
+	/**
+	 * \brief Redistributes all software timers from the list to lower levels.
+	 *
+	 * \param [in] list is a reference to list with software timers that will be redistributed
+	 */
+
+	void cascade(UnsortedSoftwareTimerList& list);
+
+	/// type of array with all slots of one level
+	using Level = std::array<UnsortedSoftwareTimerList, slotsPerLevel>;
+
+	/// array with all levels of slots
+	std::array<Level, levels> slots_;
+
+	/// list of software timers which expire beyond the range of all levels
+	UnsortedSoftwareTimerList overflowList_;
+
+	/// next tick which will be processed, all ticks before it were already processed
+	TickClock::rep nextTick_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERWHEEL_HPP_
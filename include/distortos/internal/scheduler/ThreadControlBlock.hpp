@@ -21,6 +21,7 @@
 
 #include "distortos/SchedulingPolicy.hpp"
 #include "distortos/ThreadState.hpp"
+#include "distortos/TickClock.hpp"
 
 #include "estd/TypeErasedFunctor.hpp"
 
@@ -81,6 +82,19 @@ public:
 
 	~ThreadControlBlock();
 
+	/**
+	 * \brief Adds CPU time used by thread.
+	 *
+	 * \attention This function should be called only by Scheduler.
+	 *
+	 * \param [in] cpuTime is the number of core clock cycles which will be added to CPU time of thread
+	 */
+
+	void addCpuTime(const uint32_t cpuTime)
+	{
+		cpuTime_ += cpuTime;
+	}
+
 	/**
 	 * \brief Hook function executed when thread is added to scheduler.
 	 *
@@ -110,6 +124,33 @@ public:
 		unblockFunctor_ = unblockFunctor;
 	}
 
+	/**
+	 * \return CPU time used by thread until last context switch or tick interrupt, core clock cycles
+	 */
+
+	uint64_t getCpuTime() const
+	{
+		return cpuTime_;
+	}
+
+	/**
+	 * \return absolute deadline of current period of the thread, TickClock::time_point::max() if deadline was not set
+	 */
+
+	TickClock::time_point getDeadline() const
+	{
+		return deadline_;
+	}
+
+	/**
+	 * \return number of periods in which the thread missed its deadline
+	 */
+
+	uint32_t getDeadlineMissCount() const
+	{
+		return deadlineMissCount_;
+	}
+
 	/**
 	 * \return pointer to list that has this object
 	 */
@@ -146,6 +187,15 @@ public:
 		return roundRobinQuantum_;
 	}
 
+	/**
+	 * \return const reference to internal RoundRobinQuantum object
+	 */
+
+	const RoundRobinQuantum& getRoundRobinQuantum() const
+	{
+		return roundRobinQuantum_;
+	}
+
 	/**
 	 * \return scheduling policy of the thread
 	 */
@@ -174,6 +224,15 @@ public:
 		return stack_;
 	}
 
+	/**
+	 * \return const reference to internal Stack object
+	 */
+
+	const architecture::Stack& getStack() const
+	{
+		return stack_;
+	}
+
 	/**
 	 * \return current state of object
 	 */
@@ -183,6 +242,25 @@ public:
 		return state_;
 	}
 
+	/**
+	 * \return pointer to ThreadGroupControlBlock with which this object is associated, nullptr if thread was not
+	 * started and its thread group was not set
+	 */
+
+	ThreadGroupControlBlock* getThreadGroupControlBlock() const
+	{
+		return threadGroupControlBlock_;
+	}
+
+	/**
+	 * \return slack of timeouts of blocking functions called by the thread
+	 */
+
+	TickClock::duration getTimerSlack() const
+	{
+		return timerSlack_;
+	}
+
 	/**
 	 * \brief Sets the list that has this object.
 	 *
@@ -194,6 +272,18 @@ public:
 		list_ = list;
 	}
 
+	/**
+	 * \brief Sets deadline parameters of thread.
+	 *
+	 * Current period of the thread starts now, so its absolute deadline is set to current time plus
+	 * \a relativeDeadline. If the thread is runnable, its position on the list is updated.
+	 *
+	 * \param [in] relativeDeadline is the deadline of each period, relative to the beginning of the period
+	 * \param [in] period is the period of the thread, 0 if the thread is aperiodic
+	 */
+
+	void setDeadline(TickClock::duration relativeDeadline, TickClock::duration period);
+
 	/**
 	 * \brief Changes priority of thread.
 	 *
@@ -232,6 +322,56 @@ public:
 		state_ = state;
 	}
 
+	/**
+	 * \brief Sets thread group of thread.
+	 *
+	 * \param [in] threadGroupControlBlock is a reference to ThreadGroupControlBlock to which this object will be added
+	 * when the thread is started
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - thread is already started;
+	 */
+
+	int setThreadGroupControlBlock(ThreadGroupControlBlock& threadGroupControlBlock);
+
+	/**
+	 * \param [in] timerSlack is the slack of timeouts of blocking functions called by the thread, 0 to disable
+	 * coalescing
+	 */
+
+	void setTimerSlack(const TickClock::duration timerSlack)
+	{
+		timerSlack_ = timerSlack;
+	}
+
+	/**
+	 * \brief Changes "throttled" state of thread.
+	 *
+	 * Effective priority of throttled thread is equal to its boosted priority. If the effective priority really
+	 * changes, the position in the thread list is adjusted and context switch may be requested.
+	 *
+	 * \attention This function should be called only by ThreadGroupControlBlock, with interrupt masking enabled.
+	 *
+	 * \param [in] throttled selects whether the thread is throttled (true) or not (false)
+	 */
+
+	void setThrottled(bool throttled);
+
+	/**
+	 * \brief Starts next period of the thread.
+	 *
+	 * If current time is after absolute deadline of current period, deadline miss is counted. Beginning of next period
+	 * is calculated by adding period to the beginning of current period (or it is set to current time for aperiodic
+	 * threads) and absolute deadline is updated.
+	 *
+	 * \attention This function must be called with interrupt masking enabled. Position of runnable thread on the list
+	 * is not updated.
+	 *
+	 * \return beginning of next period
+	 */
+
+	TickClock::time_point startNextPeriod();
+
 	/**
 	 * \brief Hook function called when context is switched to this thread.
 	 *
@@ -283,14 +423,14 @@ private:
 	 *
 	 * \attention list_ must not be nullptr
 	 *
+	 * \param [in] previousEffectivePriority is the effective priority of the thread before the change
 	 * \param [in] loweringBefore selects the method of ordering when lowering the priority (it must be false when the
 	 * priority is raised!):
-	 * - true - the thread is moved to the head of the group of threads with the new priority, this is accomplished by
-	 * temporarily boosting effective priority by 1,
+	 * - true - the thread is moved to the head of the group of threads with the new priority,
 	 * - false - the thread is moved to the tail of the group of threads with the new priority.
 	 */
 
-	void reposition(bool loweringBefore);
+	void reposition(uint8_t previousEffectivePriority, bool loweringBefore);
 
 	/// internal stack object
 	architecture::Stack stack_;
@@ -316,6 +456,27 @@ private:
 	/// pointer to SignalsReceiverControlBlock object for this thread, nullptr if this thread cannot receive signals
 	SignalsReceiverControlBlock* signalsReceiverControlBlock_;
 
+	/// CPU time used by thread, core clock cycles
+	uint64_t cpuTime_;
+
+	/// beginning of current period of the thread
+	TickClock::time_point periodBegin_;
+
+	/// absolute deadline of current period of the thread
+	TickClock::time_point deadline_;
+
+	/// deadline of each period, relative to the beginning of the period
+	TickClock::duration relativeDeadline_;
+
+	/// period of the thread, 0 if the thread is aperiodic
+	TickClock::duration period_;
+
+	/// slack of timeouts of blocking functions called by the thread, 0 if coalescing is disabled
+	TickClock::duration timerSlack_;
+
+	/// number of periods in which the thread missed its deadline
+	uint32_t deadlineMissCount_;
+
 	/// newlib's _reent structure with thread-specific data
 	_reent reent_;
 
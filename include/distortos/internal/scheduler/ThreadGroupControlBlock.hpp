@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadGroupControlBlock class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,6 +14,8 @@
 
 #include "distortos/internal/scheduler/ThreadListNode.hpp"
 
+#include "distortos/SoftwareTimerCommon.hpp"
+
 namespace distortos
 {
 
@@ -22,7 +24,16 @@ namespace internal
 
 class ThreadControlBlock;
 
-/// ThreadGroupControlBlock class is a control block for ThreadGroup
+/**
+ * \brief ThreadGroupControlBlock class is a control block for ThreadGroup
+ *
+ * Thread group may have a CPU budget - number of ticks which threads of the group may use in each replenishment period.
+ * Budget is charged from tick interrupt handler. When the group uses its budget, it becomes "throttled" - effective
+ * priority of all its threads is lowered to their boosted priority, so they run only in background (when no other
+ * thread is runnable) or when they hold a mutex needed by a higher-priority thread. Budget is replenished at the
+ * beginning of each period by a software timer, which also ends the throttling.
+ */
+
 class ThreadGroupControlBlock
 {
 public:
@@ -32,7 +43,12 @@ public:
 	 */
 
 	constexpr ThreadGroupControlBlock() :
-			threadList_{}
+			threadList_{},
+			replenishmentTimer_{*this},
+			budget_{},
+			remainingBudget_{},
+			overrunCount_{},
+			throttled_{}
 	{
 
 	}
@@ -40,18 +56,150 @@ public:
 	/**
 	 * \brief Adds new ThreadControlBlock to internal list of this object.
 	 *
+	 * If this group is throttled, added thread is throttled too.
+	 *
 	 * \param [in] threadControlBlock is a reference to added ThreadControlBlock object
 	 */
 
 	void add(ThreadControlBlock& threadControlBlock);
 
+	/**
+	 * \brief Charges one tick of CPU time to the budget of the group.
+	 *
+	 * In the tick in which the budget is used, the group is throttled with setThrottled(), so the duration of this
+	 * call is bounded by the cost of setThrottled(). In other ticks it takes constant time.
+	 *
+	 * \attention This function should be called only by Scheduler::tickInterruptHandler(), with interrupt masking
+	 * enabled.
+	 *
+	 * \return true if the group used its budget with this tick and became throttled, false otherwise
+	 */
+
+	bool charge();
+
+	/**
+	 * \return CPU budget of the group per replenishment period, 0 if the group has no budget
+	 */
+
+	TickClock::duration getBudget() const
+	{
+		return budget_;
+	}
+
+	/**
+	 * \return number of replenishment periods in which the group used its budget and was throttled
+	 */
+
+	uint32_t getOverrunCount() const
+	{
+		return overrunCount_;
+	}
+
+	/**
+	 * \return true if the group used its budget and is throttled, false otherwise
+	 */
+
+	bool isThrottled() const
+	{
+		return throttled_;
+	}
+
+	/**
+	 * \brief Sets CPU budget of the group.
+	 *
+	 * Budget is set to full value and throttling is ended immediately. Current replenishment period begins when this
+	 * function is called.
+	 *
+	 * \param [in] budget is the CPU budget of the group per replenishment period, 0 to disable budget enforcement
+	 * \param [in] period is the replenishment period, must be greater than \a budget (ignored if \a budget is 0)
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - \a budget is negative or \a period is not greater than \a budget;
+	 */
+
+	int setBudget(TickClock::duration budget, TickClock::duration period);
+
+	ThreadGroupControlBlock(const ThreadGroupControlBlock&) = delete;
+	ThreadGroupControlBlock(ThreadGroupControlBlock&&) = delete;
+	const ThreadGroupControlBlock& operator=(const ThreadGroupControlBlock&) = delete;
+	ThreadGroupControlBlock& operator=(ThreadGroupControlBlock&&) = delete;
+
 private:
 
+	/// ReplenishmentTimer class is a software timer which replenishes budget of the group
+	class ReplenishmentTimer : public SoftwareTimerCommon
+	{
+	public:
+
+		/**
+		 * \brief ReplenishmentTimer's constructor
+		 *
+		 * \param [in] owner is a reference to ThreadGroupControlBlock object that owns this ReplenishmentTimer
+		 */
+
+		constexpr explicit ReplenishmentTimer(ThreadGroupControlBlock& owner) :
+				SoftwareTimerCommon{},
+				owner_{owner}
+		{
+
+		}
+
+	private:
+
+		/**
+		 * \brief Replenishes budget of the group.
+		 */
+
+		void run() override
+		{
+			owner_.replenish();
+		}
+
+		/// reference to ThreadGroupControlBlock object that owns this ReplenishmentTimer
+		ThreadGroupControlBlock& owner_;
+	};
+
+	/**
+	 * \brief Replenishes budget of the group and ends throttling.
+	 */
+
+	void replenish();
+
+	/**
+	 * \brief Changes "throttled" state of the group and all its threads.
+	 *
+	 * Throttling is not lazy - each thread of the group whose effective priority changes is immediately repositioned
+	 * on the list it is currently on, so that all sorted lists of threads remain valid. The cost is linear in the
+	 * number of threads in the group - runnable threads are repositioned with the use of index of priority groups,
+	 * repositioning of a blocked thread is linear in the number of threads blocked on the same object. This function
+	 * is called with interrupt masking enabled at most twice per replenishment period - once when the budget is used
+	 * (in "tick" interrupt) and once when it is replenished.
+	 *
+	 * \param [in] throttled selects whether the group is throttled (true) or not (false)
+	 */
+
+	void setThrottled(bool throttled);
+
 	/// intrusive list of threads (thread control blocks)
 	using List = estd::IntrusiveList<ThreadListNode, &ThreadListNode::threadGroupNode, ThreadControlBlock>;
 
 	/// list of threads (thread control blocks) in this group
 	List threadList_;
+
+	/// software timer which replenishes budget of the group
+	ReplenishmentTimer replenishmentTimer_;
+
+	/// CPU budget of the group per replenishment period, 0 if the group has no budget
+	TickClock::duration budget_;
+
+	/// remaining CPU budget of the group in current replenishment period
+	TickClock::duration remainingBudget_;
+
+	/// number of replenishment periods in which the group used its budget and was throttled
+	uint32_t overrunCount_;
+
+	/// true if the group used its budget and is throttled, false otherwise
+	bool throttled_;
 };
 
 }	// namespace internal
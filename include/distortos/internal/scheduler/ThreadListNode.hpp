@@ -40,19 +40,26 @@ public:
 	constexpr ThreadListNode(const uint8_t priority) :
 			threadListNode{},
 			threadGroupNode{},
+			allThreadsNode{},
 			priority_{priority},
-			boostedPriority_{}
+			boostedPriority_{},
+			throttled_{}
 	{
 
 	}
 
 	/**
+	 * \brief Gets effective priority of thread.
+	 *
+	 * Priority of thread from throttled thread group is ignored - only boosted priority is used, so such thread runs in
+	 * background (unless it holds a mutex needed by higher-priority thread).
+	 *
 	 * \return effective priority of thread
 	 */
 
 	uint8_t getEffectivePriority() const
 	{
-		return std::max(priority_, boostedPriority_);
+		return throttled_ == false ? std::max(priority_, boostedPriority_) : boostedPriority_;
 	}
 
 	/**
@@ -70,6 +77,9 @@ public:
 	/// node for intrusive list in thread group
 	estd::IntrusiveListNode threadGroupNode;
 
+	/// node for intrusive list of all started threads in scheduler
+	estd::IntrusiveListNode allThreadsNode;
+
 protected:
 
 	/// thread's priority, 0 - lowest, UINT8_MAX - highest
@@ -77,6 +87,9 @@ protected:
 
 	/// thread's boosted priority, 0 - no boosting
 	uint8_t boostedPriority_;
+
+	/// true if thread group of this thread used its CPU budget, false otherwise
+	bool throttled_;
 };
 
 }	// namespace internal
@@ -2,7 +2,7 @@
  * \file
  * \brief FifoQueueBase class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -18,6 +18,7 @@
 #include "distortos/internal/synchronization/SemaphoreFunctor.hpp"
 
 #include <memory>
+#include <utility>
 
 namespace distortos
 {
@@ -25,7 +26,16 @@ namespace distortos
 namespace internal
 {
 
-/// FifoQueueBase class implements basic functionality of FifoQueue template class
+/**
+ * \brief FifoQueueBase class implements basic functionality of FifoQueue template class
+ *
+ * Slots may also be accessed in place - reserve() + commit() on the "push" side and peek() + release() on the "pop"
+ * side. While there is at least one outstanding reservation (or peek) on given side, elements pushed (or popped) on
+ * that side are not published to the other side, so the other side can never access a slot which is still being
+ * filled (or read) - all of them are published together when the last outstanding reservation is committed (or the
+ * last peek is released).
+ */
+
 class FifoQueueBase
 {
 public:
@@ -59,6 +69,16 @@ public:
 		return elementSize_;
 	}
 
+	/**
+	 * \return reference to semaphore guarding access to "pop" functions - its value is equal to the number of available
+	 * elements
+	 */
+
+	const Semaphore& getPopSemaphore() const
+	{
+		return popSemaphore_;
+	}
+
 	/**
 	 * \brief Implementation of pop() using type-erased functor
 	 *
@@ -73,7 +93,29 @@ public:
 
 	int pop(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor)
 	{
-		return popPush(waitSemaphoreFunctor, functor, popSemaphore_, pushSemaphore_, readPosition_);
+		return popPush(waitSemaphoreFunctor, functor, popSemaphore_, pushSemaphore_, readPosition_, popReservations_,
+				popPending_);
+	}
+
+	/**
+	 * \brief Implementation of popN() using type-erased functor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to popping - it will be
+	 * called for each popped element and will get pointer to storage with element as argument
+	 * \param [in] count is the maximum number of elements that will be popped
+	 * \param [out] popped is a reference to variable that will be used to return the number of popped elements
+	 *
+	 * \return zero if at least one element was popped successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::postNInternal();
+	 */
+
+	int popN(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor, const size_t count,
+			size_t& popped)
+	{
+		return popPushN(waitSemaphoreFunctor, functor, count, popped, popSemaphore_, pushSemaphore_, readPosition_,
+				popReservations_, popPending_);
 	}
 
 	/**
@@ -90,9 +132,103 @@ public:
 
 	int push(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor)
 	{
-		return popPush(waitSemaphoreFunctor, functor, pushSemaphore_, popSemaphore_, writePosition_);
+		return popPush(waitSemaphoreFunctor, functor, pushSemaphore_, popSemaphore_, writePosition_, pushReservations_,
+				pushPending_);
+	}
+
+	/**
+	 * \brief Implementation of pushN() using type-erased functor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to pushing - it will be
+	 * called for each pushed element and will get pointer to storage for element as argument
+	 * \param [in] count is the maximum number of elements that will be pushed
+	 * \param [out] pushed is a reference to variable that will be used to return the number of pushed elements
+	 *
+	 * \return zero if at least one element was pushed successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::postNInternal();
+	 */
+
+	int pushN(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor, const size_t count,
+			size_t& pushed)
+	{
+		return popPushN(waitSemaphoreFunctor, functor, count, pushed, pushSemaphore_, popSemaphore_, writePosition_,
+				pushReservations_, pushPending_);
+	}
+
+	/**
+	 * \brief Implementation of peek()
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 *
+	 * \return pair with return code (zero if element was peeked successfully, error code otherwise) and pointer to
+	 * storage with peeked element; error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	std::pair<int, void*> peek(const SemaphoreFunctor& waitSemaphoreFunctor)
+	{
+		return reservePeek(waitSemaphoreFunctor, popSemaphore_, readPosition_, popReservations_);
 	}
 
+	/**
+	 * \brief Implementation of release()
+	 *
+	 * \return zero if slot was released successfully, error code otherwise:
+	 * - EPERM - there is no outstanding peek;
+	 * - error codes returned by Semaphore::postNInternal();
+	 */
+
+	int release()
+	{
+		return commitRelease(pushSemaphore_, popReservations_, popPending_);
+	}
+
+	/**
+	 * \brief Implementation of reserve()
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 *
+	 * \return pair with return code (zero if slot was reserved successfully, error code otherwise) and pointer to
+	 * storage for element; error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	std::pair<int, void*> reserve(const SemaphoreFunctor& waitSemaphoreFunctor)
+	{
+		return reservePeek(waitSemaphoreFunctor, pushSemaphore_, writePosition_, pushReservations_);
+	}
+
+	/**
+	 * \brief Implementation of commit()
+	 *
+	 * \return zero if element was committed successfully, error code otherwise:
+	 * - EPERM - there is no outstanding reservation;
+	 * - error codes returned by Semaphore::postNInternal();
+	 */
+
+	int commit()
+	{
+		return commitRelease(popSemaphore_, pushReservations_, pushPending_);
+	}
+
+	/**
+	 * \brief Implementation of cancel()
+	 *
+	 * Only the most recent reservation may be cancelled - its slot is returned to "push" side and if it was the last
+	 * outstanding reservation, all pending elements are published to "pop" side.
+	 *
+	 * \param [in] storage is a pointer to storage for element returned by reserve()
+	 *
+	 * \return zero if reservation was cancelled successfully, error code otherwise:
+	 * - EBUSY - \a storage is not the last slot taken on "push" side;
+	 * - EPERM - there is no outstanding reservation;
+	 * - error codes returned by Semaphore::postNInternal();
+	 */
+
+	int cancel(void* storage);
+
 private:
 
 	/**
@@ -107,6 +243,11 @@ private:
 	 * for pop(), \a popSemaphore_ for push()
 	 * \param [in] storage is a reference to appropriate pointer to storage, which will be passed to \a functor, \a
 	 * readPosition_ for pop(), \a writePosition_ for push()
+	 * \param [in] reservations is a reference to the number of outstanding reservations on this side, \a
+	 * popReservations_ for pop(), \a pushReservations_ for push(); it is read after the wait with \a
+	 * waitSemaphoreFunctor
+	 * \param [in,out] pending is a reference to the number of elements not yet published to the other side, \a
+	 * popPending_ for pop(), \a pushPending_ for push()
 	 *
 	 * \return zero if operation was successful, error code otherwise:
 	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
@@ -114,7 +255,81 @@ private:
 	 */
 
 	int popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor, Semaphore& waitSemaphore,
-			Semaphore& postSemaphore, void*& storage);
+			Semaphore& postSemaphore, void*& storage, const size_t& reservations, size_t& pending);
+
+	/**
+	 * \brief Implementation of popN() and pushN() using type-erased functor
+	 *
+	 * Waits for the first element (or free slot) with \a waitSemaphoreFunctor and then takes as many of remaining ones
+	 * as are available - up to \a count in total - without blocking. All elements are transferred in one critical
+	 * section and \a postSemaphore is adjusted once by the number of transferred elements, so the other side is woken
+	 * at most once.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a waitSemaphore
+	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to popping/pushing - it
+	 * will be called for each element and will get \a storage as argument
+	 * \param [in] count is the maximum number of elements that will be transferred
+	 * \param [out] transferred is a reference to variable that will be used to return the number of transferred
+	 * elements
+	 * \param [in] waitSemaphore is a reference to semaphore that will be waited for, \a popSemaphore_ for popN(), \a
+	 * pushSemaphore_ for pushN()
+	 * \param [in] postSemaphore is a reference to semaphore that will be posted after the operation, \a pushSemaphore_
+	 * for popN(), \a popSemaphore_ for pushN()
+	 * \param [in] storage is a reference to appropriate pointer to storage, which will be passed to \a functor, \a
+	 * readPosition_ for popN(), \a writePosition_ for pushN()
+	 * \param [in] reservations is a reference to the number of outstanding reservations on this side, \a
+	 * popReservations_ for popN(), \a pushReservations_ for pushN(); it is read after the wait with \a
+	 * waitSemaphoreFunctor
+	 * \param [in,out] pending is a reference to the number of elements not yet published to the other side, \a
+	 * popPending_ for popN(), \a pushPending_ for pushN()
+	 *
+	 * \return zero if at least one element was transferred successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::postNInternal();
+	 */
+
+	int popPushN(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor, size_t count,
+			size_t& transferred, Semaphore& waitSemaphore, Semaphore& postSemaphore, void*& storage,
+			const size_t& reservations, size_t& pending);
+
+	/**
+	 * \brief Implementation of commit() and release()
+	 *
+	 * Finishes one outstanding reservation (or peek). If it was the last one, all pending elements (or slots) of this
+	 * side are published to the other side with single adjustment of \a postSemaphore.
+	 *
+	 * \param [in] postSemaphore is a reference to semaphore that will be posted, \a pushSemaphore_ for release(), \a
+	 * popSemaphore_ for commit()
+	 * \param [in,out] reservations is a reference to the number of outstanding reservations on this side, \a
+	 * popReservations_ for release(), \a pushReservations_ for commit()
+	 * \param [in,out] pending is a reference to the number of elements not yet published to the other side, \a
+	 * popPending_ for release(), \a pushPending_ for commit()
+	 *
+	 * \return zero if operation was successful, error code otherwise:
+	 * - EPERM - there is no outstanding reservation (or peek);
+	 * - error codes returned by Semaphore::postNInternal();
+	 */
+
+	int commitRelease(Semaphore& postSemaphore, size_t& reservations, size_t& pending);
+
+	/**
+	 * \brief Implementation of peek() and reserve()
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a waitSemaphore
+	 * \param [in] waitSemaphore is a reference to semaphore that will be waited for, \a popSemaphore_ for peek(), \a
+	 * pushSemaphore_ for reserve()
+	 * \param [in] storage is a reference to appropriate pointer to storage, \a readPosition_ for peek(), \a
+	 * writePosition_ for reserve()
+	 * \param [in,out] reservations is a reference to the number of outstanding reservations on this side, \a
+	 * popReservations_ for peek(), \a pushReservations_ for reserve()
+	 *
+	 * \return pair with return code (zero if operation was successful, error code otherwise) and pointer to storage of
+	 * reserved (or peeked) slot; error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	std::pair<int, void*> reservePeek(const SemaphoreFunctor& waitSemaphoreFunctor, Semaphore& waitSemaphore,
+			void*& storage, size_t& reservations);
 
 	/// semaphore guarding access to "pop" functions - its value is equal to the number of available elements
 	Semaphore popSemaphore_;
@@ -134,6 +349,18 @@ private:
 	/// pointer to first free slot available for writing
 	void* writePosition_;
 
+	/// number of outstanding peeks
+	size_t popReservations_;
+
+	/// number of slots freed on "pop" side which were not yet published to "push" side
+	size_t popPending_;
+
+	/// number of outstanding reservations
+	size_t pushReservations_;
+
+	/// number of elements written on "push" side which were not yet published to "pop" side
+	size_t pushPending_;
+
 	/// size of single queue element, bytes
 	const size_t elementSize_;
 };
@@ -2,7 +2,7 @@
  * \file
  * \brief MessageQueueBase class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,11 +14,14 @@
 
 #include "distortos/Semaphore.hpp"
 
+#include "distortos/internal/scheduler/PriorityBitmap.hpp"
+
 #include "distortos/internal/synchronization/QueueFunctor.hpp"
 #include "distortos/internal/synchronization/SemaphoreFunctor.hpp"
 
 #include "estd/SortedIntrusiveForwardList.hpp"
 
+#include <array>
 #include <memory>
 
 namespace distortos
@@ -105,11 +108,100 @@ public:
 		}
 	};
 
-	/// type of entry list
-	using EntryList = estd::SortedIntrusiveForwardList<DescendingPriority, Entry, &Entry::node>;
+	/// type of sorted list of entries
+	using SortedEntryList = estd::SortedIntrusiveForwardList<DescendingPriority, Entry, &Entry::node>;
 
 	/// type of free entry list
-	using FreeEntryList = EntryList::UnsortedIntrusiveForwardList;
+	using FreeEntryList = SortedEntryList::UnsortedIntrusiveForwardList;
+
+	/**
+	 * \brief PriorityBuckets struct is an index of EntryList, which makes insertion of entries a constant-time
+	 * operation.
+	 *
+	 * Each non-empty priority level is a contiguous group of entries on the list. Last entry of each group is
+	 * remembered in an array indexed with priority and the set of non-empty groups is tracked with PriorityBitmap.
+	 */
+
+	struct PriorityBuckets
+	{
+		/**
+		 * \brief PriorityBuckets's constructor
+		 */
+
+		constexpr PriorityBuckets() :
+				lastEntries{},
+				priorityBitmap{}
+		{
+
+		}
+
+		/// array with pointers to last entries of groups, valid only for priorities set in \a priorityBitmap
+		std::array<Entry*, UINT8_MAX + 1> lastEntries;
+
+		/// bitmap of non-empty groups
+		PriorityBitmap priorityBitmap;
+	};
+
+	/**
+	 * \brief EntryList class is a list of available entries, sorted in descending order of priority, with FIFO order
+	 * among entries with the same priority.
+	 *
+	 * Removal of entries is always done from the beginning of the list, so it is a constant-time operation. Insertion
+	 * traverses the list to find the position of new entry, unless PriorityBuckets object was provided - in that case
+	 * insertion is also a constant-time operation.
+	 */
+
+	class EntryList
+	{
+	public:
+
+		/**
+		 * \brief EntryList's constructor
+		 *
+		 * \param [in] priorityBuckets is a pointer to PriorityBuckets object used as an index of the list, nullptr to
+		 * use plain sorted list
+		 */
+
+		constexpr explicit EntryList(PriorityBuckets* const priorityBuckets) :
+				sortedEntryList_{},
+				priorityBuckets_{priorityBuckets}
+		{
+
+		}
+
+		/**
+		 * \return reference to first entry on the list - oldest entry with highest priority
+		 */
+
+		Entry& front()
+		{
+			return sortedEntryList_.front();
+		}
+
+		/**
+		 * \brief Transfers first entry from the list to the beginning of \a freeEntryList.
+		 *
+		 * \param [in] freeEntryList is a reference to list of free entries
+		 */
+
+		void spliceFrontTo(FreeEntryList& freeEntryList);
+
+		/**
+		 * \brief Transfers first entry from \a freeEntryList to the end of the group of entries with the same priority.
+		 *
+		 * \param [in] freeEntryList is a reference to list of free entries
+		 */
+
+		void spliceFrontFrom(FreeEntryList& freeEntryList);
+
+	private:
+
+		/// sorted list of entries
+		SortedEntryList sortedEntryList_;
+
+		/// pointer to PriorityBuckets object used as an index of the list, nullptr if not used
+		PriorityBuckets* priorityBuckets_;
+	};
 
 	/**
 	 * \brief InternalFunctor is a type-erased interface for functors which execute common code of pop() and push()
@@ -133,10 +225,14 @@ public:
 	 * elements (sufficiently large for \a maxElements, each \a elementSize bytes long) and appropriate deleter
 	 * \param [in] elementSize is the size of single queue element, bytes
 	 * \param [in] maxElements is the number of elements in \a entryStorage array and valueStorage memory block
+	 * \param [in] priorityBuckets is a pointer to PriorityBuckets object which will be used to make push() a
+	 * constant-time operation, nullptr to use plain sorted list of entries, default - nullptr; the object is not
+	 * accessed in the constructor, so it may be constructed later
 	 */
 
 	MessageQueueBase(EntryStorageUniquePointer&& entryStorageUniquePointer,
-			ValueStorageUniquePointer&& valueStorageUniquePointer, size_t elementSize, size_t maxElements);
+			ValueStorageUniquePointer&& valueStorageUniquePointer, size_t elementSize, size_t maxElements,
+			PriorityBuckets* priorityBuckets = {});
 
 	/**
 	 * \brief MessageQueueBase's destructor
@@ -144,6 +240,16 @@ public:
 
 	~MessageQueueBase();
 
+	/**
+	 * \return reference to semaphore guarding access to "pop" functions - its value is equal to the number of available
+	 * elements
+	 */
+
+	const Semaphore& getPopSemaphore() const
+	{
+		return popSemaphore_;
+	}
+
 	/**
 	 * \brief Implementation of pop() using type-erased functor
 	 *
@@ -2,7 +2,7 @@
  * \file
  * \brief MutexControlBlock class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -126,6 +126,18 @@ public:
 
 	void lock();
 
+	/**
+	 * \brief Transfers all threads from provided list to blockedList_, without unblocking them.
+	 *
+	 * Transferred threads will get the ownership of the mutex one by one, as it is unlocked by subsequent owners.
+	 *
+	 * \attention mutex must be locked and its protocol must not be PriorityInheritance
+	 *
+	 * \param [in] blockedList is a reference to list of threads that will be transferred
+	 */
+
+	void requeue(ThreadList& blockedList);
+
 	/**
 	 * \brief Performs unlocking or transfer of lock from current owner to next thread on the list.
 	 *
@@ -0,0 +1,198 @@
+/**
+ * \file
+ * \brief SpscQueueBase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_SPSCQUEUEBASE_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_SPSCQUEUEBASE_HPP_
+
+#include "distortos/Semaphore.hpp"
+
+#include "distortos/internal/synchronization/QueueFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreFunctor.hpp"
+
+#include <atomic>
+#include <memory>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief SpscQueueBase class implements basic functionality of SpscQueue template class
+ *
+ * Read position is modified only by the consumer and write position is modified only by the producer, so plain atomic
+ * loads and stores are enough - no read-modify-write operations and no interrupt masking are needed when the queue is
+ * neither empty nor full. Positions run from 0 to 2 * maxElements - 1, so full queue can be distinguished from empty
+ * one without wasting a slot.
+ *
+ * Semaphores are used only when the operation would block - the waiting side sets its "waiting" flag and the other
+ * side posts the semaphore after the next operation only if that flag is set.
+ */
+
+class SpscQueueBase
+{
+public:
+
+	/// unique_ptr (with deleter) to storage
+	using StorageUniquePointer = std::unique_ptr<void, void(&)(void*)>;
+
+	/**
+	 * \brief SpscQueueBase's constructor
+	 *
+	 * \param [in] storageUniquePointer is a rvalue reference to StorageUniquePointer with storage for queue elements
+	 * (sufficiently large for \a maxElements, each \a elementSize bytes long) and appropriate deleter
+	 * \param [in] elementSize is the size of single queue element, bytes
+	 * \param [in] maxElements is the number of elements in storage
+	 */
+
+	SpscQueueBase(StorageUniquePointer&& storageUniquePointer, size_t elementSize, size_t maxElements);
+
+	/**
+	 * \brief SpscQueueBase's destructor
+	 */
+
+	~SpscQueueBase();
+
+	/**
+	 * \return size of single queue element, bytes
+	 */
+
+	size_t getElementSize() const
+	{
+		return elementSize_;
+	}
+
+	/**
+	 * \brief Implementation of pop() using type-erased functor
+	 *
+	 * \warning This function may be used only by the single consumer.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * when the queue is empty
+	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to popping - it will get a
+	 * pointer to storage with element as argument
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int pop(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor);
+
+	/**
+	 * \brief Implementation of push() using type-erased functor
+	 *
+	 * \warning This function may be used only by the single producer.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * when the queue is full
+	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to pushing - it will get a
+	 * pointer to storage for element as argument
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int push(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor);
+
+private:
+
+	/**
+	 * \brief Advances position by one element.
+	 *
+	 * \param [in] position is the position that will be advanced
+	 *
+	 * \return \a position advanced by one element, wrapped to [0; 2 * maxElements_)
+	 */
+
+	size_t advance(const size_t position) const
+	{
+		const auto nextPosition = position + 1;
+		return nextPosition != 2 * maxElements_ ? nextPosition : 0;
+	}
+
+	/**
+	 * \param [in] position is the position in the range [0; 2 * maxElements_)
+	 *
+	 * \return pointer to storage for element at \a position
+	 */
+
+	void* getStorage(const size_t position) const
+	{
+		return static_cast<uint8_t*>(storageUniquePointer_.get()) +
+				(position < maxElements_ ? position : position - maxElements_) * elementSize_;
+	}
+
+	/**
+	 * \brief Waits until condition of the queue allows the operation.
+	 *
+	 * \a waitSemaphoreFunctor may be executed several times, so it must not use relative timeout - callers with
+	 * duration convert it to time point once, before calling this function.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a semaphore
+	 * \param [in] semaphore is a reference to semaphore that will be waited for, \a popSemaphore_ for pop(), \a
+	 * pushSemaphore_ for push()
+	 * \param [in] waiting is a reference to "waiting" flag, \a popWaiting_ for pop(), \a pushWaiting_ for push()
+	 * \param [in] otherPosition is a reference to position modified by the other side, \a writePosition_ for pop(), \a
+	 * readPosition_ for push()
+	 * \param [in] blockingOtherPosition is the value of \a otherPosition for which the operation cannot be done
+	 *
+	 * \return zero if the operation can be done, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int wait(const SemaphoreFunctor& waitSemaphoreFunctor, Semaphore& semaphore, std::atomic<bool>& waiting,
+			const std::atomic<size_t>& otherPosition, size_t blockingOtherPosition);
+
+	/**
+	 * \brief Wakes the other side if it is waiting.
+	 *
+	 * \param [in] semaphore is a reference to semaphore that will be posted, \a pushSemaphore_ for pop(), \a
+	 * popSemaphore_ for push()
+	 * \param [in] waiting is a reference to "waiting" flag of the other side, \a pushWaiting_ for pop(), \a popWaiting_
+	 * for push()
+	 */
+
+	static void wake(Semaphore& semaphore, std::atomic<bool>& waiting);
+
+	/// binary semaphore used by consumer to wait while the queue is empty
+	Semaphore popSemaphore_;
+
+	/// binary semaphore used by producer to wait while the queue is full
+	Semaphore pushSemaphore_;
+
+	/// storage for queue elements
+	const StorageUniquePointer storageUniquePointer_;
+
+	/// size of single queue element, bytes
+	const size_t elementSize_;
+
+	/// number of elements in storage
+	const size_t maxElements_;
+
+	/// position of first element available for reading, modified only by consumer
+	std::atomic<size_t> readPosition_;
+
+	/// position of first free slot available for writing, modified only by producer
+	std::atomic<size_t> writePosition_;
+
+	/// true if consumer is waiting on \a popSemaphore_, false otherwise
+	std::atomic<bool> popWaiting_;
+
+	/// true if producer is waiting on \a pushSemaphore_, false otherwise
+	std::atomic<bool> pushWaiting_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_SPSCQUEUEBASE_HPP_
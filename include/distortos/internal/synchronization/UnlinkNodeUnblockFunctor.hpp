@@ -0,0 +1,67 @@
+/**
+ * \file
+ * \brief UnlinkNodeUnblockFunctor class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_UNLINKNODEUNBLOCKFUNCTOR_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_UNLINKNODEUNBLOCKFUNCTOR_HPP_
+
+#include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+
+#include "estd/IntrusiveList.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief UnlinkNodeUnblockFunctor class is a functor executed when unblocking a thread which - apart from being on the
+ * list of blocked threads - has description of its wait linked on another intrusive list.
+ *
+ * Used by synchronization objects which keep waiting threads with additional parameters of the wait (EventFlags,
+ * waitAny()).
+ */
+
+class UnlinkNodeUnblockFunctor : public ThreadControlBlock::UnblockFunctor
+{
+public:
+
+	/**
+	 * \brief UnlinkNodeUnblockFunctor's constructor
+	 *
+	 * \param [in] node is a reference to node of description of wait of unblocked thread
+	 */
+
+	constexpr explicit UnlinkNodeUnblockFunctor(estd::IntrusiveListNode& node) :
+			node_{node}
+	{
+
+	}
+
+	/**
+	 * \brief UnlinkNodeUnblockFunctor's function call operator
+	 *
+	 * Removes description of wait of unblocked thread from its list, regardless of the reason of unblocking.
+	 */
+
+	void operator()(ThreadControlBlock&, ThreadControlBlock::UnblockReason) const override;
+
+private:
+
+	/// reference to node of description of wait of unblocked thread
+	estd::IntrusiveListNode& node_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_UNLINKNODEUNBLOCKFUNCTOR_HPP_
@@ -0,0 +1,91 @@
+/**
+ * \file
+ * \brief WaitAnyRegistration class header and notifyWaitAny() declaration
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_NOTIFYWAITANY_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_NOTIFYWAITANY_HPP_
+
+#include "distortos/waitAny.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief WaitAnyRegistration class marks semaphores which are waited for by thread blocked in waitAny().
+ *
+ * Semaphore calls notifyWaitAny() only when it is marked, so posting semaphores which are not used with waitAny() does
+ * not scan the list of threads blocked in waitAny().
+ *
+ * \warning Objects of this class must be constructed and destructed with interrupts masked.
+ */
+
+class WaitAnyRegistration
+{
+public:
+
+	/**
+	 * \brief WaitAnyRegistration's constructor
+	 *
+	 * Marks semaphores of all objects from \a objects.
+	 *
+	 * \param [in] objects is a range of objects which are waited for
+	 */
+
+	explicit WaitAnyRegistration(const WaitAnyObjects objects) :
+			objects_{objects}
+	{
+		for (const auto& object : objects_)
+			++object.getSemaphore().waitAnyCount_;
+	}
+
+	/**
+	 * \brief WaitAnyRegistration's destructor
+	 *
+	 * Unmarks semaphores of all objects from range passed to constructor.
+	 */
+
+	~WaitAnyRegistration()
+	{
+		for (const auto& object : objects_)
+			--object.getSemaphore().waitAnyCount_;
+	}
+
+	WaitAnyRegistration(const WaitAnyRegistration&) = delete;
+	WaitAnyRegistration(WaitAnyRegistration&&) = delete;
+	const WaitAnyRegistration& operator=(const WaitAnyRegistration&) = delete;
+	WaitAnyRegistration& operator=(WaitAnyRegistration&&) = delete;
+
+private:
+
+	/// range of objects which are waited for
+	WaitAnyObjects objects_;
+};
+
+/**
+ * \brief Notifies threads blocked in waitAny() that semaphore became "ready".
+ *
+ * Unblocks all threads blocked in waitAny() which wait for \a semaphore (directly or via a queue which uses it).
+ * Should be called only if \a semaphore is marked by WaitAnyRegistration, as otherwise there's no thread to unblock.
+ *
+ * \warning This function must be called with interrupts masked.
+ *
+ * \param [in] semaphore is a reference to semaphore which became "ready"
+ */
+
+void notifyWaitAny(const Semaphore& semaphore);
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_NOTIFYWAITANY_HPP_
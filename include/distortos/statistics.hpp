@@ -2,7 +2,7 @@
  * \file
  * \brief statistics namespace header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,23 +12,166 @@
 #ifndef INCLUDE_DISTORTOS_STATISTICS_HPP_
 #define INCLUDE_DISTORTOS_STATISTICS_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
+#include <array>
+
+#include <cstddef>
 #include <cstdint>
 
 namespace distortos
 {
 
+class Thread;
+
 namespace statistics
 {
 
 /// \addtogroup statistics
 /// \{
 
+/// CpuTimeSnapshot struct holds system-wide CPU time counters, core clock cycles
+struct CpuTimeSnapshot
+{
+	/// total CPU time since start of scheduling
+	uint64_t total;
+
+	/// CPU time used by idle thread
+	uint64_t idle;
+
+	/// CPU time used by tick interrupt handler
+	uint64_t tickInterrupt;
+};
+
+/// StackUsage struct holds usage of one stack
+struct StackUsage
+{
+	/// thread which uses the stack, nullptr for the stack used by interrupts
+	const Thread* thread;
+
+	/// size of stack, bytes
+	size_t size;
+
+	/// max number of bytes of stack used so far
+	size_t highWaterMark;
+};
+
+#ifdef CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
+
+/// number of bins in histogram of durations of interrupt masking
+constexpr size_t interruptMaskingHistogramSize {16};
+
+/// InterruptMaskingStatistics struct holds statistics of sections with interrupt masking started in one place of code
+struct InterruptMaskingStatistics
+{
+	/// address in code which started the sections - return address of architecture::InterruptMaskingLock's
+	/// constructor, may be converted to function and line with addr2line
+	const void* callSite;
+
+	/// number of sections
+	uint32_t count;
+
+	/// maximal duration of section, core clock cycles
+	uint32_t maxCycles;
+
+	/// total duration of all sections, core clock cycles
+	uint64_t totalCycles;
+
+	/// histogram of durations - bin n counts sections which lasted [2^n; 2^(n + 1)) core clock cycles, bin 0 also
+	/// counts sections which lasted 0 cycles and the last bin also counts all longer sections
+	std::array<uint32_t, interruptMaskingHistogramSize> histogram;
+};
+
+#endif	// def CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
+
+/**
+ * \brief Gets consistent snapshot of system-wide CPU time counters.
+ *
+ * CPU load in given period of time may be calculated from the changes of counters in two snapshots - it is equal to
+ * 1 - (change of CpuTimeSnapshot::idle) / (change of CpuTimeSnapshot::total).
+ *
+ * \return snapshot of system-wide CPU time counters
+ */
+
+CpuTimeSnapshot getCpuTimeSnapshot();
+
+/**
+ * \brief Gets number of budget overruns of thread groups.
+ *
+ * Budget overrun is counted each time a thread group uses its whole CPU budget in a replenishment period and becomes
+ * throttled.
+ *
+ * \return number of replenishment periods in which any thread group used its CPU budget and was throttled
+ */
+
+uint64_t getBudgetOverrunCount();
+
 /**
  * \return number of context switches
  */
 
 uint64_t getContextSwitchCount();
 
+/**
+ * \brief Gets number of ticks during which idle thread was running.
+ *
+ * CPU load in given period of time may be calculated from the change of this value and the change of
+ * TickClock::now() - the ratio of these two is the fraction of time in which the system was idle.
+ *
+ * \return number of ticks during which idle thread was running
+ */
+
+uint64_t getIdleTickCount();
+
+/**
+ * \brief Gets usage of stacks of all threads and of the stack used by interrupts.
+ *
+ * The first element describes the stack used by interrupts, next ones - stacks of all started threads which were not
+ * destroyed yet (including main thread and idle thread), in the order of starting. High-water marks are found as in
+ * Thread::getStackHighWaterMark().
+ *
+ * \param [out] buffer is a pointer to buffer for usage of stacks
+ * \param [in] size is the number of elements in \a buffer
+ *
+ * \return number of all stacks, only first \a size of them are written to \a buffer
+ */
+
+size_t getStackUsage(StackUsage* buffer, size_t size);
+
+#ifdef CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
+
+/**
+ * \brief Gets statistics of interrupt masking.
+ *
+ * Statistics of places in code with the longest sections executed with interrupt masking enabled are copied to
+ * provided buffer, sorted by maximal duration in descending order. Statistics of each place are copied with interrupts
+ * masked, so they are consistent, but different places may be copied at different moments.
+ *
+ * \param [out] buffer is a pointer to buffer for statistics
+ * \param [in] size is the number of elements in \a buffer
+ *
+ * \return number of elements written to \a buffer
+ */
+
+size_t getInterruptMaskingStatistics(InterruptMaskingStatistics* buffer, size_t size);
+
+/**
+ * \return number of sections with interrupt masking started in places in code which could not be tracked, because
+ * CONFIG_INTERRUPT_MASKING_PROFILER_CALL_SITES places are already tracked
+ */
+
+uint32_t getUntrackedInterruptMaskingCount();
+
+/**
+ * \brief Resets statistics of interrupt masking.
+ *
+ * All tracked places in code and all counters are cleared.
+ */
+
+void resetInterruptMaskingStatistics();
+
+#endif	// def CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
+
 /// \}
 
 }	// namespace statistics
@@ -0,0 +1,187 @@
+/**
+ * \file
+ * \brief trace API header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_TRACE_HPP_
+#define INCLUDE_DISTORTOS_TRACE_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#include <array>
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace trace
+{
+
+/// \addtogroup trace
+/// \{
+
+/// type of traced event, numeric values are part of the format of trace buffer and must not be changed
+enum class Event : uint8_t
+{
+	/// context switch, object - ThreadControlBlock of new thread, argument - its effective priority
+	threadSwitch,
+	/// thread was blocked, object - its ThreadControlBlock, argument - its new ThreadState
+	threadBlock,
+	/// thread was unblocked, object - its ThreadControlBlock, argument - ThreadControlBlock::UnblockReason
+	threadUnblock,
+	/// semaphore was posted, object - Semaphore, argument - its value after the operation
+	semaphorePost,
+	/// semaphore was locked, object - Semaphore, argument - its value after the operation; if the thread had to block,
+	/// the event is recorded when the thread returns from the wait
+	semaphoreWait,
+	/// ownership of mutex was passed to first waiting thread, object - MutexControlBlock, argument - address of
+	/// ThreadControlBlock of new owner
+	mutexTransferLock,
+	/// software timer expired, object - SoftwareTimerControlBlock, argument - 0
+	softwareTimerExpire,
+	/// entry to interrupt handler, object - nullptr, argument - architecture-specific number of interrupt (exception
+	/// number from IPSR register on ARMv6-M and ARMv7-M)
+	interruptEntry,
+	/// exit from interrupt handler, object - nullptr, argument - architecture-specific number of interrupt (exception
+	/// number from IPSR register on ARMv6-M and ARMv7-M)
+	interruptExit,
+};
+
+/// single record of trace buffer
+struct Record
+{
+	/// value of architecture::getCycleCount() when the event was recorded
+	uint32_t timestamp;
+
+	/// address of object related to the event
+	uint32_t object;
+
+	/// event-specific argument
+	uint32_t argument;
+
+	/// lower 16 bits of index of the record - written last, so it can be used to detect incomplete records
+	uint16_t sequence;
+
+	/// type of event
+	Event event;
+
+	/// reserved, always 0
+	uint8_t reserved;
+};
+
+static_assert(sizeof(Record) == 16, "Invalid size of trace::Record!");
+
+#ifdef CONFIG_TRACE_ENABLE
+
+/// Buffer struct is a ring buffer of trace records with a header describing its format
+struct Buffer
+{
+	/// value of Buffer::magic field
+	constexpr static uint32_t magicValue {0x43525444};	// "DTRC" in little-endian
+
+	/// version of format of trace buffer
+	constexpr static uint16_t versionValue {1};
+
+	/// magic value identifying trace buffer, always magicValue
+	uint32_t magic;
+
+	/// version of format of trace buffer, always versionValue
+	uint16_t version;
+
+	/// size of single record, bytes
+	uint16_t recordSize;
+
+	/// number of records in buffer
+	uint32_t capacity;
+
+	/// frequency of Record::timestamp, Hz
+	uint32_t timestampFrequency;
+
+	/// total number of records written since start (modulo 2^32), record with index n is stored at position
+	/// n % capacity
+	uint32_t writeIndex;
+
+	/// ring buffer of records
+	std::array<Record, CONFIG_TRACE_BUFFER_SIZE> records;
+};
+
+static_assert(CONFIG_TRACE_BUFFER_SIZE <= (1 << 16) / 2,
+		"Trace buffer too long for 16-bit Record::sequence - overwritten records could not be detected!");
+
+/**
+ * \brief Trace buffer.
+ *
+ * The buffer can be dumped with a debugger (e.g. `dump binary value trace.bin distortos::trace::buffer` in *GDB*) and
+ * decoded with scripts/decodeTrace.py.
+ */
+
+extern Buffer buffer;
+
+/**
+ * \brief Records an event in trace buffer.
+ *
+ * Interrupts are masked only while position in buffer and timestamp are obtained, so this function can be used in any
+ * context, including interrupt handlers.
+ *
+ * \param [in] event is the type of recorded event
+ * \param [in] object is a pointer to object related to the event
+ * \param [in] argument is the event-specific argument
+ */
+
+void record(Event event, const void* object, uint32_t argument);
+
+#else	// !def CONFIG_TRACE_ENABLE
+
+/**
+ * \brief Records an event in trace buffer.
+ *
+ * Empty - trace is disabled in configuration.
+ */
+
+inline void record(Event, const void*, uint32_t)
+{
+
+}
+
+#endif	// !def CONFIG_TRACE_ENABLE
+
+/**
+ * \brief Records entry to interrupt handler.
+ *
+ * This function may be called by interrupt handlers of the application to make them visible in trace.
+ *
+ * \param [in] interruptNumber is the architecture-specific number of interrupt
+ */
+
+inline void recordInterruptEntry(const uint32_t interruptNumber)
+{
+	record(Event::interruptEntry, nullptr, interruptNumber);
+}
+
+/**
+ * \brief Records exit from interrupt handler.
+ *
+ * This function may be called by interrupt handlers of the application to make them visible in trace.
+ *
+ * \param [in] interruptNumber is the architecture-specific number of interrupt
+ */
+
+inline void recordInterruptExit(const uint32_t interruptNumber)
+{
+	record(Event::interruptExit, nullptr, interruptNumber);
+}
+
+/// \}
+
+}	// namespace trace
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_TRACE_HPP_
@@ -0,0 +1,286 @@
+/**
+ * \file
+ * \brief WaitAnyObject class and waitAny() header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_WAITANY_HPP_
+#define INCLUDE_DISTORTOS_WAITANY_HPP_
+
+#include "distortos/Semaphore.hpp"
+
+#include "estd/ContiguousRange.hpp"
+
+#include <utility>
+
+namespace distortos
+{
+
+template<typename T>
+class FifoQueue;
+
+template<typename T>
+class MessageQueue;
+
+class RawFifoQueue;
+class RawMessageQueue;
+
+/**
+ * \brief WaitAnyObject class is a reference to an object which can be waited for with waitAny().
+ *
+ * The object is "ready" when the operation which would otherwise block can be done immediately:
+ * - Semaphore - when it is not locked;
+ * - FifoQueue, RawFifoQueue, MessageQueue and RawMessageQueue - when an element can be popped.
+ *
+ * Constructors are not explicit, so that array of WaitAnyObject can be initialized directly with references to
+ * objects.
+ *
+ * \ingroup synchronization
+ */
+
+class WaitAnyObject
+{
+public:
+
+	/**
+	 * \brief WaitAnyObject's constructor
+	 *
+	 * \param [in] semaphore is a reference to semaphore which will be waited for
+	 */
+
+	constexpr WaitAnyObject(const Semaphore& semaphore) :
+			semaphore_{semaphore}
+	{
+
+	}
+
+	/**
+	 * \brief WaitAnyObject's constructor
+	 *
+	 * \tparam T is the type of data in queue
+	 *
+	 * \param [in] fifoQueue is a reference to FIFO queue which will be waited for
+	 */
+
+	template<typename T>
+	constexpr WaitAnyObject(const FifoQueue<T>& fifoQueue) :
+			semaphore_{fifoQueue.fifoQueueBase_.getPopSemaphore()}
+	{
+
+	}
+
+	/**
+	 * \brief WaitAnyObject's constructor
+	 *
+	 * \tparam T is the type of data in queue
+	 *
+	 * \param [in] messageQueue is a reference to message queue which will be waited for
+	 */
+
+	template<typename T>
+	constexpr WaitAnyObject(const MessageQueue<T>& messageQueue) :
+			semaphore_{messageQueue.messageQueueBase_.getPopSemaphore()}
+	{
+
+	}
+
+	/**
+	 * \brief WaitAnyObject's constructor
+	 *
+	 * \param [in] rawFifoQueue is a reference to raw FIFO queue which will be waited for
+	 */
+
+	WaitAnyObject(const RawFifoQueue& rawFifoQueue);
+
+	/**
+	 * \brief WaitAnyObject's constructor
+	 *
+	 * \param [in] rawMessageQueue is a reference to raw message queue which will be waited for
+	 */
+
+	WaitAnyObject(const RawMessageQueue& rawMessageQueue);
+
+	/**
+	 * \return reference to semaphore which is "ready" when the referenced object is "ready"
+	 */
+
+	const Semaphore& getSemaphore() const
+	{
+		return semaphore_;
+	}
+
+	/**
+	 * \return true if the referenced object is "ready", false otherwise
+	 */
+
+	bool isReady() const
+	{
+		return semaphore_.getValue() != 0;
+	}
+
+private:
+
+	/// reference to semaphore which is "ready" when the referenced object is "ready"
+	const Semaphore& semaphore_;
+};
+
+/// range of objects which are waited for with waitAny()
+using WaitAnyObjects = estd::ContiguousRange<const WaitAnyObject>;
+
+/**
+ * \brief Tries to wait for any of objects to become "ready" for given duration of time.
+ *
+ * Similar to POSIX poll() - http://pubs.opengroup.org/onlinepubs/9699919799/functions/poll.html#
+ *
+ * \param [in] duration is the duration after which the wait will be terminated without success
+ * \param [in] objects is a range of objects which will be waited for
+ *
+ * \return pair with return code (0 on success, error code otherwise) and index of "ready" object in \a objects; error
+ * codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - EINVAL - \a objects is empty;
+ * - ETIMEDOUT - none of objects became "ready" before the specified timeout expired;
+ */
+
+std::pair<int, size_t> tryWaitAnyFor(TickClock::duration duration, WaitAnyObjects objects);
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+/**
+ * \brief Tries to wait for any of objects to become "ready" for given duration of time, with sub-tick precision of
+ * timeout.
+ *
+ * Variant of tryWaitAnyFor(TickClock::duration duration, WaitAnyObjects objects) in which the timeout is handled by
+ * high precision timer. Template variant of tryWaitAnyFor() never uses this function, so sub-tick precision must be
+ * requested explicitly.
+ *
+ * \param [in] duration is the duration after which the wait will be terminated without success
+ * \param [in] objects is a range of objects which will be waited for
+ *
+ * \return pair with return code (0 on success, error code otherwise) and index of "ready" object in \a objects; error
+ * codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - EINVAL - \a objects is empty;
+ * - ETIMEDOUT - none of objects became "ready" before the specified timeout expired;
+ */
+
+std::pair<int, size_t> tryWaitAnyForPrecise(HighResolutionClock::duration duration, WaitAnyObjects objects);
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+/**
+ * \brief Tries to wait for any of objects to become "ready" for given duration of time.
+ *
+ * Template variant of tryWaitAnyFor(TickClock::duration duration, WaitAnyObjects objects).
+ *
+ * \tparam Rep is type of tick counter
+ * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+ *
+ * \param [in] duration is the duration after which the wait will be terminated without success
+ * \param [in] objects is a range of objects which will be waited for
+ *
+ * \return pair with return code (0 on success, error code otherwise) and index of "ready" object in \a objects; error
+ * codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - EINVAL - \a objects is empty;
+ * - ETIMEDOUT - none of objects became "ready" before the specified timeout expired;
+ */
+
+template<typename Rep, typename Period>
+std::pair<int, size_t> tryWaitAnyFor(const std::chrono::duration<Rep, Period> duration, const WaitAnyObjects objects)
+{
+	return tryWaitAnyFor(std::chrono::duration_cast<TickClock::duration>(duration), objects);
+}
+
+/**
+ * \brief Tries to wait for any of objects to become "ready" until given time point.
+ *
+ * Similar to POSIX poll() - http://pubs.opengroup.org/onlinepubs/9699919799/functions/poll.html#
+ *
+ * \param [in] timePoint is the time point at which the wait will be terminated without success
+ * \param [in] objects is a range of objects which will be waited for
+ *
+ * \return pair with return code (0 on success, error code otherwise) and index of "ready" object in \a objects; error
+ * codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - EINVAL - \a objects is empty;
+ * - ETIMEDOUT - none of objects became "ready" before the specified timeout expired;
+ */
+
+std::pair<int, size_t> tryWaitAnyUntil(TickClock::time_point timePoint, WaitAnyObjects objects);
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+/**
+ * \brief Tries to wait for any of objects to become "ready" until given time point, with sub-tick precision of timeout.
+ *
+ * Variant of tryWaitAnyUntil(TickClock::time_point timePoint, WaitAnyObjects objects) in which the timeout is handled
+ * by high precision timer.
+ *
+ * \param [in] timePoint is the time point at which the wait will be terminated without success
+ * \param [in] objects is a range of objects which will be waited for
+ *
+ * \return pair with return code (0 on success, error code otherwise) and index of "ready" object in \a objects; error
+ * codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - EINVAL - \a objects is empty;
+ * - ETIMEDOUT - none of objects became "ready" before the specified timeout expired;
+ */
+
+std::pair<int, size_t> tryWaitAnyUntilPrecise(HighResolutionClock::time_point timePoint, WaitAnyObjects objects);
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+/**
+ * \brief Tries to wait for any of objects to become "ready" until given time point.
+ *
+ * Template variant of tryWaitAnyUntil(TickClock::time_point timePoint, WaitAnyObjects objects).
+ *
+ * \tparam Duration is a std::chrono::duration type used to measure duration
+ *
+ * \param [in] timePoint is the time point at which the wait will be terminated without success
+ * \param [in] objects is a range of objects which will be waited for
+ *
+ * \return pair with return code (0 on success, error code otherwise) and index of "ready" object in \a objects; error
+ * codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - EINVAL - \a objects is empty;
+ * - ETIMEDOUT - none of objects became "ready" before the specified timeout expired;
+ */
+
+template<typename Duration>
+std::pair<int, size_t> tryWaitAnyUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+		const WaitAnyObjects objects)
+{
+	return tryWaitAnyUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), objects);
+}
+
+/**
+ * \brief Waits for any of objects to become "ready".
+ *
+ * Similar to POSIX poll() - http://pubs.opengroup.org/onlinepubs/9699919799/functions/poll.html#
+ *
+ * If any of objects is already "ready", this function returns immediately. Otherwise the calling thread is blocked
+ * until one of objects becomes "ready" - the thread is unblocked when a semaphore (possibly the one used internally by
+ * a queue) is posted while no thread is blocked on it. This function doesn't perform the operation on the object, so
+ * the calling thread should use non-blocking variant of the operation (like Semaphore::tryWait() or
+ * FifoQueue::tryPop()), which may fail if another thread was faster.
+ *
+ * \param [in] objects is a range of objects which will be waited for
+ *
+ * \return pair with return code (0 on success, error code otherwise) and index of "ready" object in \a objects - the
+ * lowest index if more than one object is "ready"; error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - EINVAL - \a objects is empty;
+ */
+
+std::pair<int, size_t> waitAny(WaitAnyObjects objects);
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_WAITANY_HPP_
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+
+#
+# file: decodeTrace.py
+#
+# author: Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+
+"""Decoder of distortos kernel event trace.
+
+Decodes binary dump of distortos::trace::buffer (for example obtained in GDB with
+"dump binary value trace.bin distortos::trace::buffer") to a text timeline or to a JSON file which can be opened in
+Chrome's trace viewer (chrome://tracing).
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+HEADER_FORMAT = '<IHHIII'
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+RECORD_FORMAT = '<IIIHBB'
+MAGIC = 0x43525444
+VERSION = 1
+
+EVENTS = ('threadSwitch', 'threadBlock', 'threadUnblock', 'semaphorePost', 'semaphoreWait', 'mutexTransferLock',
+		'softwareTimerExpire', 'interruptEntry', 'interruptExit')
+
+THREAD_STATES = ('created', 'runnable', 'terminated', 'sleeping', 'blockedOnSemaphore', 'suspended', 'blockedOnMutex',
+		'blockedOnConditionVariable', 'waitingForSignal', 'blockedOnOnceFlag', 'detached')
+
+UNBLOCK_REASONS = ('unblockRequest', 'timeout', 'signal')
+
+def lookup(names, value):
+	return names[value] if value < len(names) else str(value)
+
+def readRecords(data):
+	"""Returns (timestampFrequency, list of (timestamp, event, object, argument)) sorted from oldest record."""
+	if len(data) < HEADER_SIZE:
+		raise ValueError('dump is too short')
+	magic, version, recordSize, capacity, timestampFrequency, writeIndex = struct.unpack_from(HEADER_FORMAT, data)
+	if magic != MAGIC:
+		raise ValueError('invalid magic value 0x{:08x}'.format(magic))
+	if version != VERSION:
+		raise ValueError('unsupported version {}'.format(version))
+	if len(data) < HEADER_SIZE + recordSize * capacity:
+		raise ValueError('dump is too short for {} records'.format(capacity))
+
+	records = []
+	timestamp = None
+	previousRawTimestamp = None
+	# writeIndex is a 32-bit counter which may have wrapped around, so indexes of last records are calculated modulo
+	# 2^32 - slots which were never written (or were overwritten) are rejected with the check of sequence below
+	for offset in range(capacity, 0, -1):
+		index = (writeIndex - offset) & 0xffffffff
+		rawTimestamp, objectAddress, argument, sequence, event, _ = struct.unpack_from(RECORD_FORMAT, data,
+				HEADER_SIZE + (index % capacity) * recordSize)
+		if sequence != index & 0xffff:	# incomplete or overwritten record
+			continue
+		# timestamps are 32-bit, so they are unwrapped assuming less than 2^32 cycles between consecutive records
+		if timestamp is None:
+			timestamp = 0
+		else:
+			timestamp += (rawTimestamp - previousRawTimestamp) & 0xffffffff
+		previousRawTimestamp = rawTimestamp
+		records.append((timestamp, event, objectAddress, argument))
+	return timestampFrequency, records
+
+def describe(event, argument):
+	name = lookup(EVENTS, event)
+	if name == 'threadBlock':
+		return lookup(THREAD_STATES, argument)
+	if name == 'threadUnblock':
+		return lookup(UNBLOCK_REASONS, argument)
+	if name == 'mutexTransferLock':
+		return 'owner=0x{:08x}'.format(argument)
+	return str(argument)
+
+def writeTimeline(timestampFrequency, records, output):
+	for timestamp, event, objectAddress, argument in records:
+		output.write('{:14.3f} us  {:<20} 0x{:08x}  {}\n'.format(timestamp * 1e6 / timestampFrequency,
+				lookup(EVENTS, event), objectAddress, describe(event, argument)))
+
+def writeChromeTrace(timestampFrequency, records, output):
+	events = []
+	currentThread = None
+	switchTimestamp = None
+
+	def toMicroseconds(timestamp):
+		return timestamp * 1e6 / timestampFrequency
+
+	for timestamp, event, objectAddress, argument in records:
+		name = lookup(EVENTS, event)
+		if name == 'threadSwitch':
+			if currentThread is not None:
+				events.append({'name': 'running', 'ph': 'X', 'pid': 1, 'tid': '0x{:08x}'.format(currentThread),
+						'ts': toMicroseconds(switchTimestamp), 'dur': toMicroseconds(timestamp - switchTimestamp)})
+			currentThread = objectAddress
+			switchTimestamp = timestamp
+		elif name in ('interruptEntry', 'interruptExit'):
+			events.append({'name': 'interrupt {}'.format(argument), 'ph': 'B' if name == 'interruptEntry' else 'E',
+					'pid': 1, 'tid': 'interrupts', 'ts': toMicroseconds(timestamp)})
+		else:
+			events.append({'name': name, 'ph': 'i', 's': 't', 'pid': 1, 'tid': '0x{:08x}'.format(objectAddress),
+					'ts': toMicroseconds(timestamp), 'args': {'argument': describe(event, argument)}})
+
+	if currentThread is not None and records:
+		events.append({'name': 'running', 'ph': 'X', 'pid': 1, 'tid': '0x{:08x}'.format(currentThread),
+				'ts': toMicroseconds(switchTimestamp), 'dur': toMicroseconds(records[-1][0] - switchTimestamp)})
+
+	json.dump({'traceEvents': events, 'displayTimeUnit': 'ns'}, output, indent=1)
+	output.write('\n')
+
+def main():
+	parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+	parser.add_argument('dump', help='binary dump of distortos::trace::buffer')
+	parser.add_argument('-c', '--chrome', action='store_true', help='write JSON for Chrome\'s trace viewer')
+	parser.add_argument('-o', '--output', help='output file, default - standard output')
+	arguments = parser.parse_args()
+
+	with open(arguments.dump, 'rb') as dump:
+		timestampFrequency, records = readRecords(dump.read())
+
+	output = open(arguments.output, 'w') if arguments.output is not None else sys.stdout
+	try:
+		if arguments.chrome == True:
+			writeChromeTrace(timestampFrequency, records, output)
+		else:
+			writeTimeline(timestampFrequency, records, output)
+	finally:
+		if output is not sys.stdout:
+			output.close()
+
+if __name__ == '__main__':
+	main()
@@ -9,6 +9,8 @@
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include "distortos/architecture/ARMv7-M-setStackGuard.hpp"
+
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
 
@@ -27,6 +29,8 @@ namespace
 /**
  * \brief Wrapper for void* distortos::internal::getScheduler().switchContext(void*)
  *
+ * If MPU stack guard is enabled, it is moved to the stack of new thread.
+ *
  * \param [in] stackPointer is the current value of current thread's stack pointer
  *
  * \return new thread's stack pointer
@@ -34,7 +38,18 @@ namespace
 
 void* schedulerSwitchContextWrapper(void* const stackPointer)
 {
+#ifdef CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+	auto& scheduler = internal::getScheduler();
+	const auto newStackPointer = scheduler.switchContext(stackPointer);
+	architecture::setStackGuard(scheduler.getCurrentThreadControlBlock().getStack());
+	return newStackPointer;
+
+#else	// !def CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
 	return internal::getScheduler().switchContext(stackPointer);
+
+#endif	// !def CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
 }
 
 }	// namespace
@@ -0,0 +1,41 @@
+/**
+ * \file
+ * \brief Parameters of SysTick timer used as the tick timer for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV6_M_ARMV7_M_SYSTICK_HPP_
+#define SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV6_M_ARMV7_M_SYSTICK_HPP_
+
+#include "distortos/chip/clocks.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/// maximal period of SysTick timer, SysTick clock cycles
+constexpr uint32_t maxSysTickPeriod {1 << 24};
+
+/// period of tick if SysTick timer was clocked with core clock, core clock cycles
+constexpr uint32_t sysTickCorePeriod {chip::ahbFrequency / CONFIG_TICK_FREQUENCY};
+
+/// true if SysTick timer is clocked with core clock divided by 8, false if it is clocked with core clock
+constexpr bool sysTickDivideBy8 {sysTickCorePeriod > maxSysTickPeriod};
+
+/// period of tick, SysTick clock cycles
+constexpr uint32_t sysTickPeriod {sysTickDivideBy8 == false ? sysTickCorePeriod : sysTickCorePeriod / 8};
+
+static_assert(sysTickPeriod > 0 && sysTickPeriod <= maxSysTickPeriod, "Invalid SysTick configuration!");
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV6_M_ARMV7_M_SYSTICK_HPP_
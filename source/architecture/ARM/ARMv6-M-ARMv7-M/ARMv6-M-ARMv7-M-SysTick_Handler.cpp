@@ -12,8 +12,12 @@
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
 
+#include "distortos/trace.hpp"
+
 #include "distortos/architecture/requestContextSwitch.hpp"
 
+#include "distortos/chip/CMSIS-proxy.h"
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | global functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -26,7 +30,20 @@
 
 extern "C" void SysTick_Handler()
 {
+#ifdef CONFIG_TRACE_ENABLE
+
+	const auto exceptionNumber = __get_IPSR();
+	distortos::trace::recordInterruptEntry(exceptionNumber);
+
+#endif	// def CONFIG_TRACE_ENABLE
+
 	const auto contextSwitchRequired = distortos::internal::getScheduler().tickInterruptHandler();
 	if (contextSwitchRequired == true)
 		distortos::architecture::requestContextSwitch();
+
+#ifdef CONFIG_TRACE_ENABLE
+
+	distortos::trace::recordInterruptExit(exceptionNumber);
+
+#endif	// def CONFIG_TRACE_ENABLE
 }
@@ -0,0 +1,37 @@
+/**
+ * \file
+ * \brief enterDeepSleep() implementation for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/enterDeepSleep.hpp"
+
+#include "distortos/architecture/waitForInterrupt.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void enterDeepSleep()
+{
+	SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+	waitForInterrupt();
+	SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
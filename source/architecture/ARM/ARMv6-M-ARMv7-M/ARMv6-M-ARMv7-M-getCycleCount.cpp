@@ -0,0 +1,67 @@
+/**
+ * \file
+ * \brief getCycleCount() implementation for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/getCycleCount.hpp"
+
+#include "ARMv6-M-ARMv7-M-SysTick.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#ifdef __ARM_ARCH_6M__
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#endif	// def __ARM_ARCH_6M__
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint32_t getCycleCount()
+{
+#ifndef __ARM_ARCH_6M__
+
+	return DWT->CYCCNT;
+
+#else	// def __ARM_ARCH_6M__
+
+	// ARMv6-M has no DWT cycle counter, so the value is calculated from tick count and SysTick's counter. While tick
+	// interrupt is suppressed in tickless idle mode, period of SysTick is longer than one tick and the counter reaches
+	// zero at the boundary of the tick which is ceil(period / sysTickPeriod) ticks after the last handled one. If the
+	// counter reloaded but tick interrupt was not handled yet, the value read after the reload is used and the period
+	// which just ended is included.
+	const auto period = SysTick->LOAD + 1;
+	auto value = SysTick->VAL;
+	uint32_t pendingCycles {};
+	if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0)
+	{
+		value = SysTick->VAL;
+		pendingCycles = period;
+	}
+
+	const auto periodTicks = (period + sysTickPeriod - 1) / sysTickPeriod;
+	const auto tickCount = static_cast<uint32_t>(internal::getScheduler().getTickCount()) + periodTicks;
+	const auto cycles = tickCount * sysTickPeriod - 1 - value + pendingCycles;
+	return sysTickDivideBy8 == false ? cycles : cycles * 8;
+
+#endif	// def __ARM_ARCH_6M__
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,57 @@
+/**
+ * \file
+ * \brief getHighResolutionTickCount() implementation for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/getHighResolutionTickCount.hpp"
+
+#include "ARMv6-M-ARMv7-M-SysTick.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<uint64_t, uint32_t> getHighResolutionTickCount()
+{
+	// tick count, SysTick's counter and pending state of tick interrupt must be consistent with each other - with
+	// interrupts masked tick count cannot change and tickless idle mode cannot reprogram SysTick
+	const InterruptMaskingLock interruptMaskingLock;
+
+	// if the counter reloaded but tick interrupt was not handled yet, the value read after the reload is used and
+	// pending tick is included
+	auto value = SysTick->VAL;
+	uint64_t pendingTicks {};
+	if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0)
+	{
+		value = SysTick->VAL;
+		pendingTicks = 1;
+	}
+
+	const auto tickCount = internal::getScheduler().getTickCount() + pendingTicks;
+	// SysTick counts down from (sysTickPeriod - 1) to 0, elapsed part is less than 2^24, so there's no overflow
+	const auto elapsed = uint64_t{sysTickPeriod - 1 - value};
+	return {tickCount, static_cast<uint32_t>((elapsed << 32) / sysTickPeriod)};
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief lowLevelInitialization() implementation for ARMv6-M and ARMv7-M
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,6 +11,9 @@
 
 #include "distortos/architecture/lowLevelInitialization.hpp"
 
+#include "distortos/architecture/getInterruptStack.hpp"
+#include "distortos/architecture/paintStack.hpp"
+
 #include "distortos/chip/CMSIS-proxy.h"
 
 namespace distortos
@@ -28,6 +31,29 @@ void lowLevelInitialization()
 #if __FPU_PRESENT == 1 && __FPU_USED == 1
 	SCB->CPACR |= (3 << 10 * 2) | (3 << 11 * 2);	// full access to CP10 and CP11
 #endif	// __FPU_PRESENT == 1 && __FPU_USED == 1
+
+#ifndef __ARM_ARCH_6M__
+
+	// enable DWT cycle counter used by getCycleCount()
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+#endif	// !def __ARM_ARCH_6M__
+
+#ifdef CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+	// stack guard is the only enabled region, privileged accesses to other addresses use default memory map
+	MPU->CTRL = MPU_CTRL_PRIVDEFENA_Msk | MPU_CTRL_ENABLE_Msk;
+	SCB->SHCSR |= SCB_SHCSR_MEMFAULTENA_Msk;
+	__DSB();
+	__ISB();
+
+#endif	// def CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+	// thread mode uses process stack and no exception is active yet, so whole main stack can be painted
+	const auto interruptStack = getInterruptStack();
+	paintStack(interruptStack.first, static_cast<char*>(interruptStack.first) + interruptStack.second);
 }
 
 }	// namespace architecture
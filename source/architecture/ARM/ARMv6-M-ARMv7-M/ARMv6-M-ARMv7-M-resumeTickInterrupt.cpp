@@ -0,0 +1,76 @@
+/**
+ * \file
+ * \brief resumeTickInterrupt() implementation for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/resumeTickInterrupt.hpp"
+
+#include "ARMv6-M-ARMv7-M-SysTick.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint64_t resumeTickInterrupt()
+{
+	SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+	const uint32_t load = SysTick->LOAD;
+	const uint32_t value = SysTick->VAL;
+	const auto expired = (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0;
+
+	// LOAD was set to (toNextBoundary + (suppressedTicks - 1) * sysTickPeriod - 1) in suppressTickInterrupt()
+	const auto period = load + 1;
+	const auto toFirstBoundary = period % sysTickPeriod;
+	// counter is reloaded one cycle after it reaches zero, so value of zero means that the counter has just reached the
+	// end of the period and was not reloaded yet
+	const auto elapsed = value != 0 ? period - value : 0;
+
+	uint64_t ticks;
+	uint32_t sinceLastBoundary;
+	if (expired == true)
+	{
+		// the boundary for which interrupt is pending is handled by tick interrupt, timer was reloaded after it
+		ticks = period / sysTickPeriod + elapsed / sysTickPeriod;
+		sinceLastBoundary = elapsed % sysTickPeriod;
+	}
+	else if (elapsed >= toFirstBoundary)
+	{
+		ticks = 1 + (elapsed - toFirstBoundary) / sysTickPeriod;
+		sinceLastBoundary = (elapsed - toFirstBoundary) % sysTickPeriod;
+	}
+	else
+	{
+		ticks = 0;
+		sinceLastBoundary = sysTickPeriod - (toFirstBoundary - elapsed);
+	}
+
+	// first period is shortened to keep the phase of tick boundaries, following periods use regular reload value;
+	// reload value of 0 would not generate an interrupt, so the shortest first period is 2 SysTick clock cycles
+	SysTick->LOAD = sysTickPeriod - std::min(sinceLastBoundary, sysTickPeriod - 2) - 1;
+	SysTick->VAL = 0;
+	SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+	SysTick->LOAD = sysTickPeriod - 1;
+
+	return ticks;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -11,7 +11,8 @@
 
 #include "distortos/architecture/startScheduling.hpp"
 
-#include "distortos/chip/clocks.hpp"
+#include "ARMv6-M-ARMv7-M-SysTick.hpp"
+
 #include "distortos/chip/CMSIS-proxy.h"
 
 namespace distortos
@@ -39,15 +40,9 @@ void startScheduling()
 	NVIC_SetPriority(SVCall_IRQn, svcallPriority);
 
 	// configure SysTick timer as the tick timer
-	constexpr uint32_t period {chip::ahbFrequency / CONFIG_TICK_FREQUENCY};
-	constexpr uint32_t periodDividedBy8 {period / 8};
-	constexpr uint32_t maxSysTickPeriod {1 << 24};
-	constexpr bool divideBy8 {period > maxSysTickPeriod};
-	// at least one of the periods must be valid
-	static_assert(period <= maxSysTickPeriod || periodDividedBy8 <= maxSysTickPeriod, "Invalid SysTick configuration!");
-	SysTick->LOAD = (divideBy8 == false ? period : periodDividedBy8) - 1;
+	SysTick->LOAD = sysTickPeriod - 1;
 	SysTick->VAL = 0;
-	SysTick->CTRL = (divideBy8 == true ? 0 : SysTick_CTRL_CLKSOURCE_Msk) | SysTick_CTRL_ENABLE_Msk |
+	SysTick->CTRL = (sysTickDivideBy8 == true ? 0 : SysTick_CTRL_CLKSOURCE_Msk) | SysTick_CTRL_ENABLE_Msk |
 			SysTick_CTRL_TICKINT_Msk;
 }
 
@@ -0,0 +1,58 @@
+/**
+ * \file
+ * \brief suppressTickInterrupt() implementation for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/suppressTickInterrupt.hpp"
+
+#include "ARMv6-M-ARMv7-M-SysTick.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool suppressTickInterrupt(const uint64_t ticks)
+{
+	// the longest possible period ends at the tick boundary which can still be reached with 24-bit reload value
+	constexpr uint32_t maxTicks {maxSysTickPeriod / sysTickPeriod};
+	if (ticks < 2 || maxTicks < 2)
+		return false;
+
+	SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+	// tick interrupt is already pending - tick count would not be exact if the timer was reprogrammed now
+	if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0)
+	{
+		SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+		return false;
+	}
+
+	// SysTick clock cycles left until the next tick boundary, this value is always less than sysTickPeriod, so it
+	// can be recovered from the reload value in resumeTickInterrupt(); period of SysTick timer is one cycle longer
+	// than the reload value
+	const auto toNextBoundary = SysTick->VAL;
+	const auto suppressedTicks = ticks < maxTicks ? static_cast<uint32_t>(ticks) : maxTicks;
+	SysTick->LOAD = toNextBoundary + (suppressedTicks - 1) * sysTickPeriod - 1;
+	SysTick->VAL = 0;
+	SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+	return true;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,42 @@
+/**
+ * \file
+ * \brief waitForEvent() implementation for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/waitForEvent.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void waitForEvent()
+{
+	// masked interrupts generate events only with SEVONPEND bit set, and only when they become pending - interrupts
+	// that are already pending are checked explicitly, so the core doesn't sleep with work to do
+	SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+	__DSB();
+
+	if ((SCB->ICSR & (SCB_ICSR_ISRPENDING_Msk | SCB_ICSR_PENDSVSET_Msk | SCB_ICSR_PENDSTSET_Msk)) == 0)
+		__WFE();
+
+	SCB->SCR &= ~SCB_SCR_SEVONPEND_Msk;
+	__ISB();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,55 @@
+/**
+ * \file
+ * \brief waitForInterrupt() implementation for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/waitForInterrupt.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void waitForInterrupt()
+{
+	// WFI is not woken up by interrupts masked with BASEPRI, but it is woken up by interrupts masked with PRIMASK, so
+	// BASEPRI masking is temporarily replaced with PRIMASK masking
+	const auto primask = __get_PRIMASK();
+	__disable_irq();
+
+#if CONFIG_ARCHITECTURE_ARMV7_M_KERNEL_BASEPRI != 0
+
+	const auto basepri = __get_BASEPRI();
+	__set_BASEPRI(0);
+
+#endif	// CONFIG_ARCHITECTURE_ARMV7_M_KERNEL_BASEPRI != 0
+
+	__DSB();
+	__WFI();
+
+#if CONFIG_ARCHITECTURE_ARMV7_M_KERNEL_BASEPRI != 0
+
+	__set_BASEPRI(basepri);
+
+#endif	// CONFIG_ARCHITECTURE_ARMV7_M_KERNEL_BASEPRI != 0
+
+	__set_PRIMASK(primask);
+	__ISB();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
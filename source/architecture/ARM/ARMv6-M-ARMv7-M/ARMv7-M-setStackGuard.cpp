@@ -0,0 +1,128 @@
+/**
+ * \file
+ * \brief setStackGuard() implementation and MemManage_Handler() for ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/ARMv7-M-setStackGuard.hpp"
+
+#ifdef CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+#include "distortos/architecture/Stack.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#if __MPU_PRESENT != 1
+#error "Selected chip has no MPU, so CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE cannot be used!"
+#endif	// __MPU_PRESENT != 1
+
+#include <cstdlib>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// MSTKERR bit of SCB_CFSR - MemManage fault during exception entry stacking
+constexpr uint32_t cfsrMstkerr {1 << 4};
+
+/// MLSPERR bit of SCB_CFSR - MemManage fault during lazy preservation of FPU state
+constexpr uint32_t cfsrMlsperr {1 << 5};
+
+/// MMARVALID bit of SCB_CFSR - SCB_MMFAR holds address of access which caused MemManage fault
+constexpr uint32_t cfsrMmarvalid {1 << 7};
+
+/// value of MPU_RASR for stack guard - read-only for all accesses, execute never, strongly-ordered
+constexpr uint32_t stackGuardRasr {MPU_RASR_XN_Msk | 6 << MPU_RASR_AP_Pos |
+		(31 - __builtin_clz(architecture::stackGuardSize) - 1) << MPU_RASR_SIZE_Pos | MPU_RASR_ENABLE_Msk};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// thread which overflowed its stack, set by MemManage_Handler() - this variable is meant to be examined with debugger
+const Thread* volatile stackOverflowThread;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Gets address of stack guard of provided stack.
+ *
+ * \param [in] stack is a reference to stack
+ *
+ * \return address of stack guard of \a stack
+ */
+
+uintptr_t getStackGuardAddress(const architecture::Stack& stack)
+{
+	return (reinterpret_cast<uintptr_t>(stack.getStorage()) + architecture::stackGuardSize - 1) &
+			~(architecture::stackGuardSize - 1);
+}
+
+}	// namespace
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void setStackGuard(const Stack& stack)
+{
+	const auto address = getStackGuardAddress(stack);
+	const auto fits = address + stackGuardSize <= reinterpret_cast<uintptr_t>(stack.getStackPointer());
+	MPU->RBAR = address | MPU_RBAR_VALID_Msk | stackGuardRegion << MPU_RBAR_REGION_Pos;
+	MPU->RASR = fits == true ? stackGuardRasr : 0;
+	__DSB();
+	__ISB();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief MemManage_Handler() for ARMv7-M
+ *
+ * If the fault was caused by write to stack guard - either by an instruction, during exception entry or during lazy
+ * preservation of FPU state - the thread which overflowed its stack is saved in \a stackOverflowThread. Then the system
+ * is halted by calling abort() with masked interrupts, just like after failed assertion.
+ */
+
+extern "C" void MemManage_Handler()
+{
+	const auto cfsr = SCB->CFSR;
+	auto& threadControlBlock = distortos::internal::getScheduler().getCurrentThreadControlBlock();
+	const auto address = distortos::getStackGuardAddress(threadControlBlock.getStack());
+	const auto stackingError = (cfsr & (distortos::cfsrMstkerr | distortos::cfsrMlsperr)) != 0;
+	const auto guardAccess = (cfsr & distortos::cfsrMmarvalid) != 0 &&
+			SCB->MMFAR - address < distortos::architecture::stackGuardSize;
+	if (stackingError == true || guardAccess == true)
+		distortos::stackOverflowThread = &threadControlBlock.getOwner();
+
+	const distortos::architecture::InterruptMaskingLock interruptMaskingLock;
+	abort();
+}
+
+#endif	// def CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
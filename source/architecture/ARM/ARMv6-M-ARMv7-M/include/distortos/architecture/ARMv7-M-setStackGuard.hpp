@@ -0,0 +1,58 @@
+/**
+ * \file
+ * \brief setStackGuard() declaration for ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_INCLUDE_DISTORTOS_ARCHITECTURE_ARMV7_M_SETSTACKGUARD_HPP_
+#define SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_INCLUDE_DISTORTOS_ARCHITECTURE_ARMV7_M_SETSTACKGUARD_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+class Stack;
+
+/// number of MPU region used as stack guard - region with highest number has highest priority
+constexpr uint8_t stackGuardRegion {7};
+
+/// size of MPU stack guard, bytes
+constexpr size_t stackGuardSize {CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_SIZE};
+
+static_assert(stackGuardSize >= 32 && (stackGuardSize & (stackGuardSize - 1)) == 0,
+		"Invalid CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_SIZE value!");
+
+/**
+ * \brief Moves MPU stack guard to the limit of provided stack.
+ *
+ * Guard region starts at the lowest address of \a stack which is aligned to stackGuardSize. If the guard would overlap
+ * the part of \a stack which is currently used (above its stack pointer), the guard is disabled.
+ *
+ * \attention This function must be called with interrupt masking enabled.
+ *
+ * \param [in] stack is a reference to stack of thread which will be executed
+ */
+
+void setStackGuard(const Stack& stack);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+#endif	// SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_INCLUDE_DISTORTOS_ARCHITECTURE_ARMV7_M_SETSTACKGUARD_HPP_
@@ -11,12 +11,16 @@
 
 #include "distortos/architecture/Stack.hpp"
 
+#include "distortos/architecture/getStackHighWaterMark.hpp"
 #include "distortos/architecture/initializeStack.hpp"
+#include "distortos/architecture/paintStack.hpp"
 #include "distortos/architecture/parameters.hpp"
 
 #include "distortos/internal/memory/dummyDeleter.hpp"
 
-#include <cstring>
+#include "distortos/distortosConfiguration.h"
+
+#include <algorithm>
 
 namespace distortos
 {
@@ -65,7 +69,55 @@ size_t adjustSize(void* const storage, const size_t size, void* const adjustedSt
 }
 
 /**
- * \brief Proxy for initializeStack() which fills stack with 0 before actually initializing it.
+ * \brief Gets size of the part of stack which is painted.
+ *
+ * \param [in] size is the size of stack's storage, bytes
+ *
+ * \return size of the part of stack at its limit (lowest addresses) which is painted, bytes - whole stack
+ * (CONFIG_STACK_PAINTING_FULL), guard band (CONFIG_STACK_PAINTING_GUARD_BAND) or nothing (CONFIG_STACK_PAINTING_NONE)
+ */
+
+size_t getPaintedSize(const size_t size)
+{
+#if defined(CONFIG_STACK_PAINTING_GUARD_BAND)
+	return std::min<size_t>(CONFIG_STACK_PAINTING_GUARD_BAND_SIZE, size);
+#elif defined(CONFIG_STACK_PAINTING_NONE)
+	static_cast<void>(size);	// suppress warning
+	return 0;
+#else	// !defined(CONFIG_STACK_PAINTING_GUARD_BAND) && !defined(CONFIG_STACK_PAINTING_NONE)
+	return size;
+#endif	// !defined(CONFIG_STACK_PAINTING_GUARD_BAND) && !defined(CONFIG_STACK_PAINTING_NONE)
+}
+
+/**
+ * \brief Paints the part of adopted stack which is below current stack pointer.
+ *
+ * The part of adopted stack above current stack pointer is in use, so it cannot be painted. Some margin is left below
+ * the object in the frame of this function, as this function's own calls also use the stack. Painted part is limited
+ * to the size returned by getPaintedSize().
+ *
+ * \param [in] storage is a pointer to stack's storage
+ * \param [in] size is the size of stack's storage, bytes
+ */
+
+__attribute__ ((noinline))
+void paintAdoptedStack(void* const storage, const size_t size)
+{
+	/// margin left below current stack pointer, bytes
+	constexpr size_t margin {256};
+
+	const char marker {};
+	const auto begin = static_cast<char*>(storage);
+	if (&marker < begin + margin || &marker >= begin + size)	// adopted stack is not the current one?
+		return;
+
+	paintStack(begin, std::min<const char*>(&marker - margin, begin + getPaintedSize(size)));
+}
+
+/**
+ * \brief Proxy for initializeStack() which paints stack before actually initializing it.
+ *
+ * Only the part of stack selected with getPaintedSize() is painted - the rest of stack is left uninitialized.
  *
  * \param [in] storage is a pointer to stack's storage
  * \param [in] size is the size of stack's storage, bytes
@@ -80,7 +132,7 @@ size_t adjustSize(void* const storage, const size_t size, void* const adjustedSt
 void* initializeStackProxy(void* const storage, const size_t size, Thread& thread, void (& run)(Thread&),
 		void (* preTerminationHook)(Thread&), void (& terminationHook)(Thread&))
 {
-	memset(storage, 0, size);
+	paintStack(storage, static_cast<char*>(storage) + getPaintedSize(size));
 	return initializeStack(storage, size, thread, run, preTerminationHook, terminationHook);
 }
 
@@ -108,6 +160,8 @@ Stack::Stack(void* const storage, const size_t size) :
 		stackPointer_{}
 {
 	/// \todo implement minimal size check
+
+	paintAdoptedStack(storage, size);
 }
 
 Stack::~Stack()
@@ -115,6 +169,13 @@ Stack::~Stack()
 
 }
 
+size_t Stack::getHighWaterMark() const
+{
+	// part of stack which is not painted is assumed to be used
+	const auto paintedSize = getPaintedSize(adjustedSize_);
+	return getStackHighWaterMark(adjustedStorage_, paintedSize) + adjustedSize_ - paintedSize;
+}
+
 }	// namespace architecture
 
 }	// namespace distortos
@@ -0,0 +1,42 @@
+/**
+ * \file
+ * \brief getStackHighWaterMark() implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/getStackHighWaterMark.hpp"
+
+#include "distortos/architecture/paintStack.hpp"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+size_t getStackHighWaterMark(const void* const storage, const size_t size)
+{
+	const auto begin = static_cast<const uint32_t*>(storage);
+	const auto end = begin + size / sizeof(*begin);
+	const auto used = std::partition_point(begin, end,
+			[](const uint32_t word)
+			{
+				return word == stackSentinel;
+			});
+	return (end - used) * sizeof(*begin);
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,236 @@
+/**
+ * \file
+ * \brief Profiler of interrupt masking - InterruptMaskingLock and InterruptUnmaskingLock with measurement of duration
+ * of sections with interrupt masking enabled
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/statistics.hpp"
+
+#ifdef CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
+
+#include "distortos/architecture/getCycleCount.hpp"
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+#include "distortos/architecture/InterruptUnmaskingLock.hpp"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// statistics of tracked places in code - hash table with open addressing, keyed by call site
+std::array<statistics::InterruptMaskingStatistics, CONFIG_INTERRUPT_MASKING_PROFILER_CALL_SITES> sites;
+
+/// number of sections started in places in code which could not be tracked
+uint32_t untrackedCount;
+
+/// place in code which started currently measured section, nullptr if no section is measured
+const void* currentCallSite;
+
+/// value of architecture::getCycleCount() at the beginning of currently measured section
+uint32_t currentBegin;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Starts measurement of new section, if no section is measured.
+ *
+ * \attention This function must be called with interrupt masking enabled.
+ *
+ * \param [in] callSite is the place in code which starts the section
+ *
+ * \return true if measurement of new section was started, false if a section is already measured
+ */
+
+bool beginSection(const void* const callSite)
+{
+	if (currentCallSite != nullptr)
+		return false;
+
+	currentCallSite = callSite;
+	currentBegin = architecture::getCycleCount();
+	return true;
+}
+
+/**
+ * \brief Finds statistics of given place in code, starting to track it if needed.
+ *
+ * \param [in] callSite is the place in code
+ *
+ * \return pointer to statistics of \a callSite, nullptr if it is not tracked and all entries are already used
+ */
+
+statistics::InterruptMaskingStatistics* findSite(const void* const callSite)
+{
+	// multiplicative hashing, call sites which differ in low bits land in different entries
+	auto index = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(callSite)) * UINT32_C(2654435761) % sites.size();
+	for (size_t i {}; i < sites.size(); ++i)
+	{
+		auto& site = sites[index];
+		if (site.callSite == callSite)
+			return &site;
+		if (site.callSite == nullptr)
+		{
+			site.callSite = callSite;
+			return &site;
+		}
+
+		index = index + 1 < sites.size() ? index + 1 : 0;
+	}
+
+	return nullptr;
+}
+
+/**
+ * \brief Ends measurement of current section and accounts it.
+ *
+ * \attention This function must be called with interrupt masking enabled.
+ *
+ * \return true if a section was measured, false otherwise
+ */
+
+bool endSection()
+{
+	if (currentCallSite == nullptr)
+		return false;
+
+	const auto duration = architecture::getCycleCount() - currentBegin;
+	const auto site = findSite(currentCallSite);
+	currentCallSite = nullptr;
+
+	if (site == nullptr)
+	{
+		++untrackedCount;
+		return true;
+	}
+
+	++site->count;
+	site->totalCycles += duration;
+	if (duration > site->maxCycles)
+		site->maxCycles = duration;
+	const auto bin = duration != 0 ? std::min<size_t>(31 - __builtin_clz(duration), site->histogram.size() - 1) : 0;
+	++site->histogram[bin];
+	return true;
+}
+
+}	// namespace
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+__attribute__ ((noinline))
+InterruptMaskingLock::InterruptMaskingLock() :
+		interruptMask_{enableInterruptMasking()},
+		sectionStarted_{beginSection(__builtin_return_address(0))}
+{
+
+}
+
+InterruptMaskingLock::~InterruptMaskingLock()
+{
+	if (sectionStarted_ == true)
+		endSection();
+
+	restoreInterruptMasking(interruptMask_);
+}
+
+InterruptUnmaskingLock::InterruptUnmaskingLock() :
+		sectionEnded_{endSection()},
+		interruptMask_{disableInterruptMasking()}
+{
+
+}
+
+__attribute__ ((noinline))
+InterruptUnmaskingLock::~InterruptUnmaskingLock()
+{
+	restoreInterruptMasking(interruptMask_);
+
+	// context switch may have happened - the section of resumed thread is accounted to the place which unmasked
+	if (sectionEnded_ == true)
+		beginSection(__builtin_return_address(0));
+}
+
+}	// namespace architecture
+
+namespace statistics
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+size_t getInterruptMaskingStatistics(InterruptMaskingStatistics* const buffer, const size_t size)
+{
+	size_t count {};
+	for (const auto& site : sites)
+	{
+		InterruptMaskingStatistics copy;
+
+		{
+			// InterruptMaskingLock is not used, so that reading statistics does not modify them
+			const auto interruptMask = architecture::enableInterruptMasking();
+			copy = site;
+			architecture::restoreInterruptMasking(interruptMask);
+		}
+
+		if (copy.callSite == nullptr)
+			continue;
+
+		const auto position = std::upper_bound(buffer, buffer + count, copy,
+				[](const InterruptMaskingStatistics& left, const InterruptMaskingStatistics& right)
+				{
+					return left.maxCycles > right.maxCycles;
+				});
+		if (position == buffer + size)	// shorter than all elements in full buffer?
+			continue;
+
+		if (count < size)
+			++count;
+		std::move_backward(position, buffer + count - 1, buffer + count);
+		*position = copy;
+	}
+
+	return count;
+}
+
+uint32_t getUntrackedInterruptMaskingCount()
+{
+	const auto interruptMask = architecture::enableInterruptMasking();
+	const auto count = untrackedCount;
+	architecture::restoreInterruptMasking(interruptMask);
+	return count;
+}
+
+void resetInterruptMaskingStatistics()
+{
+	// all entries are cleared at once, otherwise the chains of hash table would be broken
+	const auto interruptMask = architecture::enableInterruptMasking();
+	sites = {};
+	untrackedCount = {};
+	architecture::restoreInterruptMasking(interruptMask);
+}
+
+}	// namespace statistics
+
+}	// namespace distortos
+
+#endif	// def CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
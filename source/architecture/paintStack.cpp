@@ -0,0 +1,35 @@
+/**
+ * \file
+ * \brief paintStack() implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/paintStack.hpp"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void paintStack(void* const begin, const void* const end)
+{
+	// end may be not aligned - only whole words are painted
+	const auto words = (static_cast<const char*>(end) - static_cast<char*>(begin)) / sizeof(stackSentinel);
+	std::fill_n(static_cast<uint32_t*>(begin), words, stackSentinel);
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,142 @@
+/**
+ * \file
+ * \brief startHighPrecisionTimer() implementation for TIMv1 in STM32, using TIM2
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/startHighPrecisionTimer.hpp"
+
+#include "distortos/architecture/requestContextSwitch.hpp"
+
+#include "distortos/chip/clocks.hpp"
+#include "distortos/chip/CMSIS-proxy.h"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/trace.hpp"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// maximal value of TIM2's counter - TIM2 has only 16 bits in some chips
+constexpr uint32_t maxCounterValue {UINT16_MAX};
+
+/// frequency of TIM2's clock (twice the frequency of APB1 if APB1 prescaler is not 1), Hz
+constexpr uint32_t timerFrequency {chip::apb1Frequency == chip::ahbFrequency ? chip::apb1Frequency :
+		chip::apb1Frequency * 2};
+
+/// prescaler of TIM2, the smallest one with which the range of the counter is longer than one tick
+constexpr uint32_t prescaler {timerFrequency / CONFIG_TICK_FREQUENCY / (maxCounterValue + 1) + 1};
+
+static_assert(prescaler <= UINT16_MAX + 1, "Tick frequency is too low for TIM2's prescaler!");
+
+/// frequency of TIM2's counter, Hz
+constexpr uint32_t counterFrequency {timerFrequency / prescaler};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// true if TIM2 was already configured, false otherwise
+bool initialized;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Configures TIM2 as one-shot timer with update interrupt.
+ *
+ * Update request source is limited to counter overflow, so the update generated here - needed to load the prescaler -
+ * does not set the interrupt flag.
+ */
+
+void initialize()
+{
+	RCC->APB1ENR |= RCC_APB1ENR_TIM2EN;
+	TIM2->CR1 = TIM_CR1_OPM | TIM_CR1_URS;
+	TIM2->PSC = prescaler - 1;
+	TIM2->EGR = TIM_EGR_UG;
+	TIM2->SR = 0;
+	TIM2->DIER = TIM_DIER_UIE;
+	NVIC_SetPriority(TIM2_IRQn, CONFIG_ARCHITECTURE_ARMV7_M_KERNEL_BASEPRI);
+	NVIC_EnableIRQ(TIM2_IRQn);
+	initialized = true;
+}
+
+}	// namespace
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void startHighPrecisionTimer(const HighResolutionClock::duration duration)
+{
+	if (initialized == false)
+		initialize();
+
+	// duration is limited to 1 s before conversion to prevent overflow, the range of the counter is shorter anyway
+	const uint64_t nanoseconds = std::min<uint64_t>(duration.count(), std::nano::den);
+	const auto counts = (nanoseconds * counterFrequency + std::nano::den - 1) / std::nano::den;
+
+	TIM2->CR1 = TIM_CR1_OPM | TIM_CR1_URS;
+	TIM2->SR = 0;
+	TIM2->CNT = 0;
+	// update event is generated when the counter overflows after reaching ARR, ARR = 0 would block the counter
+	TIM2->ARR = std::max<uint64_t>(std::min<uint64_t>(counts, maxCounterValue + 1), 2) - 1;
+	TIM2->CR1 = TIM_CR1_OPM | TIM_CR1_URS | TIM_CR1_CEN;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief TIM2 interrupt handler
+ *
+ * Interrupt of high precision timer.
+ */
+
+extern "C" void TIM2_IRQHandler()
+{
+#ifdef CONFIG_TRACE_ENABLE
+
+	const auto exceptionNumber = __get_IPSR();
+	distortos::trace::recordInterruptEntry(exceptionNumber);
+
+#endif	// def CONFIG_TRACE_ENABLE
+
+	TIM2->SR = 0;
+
+	const auto contextSwitchRequired = distortos::internal::getScheduler().highPrecisionTimerInterruptHandler();
+	if (contextSwitchRequired == true)
+		distortos::architecture::requestContextSwitch();
+
+#ifdef CONFIG_TRACE_ENABLE
+
+	distortos::trace::recordInterruptExit(exceptionNumber);
+
+#endif	// def CONFIG_TRACE_ENABLE
+}
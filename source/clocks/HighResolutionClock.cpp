@@ -0,0 +1,56 @@
+/**
+ * \file
+ * \brief HighResolutionClock class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/HighResolutionClock.hpp"
+
+#include "distortos/architecture/getHighResolutionTickCount.hpp"
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Converts tick count to HighResolutionClock's duration without overflow.
+ *
+ * \param [in] tickCount is the tick count which will be converted
+ *
+ * \return duration equivalent to \a tickCount, rounded down
+ */
+
+HighResolutionClock::rep ticksToDuration(const TickClock::rep tickCount)
+{
+	using Ratio = std::ratio_divide<TickClock::period, HighResolutionClock::period>;
+	return tickCount / Ratio::den * Ratio::num + tickCount % Ratio::den * Ratio::num / Ratio::den;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+HighResolutionClock::time_point HighResolutionClock::now()
+{
+	const auto tickCountAndFraction = architecture::getHighResolutionTickCount();
+	const auto tickCount = tickCountAndFraction.first;
+	const auto begin = ticksToDuration(tickCount);
+	// duration of this tick may differ by 1 from other ticks due to rounding, so the fraction never reaches next tick
+	const auto tickDuration = ticksToDuration(tickCount + 1) - begin;
+	return time_point{duration{begin + ((tickDuration * tickCountAndFraction.second) >> 32)}};
+}
+
+}	// namespace distortos
@@ -0,0 +1,101 @@
+/**
+ * \file
+ * \brief RunnableThreadList class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/RunnableThreadList.hpp"
+
+#include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void RunnableThreadList::erase(const iterator position)
+{
+	eraseInternal(position, position->getEffectivePriority());
+}
+
+void RunnableThreadList::reposition(const iterator position, const uint8_t previousEffectivePriority, const bool front)
+{
+	eraseInternal(position, previousEffectivePriority);
+	insertInternal(*position, front);
+}
+
+void RunnableThreadList::splice(const iterator splicedElement)
+{
+	if (splicedElement->getList() == getThreadList())
+		erase(splicedElement);
+
+	insertInternal(*splicedElement, false);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void RunnableThreadList::eraseInternal(const iterator position, const uint8_t priority)
+{
+	if (groupHeads_[priority] == position)
+	{
+		const auto next = std::next(position);
+		if (next != end() && next->getEffectivePriority() == priority)
+			groupHeads_[priority] = next;
+		else
+		{
+			groupHeads_[priority] = {};
+			priorityBitmap_.reset(priority);
+		}
+	}
+
+	UnsortedIntrusiveList::erase(position);
+}
+
+RunnableThreadList::iterator RunnableThreadList::insertInternal(reference newElement, const bool front)
+{
+	const auto priority = newElement.getEffectivePriority();
+	const auto groupExists = priorityBitmap_.test(priority);
+
+	// the end of the group is the first element of the highest lower-priority group
+	const auto lowerPriority = priorityBitmap_.findHighestBelow(priority);
+	const auto groupEnd = lowerPriority >= 0 ? groupHeads_[lowerPriority] : end();
+
+	const auto earliestDeadlineFirst = newElement.getSchedulingPolicy() == SchedulingPolicy::earliestDeadlineFirst;
+	auto position = groupEnd;
+	if (groupExists == true && (earliestDeadlineFirst == true || front == true))
+	{
+		// threads with earliest-deadline-first policy are kept at the beginning of the group, sorted by deadline, so
+		// other threads linked at the beginning of the group are placed after them
+		const auto deadline = newElement.getDeadline();
+		position = groupHeads_[priority];
+		while (position != groupEnd && position->getSchedulingPolicy() == SchedulingPolicy::earliestDeadlineFirst &&
+				(earliestDeadlineFirst == false || position->getDeadline() <= deadline))
+			++position;
+	}
+
+	const auto insertedElement = UnsortedIntrusiveList::insert(position, newElement);
+
+	if (groupExists == false || position == groupHeads_[priority])
+	{
+		groupHeads_[priority] = insertedElement;
+		priorityBitmap_.set(priority);
+	}
+
+	return insertedElement;
+}
+
+}	// namespace internal
+
+}	// namespace distortos
@@ -11,14 +11,24 @@
 
 #include "distortos/internal/scheduler/Scheduler.hpp"
 
+#include "distortos/idleSleepDepthHook.hpp"
 #include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/trace.hpp"
 
+#include "distortos/architecture/enterDeepSleep.hpp"
+#include "distortos/architecture/getCycleCount.hpp"
 #include "distortos/architecture/InterruptMaskingLock.hpp"
 #include "distortos/architecture/requestContextSwitch.hpp"
+#include "distortos/architecture/resumeTickInterrupt.hpp"
+#include "distortos/architecture/suppressTickInterrupt.hpp"
+#include "distortos/architecture/waitForEvent.hpp"
+#include "distortos/architecture/waitForInterrupt.hpp"
 
 #include "distortos/internal/scheduler/forceContextSwitch.hpp"
 #include "distortos/internal/scheduler/MainThread.hpp"
+#include "distortos/internal/scheduler/ThreadGroupControlBlock.hpp"
 
+#include <atomic>
 #include <cerrno>
 
 namespace distortos
@@ -83,6 +93,46 @@ private:
 
 }	// namespace
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| private function templates
++---------------------------------------------------------------------------------------------------------------------*/
+
+template<typename TimePoint>
+int Scheduler::blockUntilInternal(ThreadList& container, const ThreadState state, const TimePoint timePoint,
+		const ThreadControlBlock::UnblockFunctor* const unblockFunctor)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	const auto iterator = currentThreadControlBlock_;
+
+	if (timePoint <= TimePoint::clock::now())
+	{
+		if (unblockFunctor != nullptr)
+			(*unblockFunctor)(*iterator, ThreadControlBlock::UnblockReason::timeout);
+		return ETIMEDOUT;
+	}
+
+	// This lambda unblocks the thread only if it wasn't already unblocked - this is necessary because double unblock
+	// should be avoided (it could mess the order of threads of the same priority). In that case it also sets
+	// UnblockReason::timeout.
+	auto softwareTimer = makeStaticSoftwareTimer([this, iterator]()
+			{
+				if (iterator->getList() != runnableList_.getThreadList())
+					unblockInternal(iterator, ThreadControlBlock::UnblockReason::timeout);
+			});
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	softwareTimer.setInterruptContext(true);	// timeouts must be handled without delay
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	softwareTimer.setSlack(iterator->getTimerSlack());
+	softwareTimer.start(timePoint);
+
+	return block(container, state, unblockFunctor);
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -138,28 +188,23 @@ int Scheduler::block(ThreadList& container, const ThreadList::iterator iterator,
 int Scheduler::blockUntil(ThreadList& container, const ThreadState state, const TickClock::time_point timePoint,
 		const ThreadControlBlock::UnblockFunctor* const unblockFunctor)
 {
-	architecture::InterruptMaskingLock interruptMaskingLock;
+	return blockUntilInternal(container, state, timePoint, unblockFunctor);
+}
 
-	const auto iterator = currentThreadControlBlock_;
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
 
-	if (timePoint <= TickClock::now())
-	{
-		if (unblockFunctor != nullptr)
-			(*unblockFunctor)(*iterator, ThreadControlBlock::UnblockReason::timeout);
-		return ETIMEDOUT;
-	}
+int Scheduler::blockUntil(ThreadList& container, const ThreadState state,
+		const HighResolutionClock::time_point timePoint, const ThreadControlBlock::UnblockFunctor* const unblockFunctor)
+{
+	return blockUntilInternal(container, state, timePoint, unblockFunctor);
+}
 
-	// This lambda unblocks the thread only if it wasn't already unblocked - this is necessary because double unblock
-	// should be avoided (it could mess the order of threads of the same priority). In that case it also sets
-	// UnblockReason::timeout.
-	auto softwareTimer = makeStaticSoftwareTimer([this, iterator]()
-			{
-				if (iterator->getList() != &runnableList_)
-					unblockInternal(iterator, ThreadControlBlock::UnblockReason::timeout);
-			});
-	softwareTimer.start(timePoint);
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
 
-	return block(container, state, unblockFunctor);
+uint64_t Scheduler::getBudgetOverrunCount() const
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	return budgetOverrunCount_;
 }
 
 uint64_t Scheduler::getContextSwitchCount() const
@@ -168,19 +213,118 @@ uint64_t Scheduler::getContextSwitchCount() const
 	return contextSwitchCount_;
 }
 
+uint64_t Scheduler::getCpuTime(const ThreadControlBlock& threadControlBlock)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	updateCpuTime();
+	return threadControlBlock.getCpuTime();
+}
+
+uint64_t Scheduler::getIdleCpuTime()
+{
+	return idleThreadControlBlock_ != nullptr ? getCpuTime(*idleThreadControlBlock_) : 0;
+}
+
+uint64_t Scheduler::getIdleTickCount() const
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	return idleTickCount_;
+}
+
 uint64_t Scheduler::getTickCount() const
+{
+	uint32_t sequence;
+	uint64_t tickCount;
+	do
+	{
+		// fences prevent the compiler from reordering or merging reads of the variables modified by interrupts
+		sequence = tickCountSequence_;
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+		tickCount = tickCount_;
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+	} while (sequence != tickCountSequence_);
+
+	return tickCount;
+}
+
+uint64_t Scheduler::getTickInterruptCpuTime() const
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	return tickInterruptCpuTime_;
+}
+
+uint64_t Scheduler::getTotalCpuTime()
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
-	return tickCount_;
+	updateCpuTime();
+	return totalCpuTime_;
 }
 
-int Scheduler::initialize(MainThread& mainThread)
+void Scheduler::idle()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (isContextSwitchRequired() == true)
+		return;
+
+	// sleep is not possible when there are other runnable threads (with the same priority as idle thread, for example
+	// threads from throttled thread groups) - let them run immediately instead of waiting for round-robin rotation
+	if (std::next(runnableList_.begin()) != runnableList_.end())
+	{
+		runnableList_.splice(currentThreadControlBlock_);
+		maybeRequestContextSwitch();
+		return;
+	}
+
+	const auto nextTimePoint = softwareTimerSupervisor_.getNextTimePoint();
+	uint64_t ticks {UINT64_MAX};
+	if (nextTimePoint.first == true)
+	{
+		const auto nextTickCount = nextTimePoint.second.time_since_epoch().count();
+		ticks = nextTickCount > tickCount_ ? nextTickCount - tickCount_ : 0;
+	}
+
+	const auto sleepDepth = idleSleepDepthHook != nullptr ? idleSleepDepthHook(TickClock::duration{ticks}) :
+			SleepDepth::waitForInterrupt;
+	if (sleepDepth == SleepDepth::none)
+		return;
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+	const auto tickInterruptSuppressed = architecture::suppressTickInterrupt(ticks);
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
+	if (sleepDepth == SleepDepth::waitForEvent)
+		architecture::waitForEvent();
+	else if (sleepDepth == SleepDepth::deepSleep)
+		architecture::enterDeepSleep();
+	else
+		architecture::waitForInterrupt();
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+	if (tickInterruptSuppressed == true)
+	{
+		// software timers don't have to be checked - none of them expires before the tick for which interrupt is
+		// pending
+		const auto elapsedTicks = architecture::resumeTickInterrupt();
+		tickCount_ += elapsedTicks;
+		++tickCountSequence_;
+		idleTickCount_ += elapsedTicks;
+	}
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+}
+
+int Scheduler::initialize(MainThread& mainThread, const ThreadControlBlock& idleThreadControlBlock)
 {
 	const auto ret = addInternal(mainThread.getThreadControlBlock());
 	if (ret != 0)
 		return ret;
 
 	currentThreadControlBlock_ = runnableList_.begin();
+	idleThreadControlBlock_ = &idleThreadControlBlock;
 
 	return 0;
 }
@@ -203,6 +347,25 @@ int Scheduler::remove()
 	return 0;
 }
 
+void Scheduler::reposition(const ThreadList::iterator iterator, const uint8_t previousEffectivePriority,
+		const bool loweringBefore)
+{
+	runnableList_.reposition(iterator, previousEffectivePriority, loweringBefore);
+}
+
+void Scheduler::requeue(ThreadList& sourceContainer, ThreadList& destinationContainer, const ThreadState state)
+{
+	while (sourceContainer.empty() == false)
+	{
+		const auto iterator = sourceContainer.begin();
+		auto& threadControlBlock = *iterator;
+		destinationContainer.splice(iterator);
+		threadControlBlock.setList(&destinationContainer);
+		threadControlBlock.setState(state);
+		trace::record(trace::Event::threadBlock, &threadControlBlock, static_cast<uint32_t>(state));
+	}
+}
+
 int Scheduler::resume(const ThreadList::iterator iterator)
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
@@ -227,24 +390,47 @@ int Scheduler::suspend(const ThreadList::iterator iterator)
 void* Scheduler::switchContext(void* const stackPointer)
 {
 	++contextSwitchCount_;
+	updateCpuTime();
 	getCurrentThreadControlBlock().getStack().setStackPointer(stackPointer);
 	currentThreadControlBlock_ = runnableList_.begin();
+	trace::record(trace::Event::threadSwitch, &getCurrentThreadControlBlock(),
+			getCurrentThreadControlBlock().getEffectivePriority());
 	getCurrentThreadControlBlock().switchedToHook();
 	return getCurrentThreadControlBlock().getStack().getStackPointer();
 }
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+bool Scheduler::highPrecisionTimerInterruptHandler()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	softwareTimerSupervisor_.highPrecisionTimerInterruptHandler();
+
+	return isContextSwitchRequired();
+}
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 bool Scheduler::tickInterruptHandler()
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
 	++tickCount_;
+	++tickCountSequence_;
+	updateCpuTime();
+
+	if (&getCurrentThreadControlBlock() == idleThreadControlBlock_)
+		++idleTickCount_;
+	else if (getCurrentThreadControlBlock().getThreadGroupControlBlock()->charge() == true)
+		++budgetOverrunCount_;
 
 	getCurrentThreadControlBlock().getRoundRobinQuantum().decrement();
 
 	// if the object is on the "runnable" list, it uses SchedulingPolicy::roundRobin and it used its round-robin
 	// quantum, then do the "rotation": move current thread to the end of same-priority group to implement round-robin
 	// scheduling
-	if (getCurrentThreadControlBlock().getList() == &runnableList_ &&
+	if (getCurrentThreadControlBlock().getList() == runnableList_.getThreadList() &&
 			getCurrentThreadControlBlock().getSchedulingPolicy() == SchedulingPolicy::roundRobin &&
 			getCurrentThreadControlBlock().getRoundRobinQuantum().isZero() == true)
 	{
@@ -254,6 +440,8 @@ bool Scheduler::tickInterruptHandler()
 
 	softwareTimerSupervisor_.tickInterruptHandler(TickClock::time_point{TickClock::duration{tickCount_}});
 
+	tickInterruptCpuTime_ += updateCpuTimeStamp();
+
 	return isContextSwitchRequired();
 }
 
@@ -265,6 +453,16 @@ void Scheduler::unblock(const ThreadList::iterator iterator, const ThreadControl
 	maybeRequestContextSwitch();
 }
 
+void Scheduler::unblockAll(ThreadList& container, const ThreadControlBlock::UnblockReason unblockReason)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	while (container.empty() == false)
+		unblockInternal(container.begin(), unblockReason);
+
+	maybeRequestContextSwitch();
+}
+
 void Scheduler::yield()
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
@@ -284,8 +482,9 @@ int Scheduler::addInternal(ThreadControlBlock& threadControlBlock)
 		return ret;
 
 	runnableList_.insert(threadControlBlock);
-	threadControlBlock.setList(&runnableList_);
+	threadControlBlock.setList(runnableList_.getThreadList());
 	threadControlBlock.setState(ThreadState::runnable);
+	allThreadsList_.push_back(threadControlBlock);
 
 	return 0;
 }
@@ -295,20 +494,22 @@ int Scheduler::blockInternal(ThreadList& container, const ThreadList::iterator i
 {
 	auto& threadControlBlock = *iterator;
 
-	if (threadControlBlock.getList() != &runnableList_)
+	if (threadControlBlock.getList() != runnableList_.getThreadList())
 		return EINVAL;
 
+	runnableList_.erase(iterator);
 	container.splice(iterator);
 	threadControlBlock.setList(&container);
 	threadControlBlock.setState(state);
 	threadControlBlock.blockHook(unblockFunctor);
+	trace::record(trace::Event::threadBlock, &threadControlBlock, static_cast<uint32_t>(state));
 
 	return 0;
 }
 
 bool Scheduler::isContextSwitchRequired() const
 {
-	if (getCurrentThreadControlBlock().getList() != &runnableList_)
+	if (getCurrentThreadControlBlock().getList() != runnableList_.getThreadList())
 		return true;
 
 	if (runnableList_.begin() != currentThreadControlBlock_)	// is there a higher-priority thread available?
@@ -322,9 +523,19 @@ void Scheduler::unblockInternal(const ThreadList::iterator iterator,
 {
 	auto& threadControlBlock = *iterator;
 	runnableList_.splice(iterator);
-	threadControlBlock.setList(&runnableList_);
+	threadControlBlock.setList(runnableList_.getThreadList());
 	threadControlBlock.setState(ThreadState::runnable);
 	threadControlBlock.unblockHook(unblockReason);
+	trace::record(trace::Event::threadUnblock, &threadControlBlock, static_cast<uint32_t>(unblockReason));
+}
+
+uint32_t Scheduler::updateCpuTimeStamp()
+{
+	const auto cycleCount = architecture::getCycleCount();
+	const auto elapsed = cycleCount - cpuTimeStamp_;
+	cpuTimeStamp_ = cycleCount;
+	totalCpuTime_ += elapsed;
+	return elapsed;
 }
 
 }	// namespace internal
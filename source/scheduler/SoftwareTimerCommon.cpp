@@ -37,6 +37,16 @@ int SoftwareTimerCommon::start(const TickClock::time_point timePoint, const Tick
 	return 0;
 }
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+int SoftwareTimerCommon::start(const HighResolutionClock::time_point timePoint)
+{
+	softwareTimerControlBlock_.start(internal::getScheduler().getSoftwareTimerSupervisor(), timePoint);
+	return 0;
+}
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 int SoftwareTimerCommon::stop()
 {
 	softwareTimerControlBlock_.stop();
@@ -22,19 +22,67 @@ namespace distortos
 namespace internal
 {
 
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Applies slack to time point of execution of software timer.
+ *
+ * \param [in] timePoint is the time point at which the function should be executed
+ * \param [in] slack is the slack of software timer
+ *
+ * \return time point from range [timePoint; timePoint + slack] with the most trailing zero bits in tick count
+ */
+
+TickClock::time_point applySlack(const TickClock::time_point timePoint, const TickClock::duration slack)
+{
+	if (slack <= decltype(slack){})
+		return timePoint;
+
+	const auto first = static_cast<uint64_t>(timePoint.time_since_epoch().count());
+	const auto last = first + static_cast<uint64_t>(slack.count());
+	if (last < first)	// overflow?
+		return timePoint;
+
+	// all ticks in the window share the bits above the highest bit which differs between first and last tick, the
+	// coarsest tick in the window has this bit set and all lower bits cleared
+	const auto mask = (uint64_t{1} << (63 - __builtin_clzll(first ^ last))) - 1;
+	return TickClock::time_point{TickClock::duration{static_cast<TickClock::rep>(last & ~mask)}};
+}
+
+}	// namespace
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+SoftwareTimerControlBlock::~SoftwareTimerControlBlock()
+{
+	stop();
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	getScheduler().getSoftwareTimerSupervisor().waitForExecution(*this);
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+}
+
 void SoftwareTimerControlBlock::run(SoftwareTimerSupervisor& supervisor)
 {
 	functionRunner_(owner_);
 
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
 	// was timer restarted in timer's function or is this a one-shot timer?
 	if (node.isLinked() == true || period_ == decltype(period_){})
 		return;
 
-	startInternal(supervisor, getTimePoint() + period_);	// this is a periodic timer, so restart it
+	// this is a periodic timer, so restart it - next period starts at the time point requested before applying slack
+	startInternal(supervisor, getTimePoint() - appliedSlack_ + period_);
 }
 
 void SoftwareTimerControlBlock::start(SoftwareTimerSupervisor& supervisor, const TickClock::time_point timePoint,
@@ -47,6 +95,23 @@ void SoftwareTimerControlBlock::start(SoftwareTimerSupervisor& supervisor, const
 	startInternal(supervisor, timePoint);
 }
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+void SoftwareTimerControlBlock::start(SoftwareTimerSupervisor& supervisor,
+		const HighResolutionClock::time_point timePoint)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	stopInternal();
+	appliedSlack_ = {};
+	const auto tickTimePoint = HighResolutionClock::toTickClock(timePoint);
+	setTimePoint(tickTimePoint);
+	setSubTickOffset((timePoint - HighResolutionClock::fromTickClock(tickTimePoint)).count());
+	supervisor.add(*this);
+}
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 void SoftwareTimerControlBlock::stop()
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
@@ -61,7 +126,16 @@ void SoftwareTimerControlBlock::stop()
 void SoftwareTimerControlBlock::startInternal(SoftwareTimerSupervisor& supervisor,
 		const TickClock::time_point timePoint)
 {
-	setTimePoint(timePoint);
+	const auto slackedTimePoint = applySlack(timePoint, slack_);
+	appliedSlack_ = slackedTimePoint - timePoint;
+	setTimePoint(slackedTimePoint);
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	setSubTickOffset({});
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 	supervisor.add(*this);
 }
 
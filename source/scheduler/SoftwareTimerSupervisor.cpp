@@ -11,37 +11,290 @@
 
 #include "distortos/internal/scheduler/SoftwareTimerSupervisor.hpp"
 
+#include "distortos/trace.hpp"
+
 #include "distortos/internal/scheduler/SoftwareTimerControlBlock.hpp"
 
 #include "distortos/architecture/InterruptMaskingLock.hpp"
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+#include "distortos/architecture/startHighPrecisionTimer.hpp"
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+#include <cassert>
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 namespace distortos
 {
 
 namespace internal
 {
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Gets expiration time point of software timer, including its sub-tick offset.
+ *
+ * \param [in] softwareTimer is a reference to software timer
+ *
+ * \return expiration time point of \a softwareTimer with sub-tick resolution
+ */
+
+HighResolutionClock::time_point getPreciseTimePoint(const SoftwareTimerListNode& softwareTimer)
+{
+	return HighResolutionClock::fromTickClock(softwareTimer.getTimePoint()) +
+			HighResolutionClock::duration{softwareTimer.getSubTickOffset()};
+}
+
+}	// namespace
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
 void SoftwareTimerSupervisor::add(SoftwareTimerControlBlock& softwareTimerControlBlock)
 {
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	// sub-tick expiration time point in the tick which was already handled? high precision timer must be used
+	if (softwareTimerControlBlock.getSubTickOffset() != 0 &&
+			softwareTimerControlBlock.getTimePoint() <= TickClock::now())
+	{
+		preciseList_.insert(softwareTimerControlBlock);
+		startHighPrecisionTimer();
+		return;
+	}
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+#ifdef CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
+
+	activeWheel_.insert(softwareTimerControlBlock);
+
+#else	// !def CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
+
 	activeList_.insert(softwareTimerControlBlock);
+
+#endif	// !def CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
+}
+
+std::pair<bool, TickClock::time_point> SoftwareTimerSupervisor::getNextTimePoint() const
+{
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	if (preciseList_.empty() == false)
+		return {true, preciseList_.begin()->getTimePoint()};
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+#ifdef CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
+
+	return activeWheel_.getNextTimePoint();
+
+#else	// !def CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
+
+	if (activeList_.empty() == true)
+		return {false, {}};
+
+	return {true, activeList_.begin()->getTimePoint()};
+
+#endif	// !def CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
+}
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+void SoftwareTimerSupervisor::highPrecisionTimerInterruptHandler()
+{
+	decltype(preciseList_.begin()) iterator;
+	while (iterator = preciseList_.begin(),
+			iterator != preciseList_.end() && getPreciseTimePoint(*iterator) <= HighResolutionClock::now())
+	{
+		auto& softwareTimer = *iterator;
+		PreciseSoftwareTimerList::erase(iterator);
+		expire(softwareTimer);
+	}
+
+	startHighPrecisionTimer();
+}
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+void SoftwareTimerSupervisor::runPendingSoftwareTimers()
+{
+	while (1)
+	{
+		// software timer thread doesn't receive signals, so the wait cannot be interrupted
+		const auto ret = pendingSemaphore_.wait();
+		assert(ret == 0 && "Unexpected value returned by Semaphore::wait()!");
+
+		// destructor of executed software timer may wait for the end of execution - see waitForExecution()
+		executionMutex_.lock();
+
+		while (1)
+		{
+			SoftwareTimerControlBlock* softwareTimer;
+
+			{
+				architecture::InterruptMaskingLock interruptMaskingLock;
+
+				executingSoftwareTimer_ = nullptr;
+
+				if (pendingList_.empty() == true)
+					break;
+
+				// execution begins when software timer is removed from the list of pending software timers - from
+				// now on stop() only prevents restart of periodic software timer, just like in interrupt context
+				softwareTimer = &pendingList_.front();
+				pendingList_.pop_front();
+				executingSoftwareTimer_ = softwareTimer;
+			}
+
+			softwareTimer->run(*this);
+		}
+
+		executionMutex_.unlock();
+	}
 }
 
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 void SoftwareTimerSupervisor::tickInterruptHandler(const TickClock::time_point timePoint)
 {
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	// software timers handled by high precision timer have expiration time points in previous ticks, so all of them
+	// are already late
+	while (preciseList_.empty() == false)
+	{
+		auto& softwareTimer = preciseList_.front();
+		preciseList_.pop_front();
+		expire(softwareTimer);
+	}
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 	// execute all software timers that reached their time point
+
+#ifdef CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
+
+	SoftwareTimerControlBlock* softwareTimer;
+	while ((softwareTimer = activeWheel_.getExpired(timePoint)) != nullptr)
+		expireOrDefer(*softwareTimer, timePoint);
+
+#else	// !def CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
+
 	decltype(activeList_.begin()) iterator;
 	while (iterator = activeList_.begin(), iterator != activeList_.end() && iterator->getTimePoint() <= timePoint)
 	{
 		auto& softwareTimer = *iterator;
 		SoftwareTimerList::erase(iterator);
-		softwareTimer.run(*this);
+		expireOrDefer(softwareTimer, timePoint);
 	}
+
+#endif	// !def CONFIG_SOFTWARE_TIMER_SUPERVISOR_TIMING_WHEEL
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	startHighPrecisionTimer();
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+}
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+void SoftwareTimerSupervisor::waitForExecution(const SoftwareTimerControlBlock& softwareTimer)
+{
+	{
+		architecture::InterruptMaskingLock interruptMaskingLock;
+
+		if (executingSoftwareTimer_ != &softwareTimer)
+			return;
+	}
+
+	// EDEADLK - called by function of this software timer, executed by software timer thread
+	if (executionMutex_.lock() != 0)
+		return;
+
+	executionMutex_.unlock();
 }
 
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void SoftwareTimerSupervisor::expire(SoftwareTimerControlBlock& softwareTimer)
+{
+	trace::record(trace::Event::softwareTimerExpire, &softwareTimer, {});
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	if (softwareTimer.getInterruptContext() == false)
+	{
+		const auto wasEmpty = pendingList_.empty();
+		pendingList_.push_back(softwareTimer);
+		if (wasEmpty == true)
+			pendingSemaphore_.post();
+		return;
+	}
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	softwareTimer.run(*this);
+}
+
+void SoftwareTimerSupervisor::expireOrDefer(SoftwareTimerControlBlock& softwareTimer,
+		const TickClock::time_point timePoint)
+{
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	// sub-tick expiration time point in current tick? defer it to high precision timer
+	if (softwareTimer.getSubTickOffset() != 0 && softwareTimer.getTimePoint() == timePoint)
+	{
+		preciseList_.insert(softwareTimer);
+		return;
+	}
+
+#else	// !def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	static_cast<void>(timePoint);	// suppress warning
+
+#endif	// !def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	expire(softwareTimer);
+}
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+void SoftwareTimerSupervisor::startHighPrecisionTimer() const
+{
+	if (preciseList_.empty() == true)
+		return;
+
+	const auto timePoint = getPreciseTimePoint(*preciseList_.begin());
+	const auto now = HighResolutionClock::now();
+	architecture::startHighPrecisionTimer(timePoint > now ? timePoint - now : HighResolutionClock::duration{});
+}
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 }	// namespace internal
 
 }	// namespace distortos
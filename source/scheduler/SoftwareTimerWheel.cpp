@@ -0,0 +1,161 @@
+/**
+ * \file
+ * \brief SoftwareTimerWheel class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/SoftwareTimerWheel.hpp"
+
+#include "distortos/internal/scheduler/SoftwareTimerControlBlock.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// mask of bits of expiration tick used to index slots of one level
+constexpr TickClock::rep slotMask {SoftwareTimerWheel::slotsPerLevel - 1};
+
+/// number of bits of expiration tick covered by all levels
+constexpr uint8_t wheelBits {SoftwareTimerWheel::levelBits * SoftwareTimerWheel::levels};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \param [in] softwareTimerControlBlock is a reference to software timer
+ * \param [in] nextTick is the next tick which will be processed
+ *
+ * \return tick in which software timer will be executed - its expiration tick, but not earlier than \a nextTick
+ */
+
+TickClock::rep getExpirationTick(const SoftwareTimerControlBlock& softwareTimerControlBlock,
+		const TickClock::rep nextTick)
+{
+	return std::max(softwareTimerControlBlock.getTimePoint().time_since_epoch().count(), nextTick);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+SoftwareTimerControlBlock* SoftwareTimerWheel::getExpired(const TickClock::time_point timePoint)
+{
+	const auto tick = timePoint.time_since_epoch().count();
+	while (nextTick_ <= tick)
+	{
+		auto& slot = slots_[0][nextTick_ & slotMask];
+		if (slot.empty() == false)
+		{
+			auto& softwareTimerControlBlock = slot.front();
+			slot.pop_front();
+			return &softwareTimerControlBlock;
+		}
+
+		++nextTick_;
+
+		// crossing the boundary of the whole wheel? redistribute software timers from overflow list
+		if ((nextTick_ & ((TickClock::rep{1} << wheelBits) - 1)) == 0)
+			cascade(overflowList_);
+
+		// crossing the boundary of slots of higher levels? redistribute their software timers, starting from the
+		// highest level, as its software timers may be moved to the slot of lower level which is cascaded next
+		for (auto level = levels - 1; level > 0; --level)
+		{
+			const auto shift = levelBits * level;
+			if ((nextTick_ & ((TickClock::rep{1} << shift) - 1)) == 0)
+				cascade(slots_[level][(nextTick_ >> shift) & slotMask]);
+		}
+	}
+
+	return nullptr;
+}
+
+std::pair<bool, TickClock::time_point> SoftwareTimerWheel::getNextTimePoint() const
+{
+	// all software timers in one slot of level 0 expire in the same tick
+	for (auto index = nextTick_ & slotMask; index < slotsPerLevel; ++index)
+		if (slots_[0][index].empty() == false)
+			return {true, TickClock::time_point{TickClock::duration{(nextTick_ & ~slotMask) | index}}};
+
+	// software timers on higher levels expire later than all software timers on lower levels, but software timers in
+	// one slot may expire in different ticks
+	const UnsortedSoftwareTimerList* list {};
+	for (uint8_t level {1}; level < levels && list == nullptr; ++level)
+		for (auto index = (nextTick_ >> (levelBits * level)) & slotMask; index < slotsPerLevel && list == nullptr;
+				++index)
+			if (slots_[level][index].empty() == false)
+				list = &slots_[level][index];
+
+	if (list == nullptr)
+	{
+		if (overflowList_.empty() == true)
+			return {false, {}};
+
+		list = &overflowList_;
+	}
+
+	auto nextTick = std::numeric_limits<TickClock::rep>::max();
+	for (const auto& softwareTimerControlBlock : *list)
+		nextTick = std::min(nextTick, getExpirationTick(softwareTimerControlBlock, nextTick_));
+
+	return {true, TickClock::time_point{TickClock::duration{nextTick}}};
+}
+
+void SoftwareTimerWheel::insert(SoftwareTimerControlBlock& softwareTimerControlBlock)
+{
+	const auto expirationTick = getExpirationTick(softwareTimerControlBlock, nextTick_);
+
+	for (uint8_t level {}; level < levels; ++level)
+	{
+		const auto shift = levelBits * level;
+		if ((expirationTick >> (shift + levelBits)) == (nextTick_ >> (shift + levelBits)))
+		{
+			slots_[level][(expirationTick >> shift) & slotMask].push_back(softwareTimerControlBlock);
+			return;
+		}
+	}
+
+	overflowList_.push_back(softwareTimerControlBlock);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void SoftwareTimerWheel::cascade(UnsortedSoftwareTimerList& list)
+{
+	// software timers from overflow list may be linked in it again, so the list is emptied first
+	UnsortedSoftwareTimerList cascadedList;
+	cascadedList.swap(list);
+
+	while (cascadedList.empty() == false)
+	{
+		auto& softwareTimerControlBlock = cascadedList.front();
+		cascadedList.pop_front();
+		insert(softwareTimerControlBlock);
+	}
+}
+
+}	// namespace internal
+
+}	// namespace distortos
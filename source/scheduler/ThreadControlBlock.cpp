@@ -49,6 +49,13 @@ ThreadControlBlock::ThreadControlBlock(architecture::Stack&& stack, const uint8_
 		{
 				signalsReceiver != nullptr ? &signalsReceiver->signalsReceiverControlBlock_ : nullptr
 		},
+		cpuTime_{},
+		periodBegin_{},
+		deadline_{TickClock::time_point::max()},
+		relativeDeadline_{},
+		period_{},
+		timerSlack_{},
+		deadlineMissCount_{},
 		roundRobinQuantum_{},
 		schedulingPolicy_{schedulingPolicy},
 		state_{ThreadState::created}
@@ -60,6 +67,7 @@ ThreadControlBlock::~ThreadControlBlock()
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
+	allThreadsNode.unlink();
 	_reclaim_reent(&reent_);
 }
 
@@ -77,6 +85,19 @@ int ThreadControlBlock::addHook()
 	return 0;
 }
 
+void ThreadControlBlock::setDeadline(const TickClock::duration relativeDeadline, const TickClock::duration period)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	relativeDeadline_ = relativeDeadline;
+	period_ = period;
+	periodBegin_ = TickClock::now();
+	deadline_ = periodBegin_ + relativeDeadline_;
+
+	if (schedulingPolicy_ == SchedulingPolicy::earliestDeadlineFirst && state_ == ThreadState::runnable)
+		reposition(getEffectivePriority(), false);
+}
+
 void ThreadControlBlock::setPriority(const uint8_t priority, const bool alwaysBehind)
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
@@ -93,7 +114,7 @@ void ThreadControlBlock::setPriority(const uint8_t priority, const bool alwaysBe
 	if (previousEffectivePriority == getEffectivePriority() || threadListNode.isLinked() == false)
 		return;
 
-	reposition(loweringBefore);
+	reposition(previousEffectivePriority, loweringBefore);
 
 	if (priorityInheritanceMutexControlBlock_ != nullptr)
 		priorityInheritanceMutexControlBlock_->getOwner()->updateBoostedPriority();
@@ -103,8 +124,51 @@ void ThreadControlBlock::setSchedulingPolicy(const SchedulingPolicy schedulingPo
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
+	const auto previousSchedulingPolicy = schedulingPolicy_;
 	schedulingPolicy_ = schedulingPolicy;
 	roundRobinQuantum_.reset();
+
+	// order of runnable threads with the same priority depends on earliest-deadline-first policy
+	if (previousSchedulingPolicy != schedulingPolicy &&
+			(previousSchedulingPolicy == SchedulingPolicy::earliestDeadlineFirst ||
+			schedulingPolicy == SchedulingPolicy::earliestDeadlineFirst) && state_ == ThreadState::runnable)
+		reposition(getEffectivePriority(), false);
+}
+
+TickClock::time_point ThreadControlBlock::startNextPeriod()
+{
+	const auto now = TickClock::now();
+	if (now > deadline_)
+		++deadlineMissCount_;
+
+	periodBegin_ = period_ != TickClock::duration{} ? periodBegin_ + period_ : now;
+	deadline_ = periodBegin_ + relativeDeadline_;
+	return periodBegin_;
+}
+
+int ThreadControlBlock::setThreadGroupControlBlock(ThreadGroupControlBlock& threadGroupControlBlock)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (state_ != ThreadState::created)
+		return EINVAL;
+
+	threadGroupControlBlock_ = &threadGroupControlBlock;
+	return 0;
+}
+
+void ThreadControlBlock::setThrottled(const bool throttled)
+{
+	const auto previousEffectivePriority = getEffectivePriority();
+	throttled_ = throttled;
+
+	if (previousEffectivePriority == getEffectivePriority() || threadListNode.isLinked() == false)
+		return;
+
+	reposition(previousEffectivePriority, false);
+
+	if (priorityInheritanceMutexControlBlock_ != nullptr)
+		priorityInheritanceMutexControlBlock_->getOwner()->updateBoostedPriority();
 }
 
 void ThreadControlBlock::unblockHook(const UnblockReason unblockReason)
@@ -138,7 +202,7 @@ void ThreadControlBlock::updateBoostedPriority(const uint8_t boostedPriority)
 
 	const auto loweringBefore = newEffectivePriority < oldEffectivePriority;
 
-	reposition(loweringBefore);
+	reposition(oldEffectivePriority, loweringBefore);
 
 	// this code is placed here, even though it could be moved to ThreadControlBlock::reposition(), simplifying
 	// ThreadControlBlock::setPriority(). This way optimizer can remove recursive calls to this function, reducing
@@ -151,19 +215,29 @@ void ThreadControlBlock::updateBoostedPriority(const uint8_t boostedPriority)
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
-void ThreadControlBlock::reposition(const bool loweringBefore)
+void ThreadControlBlock::reposition(const uint8_t previousEffectivePriority, const bool loweringBefore)
 {
-	const auto oldPriority = priority_;
-
-	if (loweringBefore == true)
-		priority_ = getEffectivePriority() + 1;
-
-	list_->splice(ThreadList::iterator{*this});
-
-	if (loweringBefore == true)
-		priority_ = oldPriority;
+	auto& scheduler = getScheduler();
+
+	// "runnable" list keeps an index of priority groups, so it must be updated with its own function
+	if (state_ == ThreadState::runnable)
+		scheduler.reposition(ThreadList::iterator{*this}, previousEffectivePriority, loweringBefore);
+	else if (loweringBefore == false)
+		list_->splice(ThreadList::iterator{*this});
+	else
+	{
+		// move the thread before all other threads with the same effective priority - the position is found here,
+		// because sorting criteria of the list always place new element after equal ones
+		const ThreadList::iterator iterator {*this};
+		const auto effectivePriority = getEffectivePriority();
+		auto position = list_->begin();
+		while (position != list_->end() &&
+				(position == iterator || position->getEffectivePriority() > effectivePriority))
+			++position;
+		ThreadList::UnsortedIntrusiveList::splice(position, iterator);
+	}
 
-	getScheduler().maybeRequestContextSwitch();
+	scheduler.maybeRequestContextSwitch();
 }
 
 }	// namespace internal
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadGroupControlBlock class implementation
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,10 @@
 
 #include "distortos/internal/scheduler/ThreadControlBlock.hpp"
 
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
 namespace distortos
 {
 
@@ -26,6 +30,61 @@ namespace internal
 void ThreadGroupControlBlock::add(ThreadControlBlock& threadControlBlock)
 {
 	threadList_.push_back(threadControlBlock);
+	threadControlBlock.setThrottled(throttled_);
+}
+
+bool ThreadGroupControlBlock::charge()
+{
+	if (budget_ == TickClock::duration{} || throttled_ == true)
+		return false;
+
+	--remainingBudget_;
+	if (remainingBudget_ > TickClock::duration{})
+		return false;
+
+	++overrunCount_;
+	setThrottled(true);
+	return true;
+}
+
+int ThreadGroupControlBlock::setBudget(const TickClock::duration budget, const TickClock::duration period)
+{
+	if (budget < TickClock::duration{} || (budget != TickClock::duration{} && period <= budget))
+		return EINVAL;
+
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	replenishmentTimer_.stop();
+
+	budget_ = budget;
+	replenish();
+
+	if (budget_ != TickClock::duration{})
+		replenishmentTimer_.start(TickClock::now() + period, period);
+
+	return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void ThreadGroupControlBlock::replenish()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	remainingBudget_ = budget_;
+
+	if (throttled_ == true)
+		setThrottled(false);
+}
+
+void ThreadGroupControlBlock::setThrottled(const bool throttled)
+{
+	throttled_ = throttled;
+
+	for (auto& threadControlBlock : threadList_)
+		threadControlBlock.setThrottled(throttled);
 }
 
 }	// namespace internal
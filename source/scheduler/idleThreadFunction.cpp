@@ -14,7 +14,8 @@
 #include "distortos/internal/memory/DeferredThreadDeleter.hpp"
 #include "distortos/internal/memory/getDeferredThreadDeleter.hpp"
 
-#include <cstdint>
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
 
 namespace distortos
 {
@@ -28,17 +29,15 @@ namespace internal
 
 void idleThreadFunction()
 {
-	volatile uint64_t i {};
-
 	while (1)
 	{
-		++i;
-
 #ifdef CONFIG_THREAD_DETACH_ENABLE
 
 		getDeferredThreadDeleter().tryCleanup();	/// \todo error handling?
 
 #endif	// def CONFIG_THREAD_DETACH_ENABLE
+
+		getScheduler().idle();
 	}
 }
 
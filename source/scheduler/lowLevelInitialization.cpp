@@ -22,6 +22,7 @@
 #include "distortos/internal/scheduler/Scheduler.hpp"
 #include "distortos/internal/scheduler/idleThreadFunction.hpp"
 #include "distortos/internal/scheduler/MainThread.hpp"
+#include "distortos/internal/scheduler/softwareTimerThreadFunction.hpp"
 #include "distortos/internal/scheduler/ThreadGroupControlBlock.hpp"
 
 namespace distortos
@@ -34,7 +35,7 @@ namespace
 {
 
 /*---------------------------------------------------------------------------------------------------------------------+
-| local objects
+| local constants
 +---------------------------------------------------------------------------------------------------------------------*/
 
 /// size of idle thread's stack, bytes
@@ -44,12 +45,45 @@ constexpr size_t idleThreadStackSize {512};
 constexpr size_t idleThreadStackSize {128};
 #endif	// !def CONFIG_THREAD_DETACH_ENABLE
 
-/// type of idle thread
-using IdleThread = decltype(makeStaticThread<idleThreadStackSize>(0, idleThreadFunction));
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// base of IdleThread
+using IdleThreadBase = decltype(makeStaticThread<idleThreadStackSize>(0, idleThreadFunction));
+
+/// IdleThread class is a StaticThread for idle thread with accessible ThreadControlBlock
+class IdleThread : public IdleThreadBase
+{
+public:
+
+	using IdleThreadBase::IdleThreadBase;
+
+	using IdleThreadBase::getThreadControlBlock;
+};
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/// type of software timer thread
+using SoftwareTimerThread = decltype(makeStaticThread<CONFIG_SOFTWARE_TIMER_THREAD_STACK_SIZE>(
+		CONFIG_SOFTWARE_TIMER_THREAD_PRIORITY, SchedulingPolicy::fifo, softwareTimerThreadFunction));
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
 
 /// storage for idle thread instance
 std::aligned_storage<sizeof(IdleThread), alignof(IdleThread)>::type idleThreadStorage;
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/// storage for software timer thread instance
+std::aligned_storage<sizeof(SoftwareTimerThread), alignof(SoftwareTimerThread)>::type softwareTimerThreadStorage;
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 /// storage for main thread instance
 std::aligned_storage<sizeof(MainThread), alignof(MainThread)>::type mainThreadStorage;
 
@@ -97,12 +131,20 @@ void lowLevelInitialization()
 
 	auto& mainThread = *new (&mainThreadStorage) MainThread {CONFIG_MAIN_THREAD_PRIORITY, mainThreadGroupControlBlock,
 			mainThreadStaticSignalsReceiverPointer};
-	schedulerInstance.initialize(mainThread);	/// \todo error handling?
+	auto& idleThread = *new (&idleThreadStorage) IdleThread {0, idleThreadFunction};
+	schedulerInstance.initialize(mainThread, idleThread.getThreadControlBlock());	/// \todo error handling?
 	mainThread.getThreadControlBlock().switchedToHook();
 
-	auto& idleThread = *new (&idleThreadStorage) IdleThread {0, idleThreadFunction};
 	idleThread.start();
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	auto& softwareTimerThread = *new (&softwareTimerThreadStorage) SoftwareTimerThread {
+			CONFIG_SOFTWARE_TIMER_THREAD_PRIORITY, SchedulingPolicy::fifo, softwareTimerThreadFunction};
+	softwareTimerThread.start();
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 	new (&getMallocMutex()) Mutex {Mutex::Type::recursive, Mutex::Protocol::priorityInheritance};
 
 #ifdef CONFIG_THREAD_DETACH_ENABLE
@@ -0,0 +1,38 @@
+/**
+ * \file
+ * \brief softwareTimerThreadFunction() definition
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/softwareTimerThreadFunction.hpp"
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void softwareTimerThreadFunction()
+{
+	getScheduler().getSoftwareTimerSupervisor().runPendingSoftwareTimers();
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
@@ -11,6 +11,10 @@
 
 #include "distortos/statistics.hpp"
 
+#include "distortos/architecture/getInterruptStack.hpp"
+#include "distortos/architecture/getStackHighWaterMark.hpp"
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
 
@@ -24,11 +28,56 @@ namespace statistics
 | global functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+uint64_t getBudgetOverrunCount()
+{
+	return internal::getScheduler().getBudgetOverrunCount();
+}
+
 uint64_t getContextSwitchCount()
 {
 	return internal::getScheduler().getContextSwitchCount();
 }
 
+CpuTimeSnapshot getCpuTimeSnapshot()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	auto& scheduler = internal::getScheduler();
+	return {scheduler.getTotalCpuTime(), scheduler.getIdleCpuTime(), scheduler.getTickInterruptCpuTime()};
+}
+
+uint64_t getIdleTickCount()
+{
+	return internal::getScheduler().getIdleTickCount();
+}
+
+size_t getStackUsage(StackUsage* const buffer, const size_t size)
+{
+	size_t count {};
+
+	{
+		const auto interruptStack = architecture::getInterruptStack();
+		if (count < size)
+			buffer[count] = {nullptr, interruptStack.second,
+					architecture::getStackHighWaterMark(interruptStack.first, interruptStack.second)};
+		++count;
+	}
+
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	for (const auto& threadControlBlock : internal::getScheduler().getAllThreadsList())
+	{
+		if (count < size)
+		{
+			const auto& stack = threadControlBlock.getStack();
+			buffer[count] = {&threadControlBlock.getOwner(), stack.getSize(), stack.getHighWaterMark()};
+		}
+		++count;
+	}
+
+	return count;
+}
+
 }	// namespace statistics
 
 }	// namespace distortos
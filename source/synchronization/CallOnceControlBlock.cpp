@@ -2,7 +2,7 @@
  * \file
  * \brief CallOnceControlBlock class implementation
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -50,8 +50,7 @@ void CallOnceControlBlock::callOnceImplementation(const Functor& functor)
 	done_ = true;
 	blockedList_ = nullptr;
 
-	while (blockedList.empty() == false)
-		getScheduler().unblock(blockedList.begin());
+	getScheduler().unblockAll(blockedList);
 }
 
 }	// namespace internal
@@ -2,7 +2,7 @@
  * \file
  * \brief ConditionVariable class implementation
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -28,11 +28,33 @@ namespace distortos
 +---------------------------------------------------------------------------------------------------------------------*/
 
 void ConditionVariable::notifyAll()
+{
+	internal::getScheduler().unblockAll(blockedList_);
+}
+
+void ConditionVariable::notifyAll(Mutex& mutex)
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
-	while (blockedList_.empty() == false)
-		internal::getScheduler().unblock(blockedList_.begin());
+	auto& mutexControlBlock = mutex.controlBlock_;
+	// threads blocked on mutex with PriorityInheritance protocol would need to boost priority of its owner
+	if (mutexControlBlock.getOwner() != &internal::getScheduler().getCurrentThreadControlBlock() ||
+			mutexControlBlock.getProtocol() == Mutex::Protocol::priorityInheritance)
+	{
+		notifyAll();
+		return;
+	}
+
+	// threads with priority above priority ceiling of mutex with PriorityProtect protocol must get EINVAL from lock()
+	if (mutexControlBlock.getProtocol() == Mutex::Protocol::priorityProtect)
+		for (const auto& threadControlBlock : blockedList_)
+			if (threadControlBlock.getPriority() > mutexControlBlock.getPriorityCeiling())
+			{
+				notifyAll();
+				return;
+			}
+
+	mutexControlBlock.requeue(blockedList_);
 }
 
 void ConditionVariable::notifyOne()
@@ -52,7 +74,14 @@ int ConditionVariable::wait(Mutex& mutex)
 		if (ret != 0)
 			return ret;
 
+		const auto& currentThreadControlBlock = internal::getScheduler().getCurrentThreadControlBlock();
+		// recursive mutex may still be owned by current thread
+		const auto owned = mutex.controlBlock_.getOwner() == &currentThreadControlBlock;
 		internal::getScheduler().block(blockedList_, ThreadState::blockedOnConditionVariable);
+
+		// was the lock transferred to current thread after notifyAll(Mutex&)?
+		if (owned == false && mutex.controlBlock_.getOwner() == &currentThreadControlBlock)
+			return 0;
 	}
 
 	return mutex.lock();
@@ -74,8 +103,15 @@ int ConditionVariable::waitUntil(Mutex& mutex, const TickClock::time_point timeP
 		if (ret != 0)
 			return ret;
 
+		const auto& currentThreadControlBlock = internal::getScheduler().getCurrentThreadControlBlock();
+		// recursive mutex may still be owned by current thread
+		const auto owned = mutex.controlBlock_.getOwner() == &currentThreadControlBlock;
 		blockUntilRet = internal::getScheduler().blockUntil(blockedList_, ThreadState::blockedOnConditionVariable,
 				timePoint);
+
+		// was the lock transferred to current thread after notifyAll(Mutex&)?
+		if (owned == false && mutex.controlBlock_.getOwner() == &currentThreadControlBlock)
+			return 0;
 	}
 
 	const auto ret = mutex.lock();
@@ -0,0 +1,167 @@
+/**
+ * \file
+ * \brief EventFlags class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/EventFlags.hpp"
+
+#include "distortos/internal/synchronization/UnlinkNodeUnblockFunctor.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks whether wait is satisfied.
+ *
+ * \param [in] flags is the value of flags
+ * \param [in] mask selects flags which are waited for
+ * \param [in] waitMode selects whether any or all of selected flags must be set
+ *
+ * \return true if the wait is satisfied by \a flags, false otherwise
+ */
+
+bool isSatisfied(const EventFlags::Flags flags, const EventFlags::Flags mask, const EventFlags::WaitMode waitMode)
+{
+	return waitMode == EventFlags::WaitMode::any ? (flags & mask) != 0 : (flags & mask) == mask;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private function templates
++---------------------------------------------------------------------------------------------------------------------*/
+
+template<typename TimePoint>
+std::pair<int, EventFlags::Flags> EventFlags::waitImplementation(const TimePoint* const timePoint,
+		const bool nonBlocking, const Flags mask, const WaitMode waitMode, const bool clearOnExit)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (mask == 0)
+		return {EINVAL, flags_};
+
+	if (isSatisfied(flags_, mask, waitMode) == true)
+	{
+		const auto flags = flags_;
+		if (clearOnExit == true)
+			flags_ &= ~mask;
+		return {{}, flags};
+	}
+
+	if (nonBlocking == true)
+		return {EAGAIN, flags_};
+
+	auto& scheduler = internal::getScheduler();
+	Waiter waiter {{}, scheduler.getCurrentThreadControlBlock(), mask, {}, waitMode, clearOnExit};
+	waiterList_.push_back(waiter);
+	const internal::UnlinkNodeUnblockFunctor unlinkNodeUnblockFunctor {waiter.node};
+	const auto ret = timePoint == nullptr ?
+			scheduler.block(blockedList_, ThreadState::blockedOnEventFlags, &unlinkNodeUnblockFunctor) :
+			scheduler.blockUntil(blockedList_, ThreadState::blockedOnEventFlags, *timePoint, &unlinkNodeUnblockFunctor);
+	return {ret, ret == 0 ? waiter.flags : flags_};
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+EventFlags::Flags EventFlags::clear(const Flags mask)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	const auto flags = flags_;
+	flags_ &= ~mask;
+	return flags;
+}
+
+EventFlags::Flags EventFlags::set(const Flags mask)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	flags_ |= mask;
+
+	auto& scheduler = internal::getScheduler();
+	Flags clearedFlags {};
+	auto iterator = waiterList_.begin();
+	while (iterator != waiterList_.end())
+	{
+		auto& waiter = *iterator;
+		++iterator;	// waiter is removed from the list when its thread is unblocked
+
+		if (isSatisfied(flags_, waiter.mask, waiter.waitMode) == false)
+			continue;
+
+		waiter.flags = flags_;
+		if (waiter.clearOnExit == true)
+			clearedFlags |= waiter.mask;
+		scheduler.unblock(internal::ThreadList::iterator{waiter.threadControlBlock});
+	}
+
+	flags_ &= ~clearedFlags;
+	return flags_;
+}
+
+std::pair<int, EventFlags::Flags> EventFlags::tryWait(const Flags mask, const WaitMode waitMode,
+		const bool clearOnExit)
+{
+	return waitImplementation(static_cast<const TickClock::time_point*>(nullptr), true, mask, waitMode, clearOnExit);
+}
+
+std::pair<int, EventFlags::Flags> EventFlags::tryWaitFor(const TickClock::duration duration, const Flags mask,
+		const WaitMode waitMode, const bool clearOnExit)
+{
+	return tryWaitUntil(TickClock::now() + duration + TickClock::duration{1}, mask, waitMode, clearOnExit);
+}
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+std::pair<int, EventFlags::Flags> EventFlags::tryWaitForPrecise(const HighResolutionClock::duration duration,
+		const Flags mask, const WaitMode waitMode, const bool clearOnExit)
+{
+	return tryWaitUntilPrecise(HighResolutionClock::now() + duration, mask, waitMode, clearOnExit);
+}
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+std::pair<int, EventFlags::Flags> EventFlags::tryWaitUntil(const TickClock::time_point timePoint, const Flags mask,
+		const WaitMode waitMode, const bool clearOnExit)
+{
+	return waitImplementation(&timePoint, false, mask, waitMode, clearOnExit);
+}
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+std::pair<int, EventFlags::Flags> EventFlags::tryWaitUntilPrecise(const HighResolutionClock::time_point timePoint,
+		const Flags mask, const WaitMode waitMode, const bool clearOnExit)
+{
+	return waitImplementation(&timePoint, false, mask, waitMode, clearOnExit);
+}
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+std::pair<int, EventFlags::Flags> EventFlags::wait(const Flags mask, const WaitMode waitMode, const bool clearOnExit)
+{
+	return waitImplementation(static_cast<const TickClock::time_point*>(nullptr), false, mask, waitMode, clearOnExit);
+}
+
+}	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief FifoQueueBase class implementation
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,8 @@
 
 #include "distortos/architecture/InterruptMaskingLock.hpp"
 
+#include <cerrno>
+
 namespace distortos
 {
 
@@ -31,6 +33,10 @@ FifoQueueBase::FifoQueueBase(StorageUniquePointer&& storageUniquePointer, const
 		storageEnd_{static_cast<uint8_t*>(storageUniquePointer_.get()) + elementSize * maxElements},
 		readPosition_{storageUniquePointer_.get()},
 		writePosition_{storageUniquePointer_.get()},
+		popReservations_{},
+		popPending_{},
+		pushReservations_{},
+		pushPending_{},
 		elementSize_{elementSize}
 {
 
@@ -41,12 +47,37 @@ FifoQueueBase::~FifoQueueBase()
 
 }
 
+int FifoQueueBase::cancel(void* const storage)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (pushReservations_ == 0)
+		return EPERM;
+
+	// slot can be returned only if no other slot was taken on "push" side after it
+	const auto lastStorage = static_cast<const uint8_t*>(writePosition_ != storageUniquePointer_.get() ?
+			writePosition_ : storageEnd_) - elementSize_;
+	if (storage != lastStorage)
+		return EBUSY;
+
+	writePosition_ = storage;
+	--pushReservations_;
+
+	const auto ret = pushSemaphore_.postNInternal(1);
+	if (ret != 0 || pushReservations_ != 0 || pushPending_ == 0)
+		return ret;
+
+	const auto count = pushPending_;
+	pushPending_ = 0;
+	return popSemaphore_.postNInternal(count);
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
 int FifoQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor,
-		Semaphore& waitSemaphore, Semaphore& postSemaphore, void*& storage)
+		Semaphore& waitSemaphore, Semaphore& postSemaphore, void*& storage, const size_t& reservations, size_t& pending)
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
@@ -60,9 +91,89 @@ int FifoQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const Q
 	if (storage >= storageEnd_)
 		storage = storageUniquePointer_.get();
 
+	// publishing is deferred until all outstanding reservations on this side are finished - the number of reservations
+	// must be checked only after the wait, as it could have changed while this thread was blocked
+	if (reservations != 0)
+	{
+		++pending;
+		return 0;
+	}
+
 	return postSemaphore.post();
 }
 
+int FifoQueueBase::popPushN(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor,
+		const size_t count, size_t& transferred, Semaphore& waitSemaphore, Semaphore& postSemaphore, void*& storage,
+		const size_t& reservations, size_t& pending)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	transferred = 0;
+
+	const auto ret = waitSemaphoreFunctor(waitSemaphore);
+	if (ret != 0)
+		return ret;
+
+	const auto available = 1 + waitSemaphore.tryWaitNInternal(count - 1);
+	for (size_t i {}; i < available; ++i)
+	{
+		functor(storage);
+
+		storage = static_cast<uint8_t*>(storage) + elementSize_;
+		if (storage >= storageEnd_)
+			storage = storageUniquePointer_.get();
+	}
+
+	transferred = available;
+
+	// publishing is deferred until all outstanding reservations on this side are finished - the number of reservations
+	// must be checked only after the wait, as it could have changed while this thread was blocked
+	if (reservations != 0)
+	{
+		pending += available;
+		return 0;
+	}
+
+	return postSemaphore.postNInternal(available);
+}
+
+int FifoQueueBase::commitRelease(Semaphore& postSemaphore, size_t& reservations, size_t& pending)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (reservations == 0)
+		return EPERM;
+
+	--reservations;
+	++pending;
+
+	if (reservations != 0)
+		return 0;
+
+	const auto count = pending;
+	pending = 0;
+	return postSemaphore.postNInternal(count);
+}
+
+std::pair<int, void*> FifoQueueBase::reservePeek(const SemaphoreFunctor& waitSemaphoreFunctor,
+		Semaphore& waitSemaphore, void*& storage, size_t& reservations)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = waitSemaphoreFunctor(waitSemaphore);
+	if (ret != 0)
+		return {ret, nullptr};
+
+	const auto slot = storage;
+
+	storage = static_cast<uint8_t*>(storage) + elementSize_;
+	if (storage >= storageEnd_)
+		storage = storageUniquePointer_.get();
+
+	++reservations;
+	return {0, slot};
+}
+
 }	// namespace internal
 
 }	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief MessageQueueBase class implementation
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -64,7 +64,7 @@ public:
 
 		functor_(entry.storage);
 
-		MessageQueueBase::FreeEntryList::splice_after(freeEntryList.before_begin(), entryList.before_begin());
+		entryList.spliceFrontTo(freeEntryList);
 	}
 
 private:
@@ -114,7 +114,7 @@ public:
 
 		functor_(entry.storage);
 
-		entryList.splice_after(freeEntryList.before_begin());
+		entryList.spliceFrontFrom(freeEntryList);
 	}
 
 private:
@@ -128,17 +128,59 @@ private:
 
 }	// namespace
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| MessageQueueBase::EntryList public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void MessageQueueBase::EntryList::spliceFrontFrom(FreeEntryList& freeEntryList)
+{
+	if (priorityBuckets_ == nullptr)
+	{
+		sortedEntryList_.splice_after(freeEntryList.before_begin());
+		return;
+	}
+
+	auto& entry = freeEntryList.front();
+	const auto priority = entry.priority;
+	auto& priorityBitmap = priorityBuckets_->priorityBitmap;
+	auto& lastEntries = priorityBuckets_->lastEntries;
+
+	// new entry goes after the last entry of its own group or - if the group is empty - after the last entry of the
+	// nearest group with higher priority
+	const auto previousPriority = priorityBitmap.test(priority) == true ? static_cast<int>(priority) :
+			priorityBitmap.findLowestAbove(priority);
+	const auto position = previousPriority != -1 ? SortedEntryList::iterator{*lastEntries[previousPriority]} :
+			sortedEntryList_.before_begin();
+	FreeEntryList::splice_after(position, freeEntryList.before_begin());
+
+	lastEntries[priority] = &entry;
+	priorityBitmap.set(priority);
+}
+
+void MessageQueueBase::EntryList::spliceFrontTo(FreeEntryList& freeEntryList)
+{
+	if (priorityBuckets_ != nullptr)
+	{
+		const auto& entry = sortedEntryList_.front();
+		if (priorityBuckets_->lastEntries[entry.priority] == &entry)	// last entry of the group?
+			priorityBuckets_->priorityBitmap.reset(entry.priority);
+	}
+
+	FreeEntryList::splice_after(freeEntryList.before_begin(), sortedEntryList_.before_begin());
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
 MessageQueueBase::MessageQueueBase(EntryStorageUniquePointer&& entryStorageUniquePointer,
-		ValueStorageUniquePointer&& valueStorageUniquePointer, size_t elementSize, size_t maxElements) :
+		ValueStorageUniquePointer&& valueStorageUniquePointer, const size_t elementSize, const size_t maxElements,
+		PriorityBuckets* const priorityBuckets) :
 		popSemaphore_{0, maxElements},
 		pushSemaphore_{maxElements, maxElements},
 		entryStorageUniquePointer_{std::move(entryStorageUniquePointer)},
 		valueStorageUniquePointer_{std::move(valueStorageUniquePointer)},
-		entryList_{},
+		entryList_{priorityBuckets},
 		freeEntryList_{}
 {
 	for (size_t i = 0; i < maxElements; ++i)
@@ -2,7 +2,7 @@
  * \file
  * \brief MutexControlBlock class implementation
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,6 +11,8 @@
 
 #include "distortos/internal/synchronization/MutexControlBlock.hpp"
 
+#include "distortos/trace.hpp"
+
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
 
@@ -128,6 +130,11 @@ void MutexControlBlock::lock()
 		owner_->updateBoostedPriority();
 }
 
+void MutexControlBlock::requeue(ThreadList& blockedList)
+{
+	getScheduler().requeue(blockedList, blockedList_, ThreadState::blockedOnMutex);
+}
+
 void MutexControlBlock::unlockOrTransferLock()
 {
 	auto& oldOwner = *owner_;
@@ -165,6 +172,7 @@ void MutexControlBlock::priorityInheritanceBeforeBlock() const
 void MutexControlBlock::transferLock()
 {
 	owner_ = &blockedList_.front();	// pass ownership to the unblocked thread
+	trace::record(trace::Event::mutexTransferLock, this, reinterpret_cast<uintptr_t>(owner_));
 	getScheduler().unblock(blockedList_.begin());
 
 	if (node.isLinked() == false)
@@ -2,7 +2,7 @@
  * \file
  * \brief RawFifoQueue class implementation
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,6 +11,7 @@
 
 #include "distortos/RawFifoQueue.hpp"
 
+#include "distortos/internal/synchronization/BoundQueueFunctor.hpp"
 #include "distortos/internal/synchronization/MemcpyPopQueueFunctor.hpp"
 #include "distortos/internal/synchronization/MemcpyPushQueueFunctor.hpp"
 #include "distortos/internal/synchronization/SemaphoreWaitFunctor.hpp"
@@ -83,6 +84,106 @@ int RawFifoQueue::tryPushUntil(const TickClock::time_point timePoint, const void
 	return pushInternal(semaphoreTryWaitUntilFunctor, data, size);
 }
 
+std::pair<int, size_t> RawFifoQueue::popN(void* const buffer, const size_t count, const size_t size)
+{
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return popNInternal(semaphoreWaitFunctor, buffer, count, size);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPopN(void* const buffer, const size_t count, const size_t size)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return popNInternal(semaphoreTryWaitFunctor, buffer, count, size);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPopNFor(const TickClock::duration duration, void* const buffer,
+		const size_t count, const size_t size)
+{
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return popNInternal(semaphoreTryWaitForFunctor, buffer, count, size);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPopNUntil(const TickClock::time_point timePoint, void* const buffer,
+		const size_t count, const size_t size)
+{
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return popNInternal(semaphoreTryWaitUntilFunctor, buffer, count, size);
+}
+
+std::pair<int, size_t> RawFifoQueue::pushN(const void* const data, const size_t count, const size_t size)
+{
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return pushNInternal(semaphoreWaitFunctor, data, count, size);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPushN(const void* const data, const size_t count, const size_t size)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return pushNInternal(semaphoreTryWaitFunctor, data, count, size);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPushNFor(const TickClock::duration duration, const void* const data,
+		const size_t count, const size_t size)
+{
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return pushNInternal(semaphoreTryWaitForFunctor, data, count, size);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPushNUntil(const TickClock::time_point timePoint, const void* const data,
+		const size_t count, const size_t size)
+{
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return pushNInternal(semaphoreTryWaitUntilFunctor, data, count, size);
+}
+
+std::pair<int, void*> RawFifoQueue::peek()
+{
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return fifoQueueBase_.peek(semaphoreWaitFunctor);
+}
+
+std::pair<int, void*> RawFifoQueue::tryPeek()
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return fifoQueueBase_.peek(semaphoreTryWaitFunctor);
+}
+
+std::pair<int, void*> RawFifoQueue::tryPeekFor(const TickClock::duration duration)
+{
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return fifoQueueBase_.peek(semaphoreTryWaitForFunctor);
+}
+
+std::pair<int, void*> RawFifoQueue::tryPeekUntil(const TickClock::time_point timePoint)
+{
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return fifoQueueBase_.peek(semaphoreTryWaitUntilFunctor);
+}
+
+std::pair<int, void*> RawFifoQueue::reserve()
+{
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return fifoQueueBase_.reserve(semaphoreWaitFunctor);
+}
+
+std::pair<int, void*> RawFifoQueue::tryReserve()
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return fifoQueueBase_.reserve(semaphoreTryWaitFunctor);
+}
+
+std::pair<int, void*> RawFifoQueue::tryReserveFor(const TickClock::duration duration)
+{
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return fifoQueueBase_.reserve(semaphoreTryWaitForFunctor);
+}
+
+std::pair<int, void*> RawFifoQueue::tryReserveUntil(const TickClock::time_point timePoint)
+{
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return fifoQueueBase_.reserve(semaphoreTryWaitUntilFunctor);
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -107,4 +208,46 @@ int RawFifoQueue::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFu
 	return fifoQueueBase_.push(waitSemaphoreFunctor, memcpyPushQueueFunctor);
 }
 
+std::pair<int, size_t> RawFifoQueue::popNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		void* const buffer, const size_t count, const size_t size)
+{
+	if (count == 0)
+		return {EINVAL, {}};
+
+	if (size != fifoQueueBase_.getElementSize())
+		return {EMSGSIZE, {}};
+
+	auto element = static_cast<uint8_t*>(buffer);
+	const auto memcpyPopNFunctor = internal::makeBoundQueueFunctor(
+			[&element, size](const void* const storage)
+			{
+				memcpy(element, storage, size);
+				element += size;
+			});
+	size_t popped;
+	const auto ret = fifoQueueBase_.popN(waitSemaphoreFunctor, memcpyPopNFunctor, count, popped);
+	return {ret, popped};
+}
+
+std::pair<int, size_t> RawFifoQueue::pushNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		const void* const data, const size_t count, const size_t size)
+{
+	if (count == 0)
+		return {EINVAL, {}};
+
+	if (size != fifoQueueBase_.getElementSize())
+		return {EMSGSIZE, {}};
+
+	auto element = static_cast<const uint8_t*>(data);
+	const auto memcpyPushNFunctor = internal::makeBoundQueueFunctor(
+			[&element, size](void* const storage)
+			{
+				memcpy(storage, element, size);
+				element += size;
+			});
+	size_t pushed;
+	const auto ret = fifoQueueBase_.pushN(waitSemaphoreFunctor, memcpyPushNFunctor, count, pushed);
+	return {ret, pushed};
+}
+
 }	// namespace distortos
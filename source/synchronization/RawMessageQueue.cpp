@@ -2,7 +2,7 @@
  * \file
  * \brief RawMessageQueue class implementation
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -29,9 +29,10 @@ namespace distortos
 +---------------------------------------------------------------------------------------------------------------------*/
 
 RawMessageQueue::RawMessageQueue(EntryStorageUniquePointer&& entryStorageUniquePointer,
-		ValueStorageUniquePointer&& valueStorageUniquePointer, const size_t elementSize, const size_t maxElements) :
+		ValueStorageUniquePointer&& valueStorageUniquePointer, const size_t elementSize, const size_t maxElements,
+		PriorityBuckets* const priorityBuckets) :
 		messageQueueBase_{std::move(entryStorageUniquePointer), std::move(valueStorageUniquePointer), elementSize,
-				maxElements},
+				maxElements, priorityBuckets},
 		elementSize_{elementSize}
 {
 
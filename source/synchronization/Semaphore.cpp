@@ -2,7 +2,7 @@
  * \file
  * \brief Semaphore class implementation
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,6 +11,10 @@
 
 #include "distortos/Semaphore.hpp"
 
+#include "distortos/trace.hpp"
+
+#include "distortos/internal/synchronization/notifyWaitAny.hpp"
+
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
 
@@ -35,10 +39,14 @@ int Semaphore::post()
 	if (blockedList_.empty() == false)
 	{
 		internal::getScheduler().unblock(blockedList_.begin());
+		trace::record(trace::Event::semaphorePost, this, value_);
 		return 0;
 	}
 
 	++value_;
+	trace::record(trace::Event::semaphorePost, this, value_);
+	if (waitAnyCount_ != 0)
+		internal::notifyWaitAny(*this);
 
 	return 0;
 }
@@ -54,6 +62,15 @@ int Semaphore::tryWaitFor(const TickClock::duration duration)
 	return tryWaitUntil(TickClock::now() + duration + TickClock::duration{1});
 }
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+int Semaphore::tryWaitForPrecise(const HighResolutionClock::duration duration)
+{
+	return tryWaitUntilPrecise(HighResolutionClock::now() + duration);
+}
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 int Semaphore::tryWaitUntil(const TickClock::time_point timePoint)
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
@@ -62,9 +79,32 @@ int Semaphore::tryWaitUntil(const TickClock::time_point timePoint)
 	if (ret != EAGAIN)	// lock successful?
 		return ret;
 
-	return internal::getScheduler().blockUntil(blockedList_, ThreadState::blockedOnSemaphore, timePoint);
+	const auto blockRet = internal::getScheduler().blockUntil(blockedList_, ThreadState::blockedOnSemaphore, timePoint);
+	if (blockRet == 0)	// semaphore was passed to this thread by post()?
+		trace::record(trace::Event::semaphoreWait, this, value_);
+
+	return blockRet;
 }
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+int Semaphore::tryWaitUntilPrecise(const HighResolutionClock::time_point timePoint)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = tryWaitInternal();
+	if (ret != EAGAIN)	// lock successful?
+		return ret;
+
+	const auto blockRet = internal::getScheduler().blockUntil(blockedList_, ThreadState::blockedOnSemaphore, timePoint);
+	if (blockRet == 0)	// semaphore was passed to this thread by post()?
+		trace::record(trace::Event::semaphoreWait, this, value_);
+
+	return blockRet;
+}
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 int Semaphore::wait()
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
@@ -73,19 +113,62 @@ int Semaphore::wait()
 	if (ret != EAGAIN)	// lock successful?
 		return ret;
 
-	return internal::getScheduler().block(blockedList_, ThreadState::blockedOnSemaphore);
+	const auto blockRet = internal::getScheduler().block(blockedList_, ThreadState::blockedOnSemaphore);
+	if (blockRet == 0)	// semaphore was passed to this thread by post()?
+		trace::record(trace::Event::semaphoreWait, this, value_);
+
+	return blockRet;
 }
 
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+int Semaphore::postNInternal(Value count)
+{
+	auto& scheduler = internal::getScheduler();
+	while (count != 0 && blockedList_.empty() == false)
+	{
+		scheduler.unblock(blockedList_.begin());
+		--count;
+	}
+
+	if (count == 0)
+	{
+		trace::record(trace::Event::semaphorePost, this, value_);
+		return 0;
+	}
+
+	if (count > maxValue_ - value_)
+		return EOVERFLOW;
+
+	value_ += count;
+	trace::record(trace::Event::semaphorePost, this, value_);
+	if (waitAnyCount_ != 0)
+		internal::notifyWaitAny(*this);
+
+	return 0;
+}
+
+Semaphore::Value Semaphore::tryWaitNInternal(const Value count)
+{
+	const auto decrement = count < value_ ? count : value_;
+	if (decrement == 0)
+		return 0;
+
+	value_ -= decrement;
+	trace::record(trace::Event::semaphoreWait, this, value_);
+
+	return decrement;
+}
+
 int Semaphore::tryWaitInternal()
 {
 	if (value_ == 0)	// lock not possible?
 		return EAGAIN;
 
 	--value_;
+	trace::record(trace::Event::semaphoreWait, this, value_);
 
 	return 0;
 }
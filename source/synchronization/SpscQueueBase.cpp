@@ -0,0 +1,118 @@
+/**
+ * \file
+ * \brief SpscQueueBase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/synchronization/SpscQueueBase.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+SpscQueueBase::SpscQueueBase(StorageUniquePointer&& storageUniquePointer, const size_t elementSize,
+		const size_t maxElements) :
+		popSemaphore_{0, 1},
+		pushSemaphore_{0, 1},
+		storageUniquePointer_{std::move(storageUniquePointer)},
+		elementSize_{elementSize},
+		maxElements_{maxElements},
+		readPosition_{0},
+		writePosition_{0},
+		popWaiting_{false},
+		pushWaiting_{false}
+{
+
+}
+
+SpscQueueBase::~SpscQueueBase()
+{
+
+}
+
+int SpscQueueBase::pop(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor)
+{
+	const auto readPosition = readPosition_.load(std::memory_order_relaxed);
+	// queue is empty when write position is equal to read position
+	const auto ret = wait(waitSemaphoreFunctor, popSemaphore_, popWaiting_, writePosition_, readPosition);
+	if (ret != 0)
+		return ret;
+
+	functor(getStorage(readPosition));
+	readPosition_.store(advance(readPosition), std::memory_order_seq_cst);
+	wake(pushSemaphore_, pushWaiting_);
+	return 0;
+}
+
+int SpscQueueBase::push(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor)
+{
+	const auto writePosition = writePosition_.load(std::memory_order_relaxed);
+	// queue is full when read position is equal to write position "one lap" behind
+	const auto fullReadPosition = writePosition < maxElements_ ? writePosition + maxElements_ :
+			writePosition - maxElements_;
+	const auto ret = wait(waitSemaphoreFunctor, pushSemaphore_, pushWaiting_, readPosition_, fullReadPosition);
+	if (ret != 0)
+		return ret;
+
+	functor(getStorage(writePosition));
+	writePosition_.store(advance(writePosition), std::memory_order_seq_cst);
+	wake(popSemaphore_, popWaiting_);
+	return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int SpscQueueBase::wait(const SemaphoreFunctor& waitSemaphoreFunctor, Semaphore& semaphore,
+		std::atomic<bool>& waiting, const std::atomic<size_t>& otherPosition, const size_t blockingOtherPosition)
+{
+	while (otherPosition.load(std::memory_order_acquire) == blockingOtherPosition)
+	{
+		// the flag must be visible to the other side before the position is checked again, otherwise wake-up could be
+		// lost; stale "post" of the semaphore just causes another iteration of this loop
+		waiting.store(true, std::memory_order_seq_cst);
+		if (otherPosition.load(std::memory_order_seq_cst) != blockingOtherPosition)
+		{
+			waiting.store(false, std::memory_order_relaxed);
+			break;
+		}
+
+		const auto ret = waitSemaphoreFunctor(semaphore);
+		if (ret != 0)
+		{
+			waiting.store(false, std::memory_order_relaxed);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private static functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void SpscQueueBase::wake(Semaphore& semaphore, std::atomic<bool>& waiting)
+{
+	if (waiting.load(std::memory_order_seq_cst) == false)
+		return;
+
+	waiting.store(false, std::memory_order_relaxed);
+	semaphore.post();	// EOVERFLOW (semaphore already posted) is not an error here
+}
+
+}	// namespace internal
+
+}	// namespace distortos
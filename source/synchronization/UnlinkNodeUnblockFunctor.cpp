@@ -0,0 +1,31 @@
+/**
+ * \file
+ * \brief UnlinkNodeUnblockFunctor class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/synchronization/UnlinkNodeUnblockFunctor.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void UnlinkNodeUnblockFunctor::operator()(ThreadControlBlock&, ThreadControlBlock::UnblockReason) const
+{
+	node_.unlink();
+}
+
+}	// namespace internal
+
+}	// namespace distortos
@@ -0,0 +1,190 @@
+/**
+ * \file
+ * \brief WaitAnyObject class and waitAny() implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/waitAny.hpp"
+
+#include "distortos/internal/synchronization/notifyWaitAny.hpp"
+#include "distortos/internal/synchronization/UnlinkNodeUnblockFunctor.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include "distortos/RawFifoQueue.hpp"
+#include "distortos/RawMessageQueue.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// description of wait of thread blocked in waitAny()
+struct Waiter
+{
+	/// node for intrusive list
+	estd::IntrusiveListNode node;
+
+	/// reference to control block of waiting thread
+	internal::ThreadControlBlock& threadControlBlock;
+
+	/// range of objects which are waited for
+	WaitAnyObjects objects;
+};
+
+/// intrusive list of Waiter objects
+using WaiterList = estd::IntrusiveList<Waiter, &Waiter::node>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// list of threads blocked in waitAny()
+WaiterList waiterList;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Implementation of waitAny(), tryWaitAnyFor() and tryWaitAnyUntil()
+ *
+ * Scans \a objects and blocks current thread until any of them becomes "ready". If the object that caused unblocking
+ * is no longer "ready" when the thread is scheduled (because another thread was faster), the thread is blocked again
+ * with the same timeout.
+ *
+ * \tparam TimePoint is the type of time point
+ *
+ * \param [in] timePoint is a pointer to time point at which the wait will be terminated without success, nullptr to
+ * wait without timeout
+ * \param [in] objects is a range of objects which will be waited for
+ *
+ * \return pair with return code (0 on success, error code otherwise) and index of "ready" object in \a objects; error
+ * codes:
+ * - EINVAL - \a objects is empty;
+ * - error codes returned by Scheduler::block() and Scheduler::blockUntil();
+ */
+
+template<typename TimePoint>
+std::pair<int, size_t> waitAnyImplementation(const TimePoint* const timePoint, const WaitAnyObjects objects)
+{
+	if (objects.size() == 0)
+		return {EINVAL, {}};
+
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	auto& scheduler = internal::getScheduler();
+	while (1)
+	{
+		for (size_t i {}; i < objects.size(); ++i)
+			if (objects[i].isReady() == true)
+				return {{}, i};
+
+		const internal::WaitAnyRegistration waitAnyRegistration {objects};
+		Waiter waiter {{}, scheduler.getCurrentThreadControlBlock(), objects};
+		waiterList.push_back(waiter);
+		internal::ThreadList blockedList;
+		const internal::UnlinkNodeUnblockFunctor unlinkNodeUnblockFunctor {waiter.node};
+		const auto ret = timePoint == nullptr ?
+				scheduler.block(blockedList, ThreadState::blockedOnWaitAny, &unlinkNodeUnblockFunctor) :
+				scheduler.blockUntil(blockedList, ThreadState::blockedOnWaitAny, *timePoint, &unlinkNodeUnblockFunctor);
+		if (ret != 0)
+			return {ret, {}};
+	}
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+WaitAnyObject::WaitAnyObject(const RawFifoQueue& rawFifoQueue) :
+		semaphore_{rawFifoQueue.fifoQueueBase_.getPopSemaphore()}
+{
+
+}
+
+WaitAnyObject::WaitAnyObject(const RawMessageQueue& rawMessageQueue) :
+		semaphore_{rawMessageQueue.messageQueueBase_.getPopSemaphore()}
+{
+
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+namespace internal
+{
+
+void notifyWaitAny(const Semaphore& semaphore)
+{
+	auto& scheduler = getScheduler();
+	auto iterator = waiterList.begin();
+	while (iterator != waiterList.end())
+	{
+		auto& waiter = *iterator;
+		++iterator;	// waiter is removed from the list when its thread is unblocked
+
+		for (const auto& object : waiter.objects)
+			if (&object.getSemaphore() == &semaphore)
+			{
+				scheduler.unblock(ThreadList::iterator{waiter.threadControlBlock});
+				break;
+			}
+	}
+}
+
+}	// namespace internal
+
+std::pair<int, size_t> tryWaitAnyFor(const TickClock::duration duration, const WaitAnyObjects objects)
+{
+	return tryWaitAnyUntil(TickClock::now() + duration + TickClock::duration{1}, objects);
+}
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+std::pair<int, size_t> tryWaitAnyForPrecise(const HighResolutionClock::duration duration, const WaitAnyObjects objects)
+{
+	return tryWaitAnyUntilPrecise(HighResolutionClock::now() + duration, objects);
+}
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+std::pair<int, size_t> tryWaitAnyUntil(const TickClock::time_point timePoint, const WaitAnyObjects objects)
+{
+	return waitAnyImplementation(&timePoint, objects);
+}
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+std::pair<int, size_t> tryWaitAnyUntilPrecise(const HighResolutionClock::time_point timePoint,
+		const WaitAnyObjects objects)
+{
+	return waitAnyImplementation(&timePoint, objects);
+}
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+std::pair<int, size_t> waitAny(const WaitAnyObjects objects)
+{
+	return waitAnyImplementation(static_cast<const TickClock::time_point*>(nullptr), objects);
+}
+
+}	// namespace distortos
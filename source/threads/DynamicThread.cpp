@@ -63,6 +63,26 @@ int DynamicThread::generateSignal(const uint8_t signalNumber)
 	return detachableThread_->generateSignal(signalNumber);
 }
 
+uint64_t DynamicThread::getCpuTime() const
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return {};
+
+	return detachableThread_->getCpuTime();
+}
+
+uint32_t DynamicThread::getDeadlineMissCount() const
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return {};
+
+	return detachableThread_->getDeadlineMissCount();
+}
+
 uint8_t DynamicThread::getEffectivePriority() const
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
@@ -93,6 +113,16 @@ uint8_t DynamicThread::getPriority() const
 	return detachableThread_->getPriority();
 }
 
+TickClock::duration DynamicThread::getRoundRobinQuantum() const
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return {};
+
+	return detachableThread_->getRoundRobinQuantum();
+}
+
 SchedulingPolicy DynamicThread::getSchedulingPolicy() const
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
@@ -103,6 +133,26 @@ SchedulingPolicy DynamicThread::getSchedulingPolicy() const
 	return detachableThread_->getSchedulingPolicy();
 }
 
+size_t DynamicThread::getStackHighWaterMark() const
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return {};
+
+	return detachableThread_->getStackHighWaterMark();
+}
+
+size_t DynamicThread::getStackSize() const
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return {};
+
+	return detachableThread_->getStackSize();
+}
+
 ThreadState DynamicThread::getState() const
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
@@ -113,6 +163,16 @@ ThreadState DynamicThread::getState() const
 	return detachableThread_->getState();
 }
 
+TickClock::duration DynamicThread::getTimerSlack() const
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return {};
+
+	return detachableThread_->getTimerSlack();
+}
+
 int DynamicThread::join()
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
@@ -133,6 +193,16 @@ int DynamicThread::queueSignal(const uint8_t signalNumber, const sigval value)
 	return detachableThread_->queueSignal(signalNumber, value);
 }
 
+void DynamicThread::setDeadline(const TickClock::duration relativeDeadline, const TickClock::duration period)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return;
+
+	detachableThread_->setDeadline(relativeDeadline, period);
+}
+
 void DynamicThread::setPriority(const uint8_t priority, const bool alwaysBehind)
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
@@ -143,6 +213,16 @@ void DynamicThread::setPriority(const uint8_t priority, const bool alwaysBehind)
 	detachableThread_->setPriority(priority, alwaysBehind);
 }
 
+int DynamicThread::setRoundRobinQuantum(const TickClock::duration roundRobinQuantum)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return EINVAL;
+
+	return detachableThread_->setRoundRobinQuantum(roundRobinQuantum);
+}
+
 void DynamicThread::setSchedulingPolicy(const SchedulingPolicy schedulingPolicy)
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
@@ -153,6 +233,26 @@ void DynamicThread::setSchedulingPolicy(const SchedulingPolicy schedulingPolicy)
 	detachableThread_->setSchedulingPolicy(schedulingPolicy);
 }
 
+int DynamicThread::setThreadGroup(ThreadGroup& threadGroup)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return EINVAL;
+
+	return detachableThread_->setThreadGroup(threadGroup);
+}
+
+void DynamicThread::setTimerSlack(const TickClock::duration timerSlack)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return;
+
+	detachableThread_->setTimerSlack(timerSlack);
+}
+
 int DynamicThread::start()
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
@@ -16,6 +16,8 @@
 
 #include "distortos/Thread.hpp"
 
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
 #include <cerrno>
 
 namespace distortos
@@ -62,6 +64,15 @@ int sleepFor(const TickClock::duration duration)
 	return sleepUntil(TickClock::now() + duration + TickClock::duration{1});
 }
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+int sleepForPrecise(const HighResolutionClock::duration duration)
+{
+	return sleepUntilPrecise(HighResolutionClock::now() + duration);
+}
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
 int sleepUntil(const TickClock::time_point timePoint)
 {
 	auto& scheduler = internal::getScheduler();
@@ -70,6 +81,32 @@ int sleepUntil(const TickClock::time_point timePoint)
 	return ret == ETIMEDOUT ? 0 : ret;
 }
 
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+int sleepUntilPrecise(const HighResolutionClock::time_point timePoint)
+{
+	auto& scheduler = internal::getScheduler();
+	internal::ThreadList sleepingList;
+	const auto ret = scheduler.blockUntil(sleepingList, ThreadState::sleeping, timePoint);
+	return ret == ETIMEDOUT ? 0 : ret;
+}
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+int waitForNextPeriod()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	auto& scheduler = internal::getScheduler();
+	const auto nextPeriodBegin = scheduler.getCurrentThreadControlBlock().startNextPeriod();
+	if (nextPeriodBegin > TickClock::now())
+		return sleepUntil(nextPeriodBegin);
+
+	// deadline was changed, so position on the list of runnable threads must be updated
+	scheduler.yield();
+	return 0;
+}
+
 void yield()
 {
 	internal::getScheduler().yield();
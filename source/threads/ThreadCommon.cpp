@@ -11,6 +11,8 @@
 
 #include "distortos/ThreadCommon.hpp"
 
+#include "distortos/ThreadGroup.hpp"
+
 #include "distortos/architecture/InterruptMaskingLock.hpp"
 
 #include "distortos/internal/scheduler/getScheduler.hpp"
@@ -51,6 +53,17 @@ int ThreadCommon::generateSignal(const uint8_t signalNumber)
 	return signalsReceiverControlBlock->generateSignal(signalNumber, threadControlBlock);
 }
 
+uint64_t ThreadCommon::getCpuTime() const
+{
+	return internal::getScheduler().getCpuTime(getThreadControlBlock());
+}
+
+uint32_t ThreadCommon::getDeadlineMissCount() const
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	return getThreadControlBlock().getDeadlineMissCount();
+}
+
 uint8_t ThreadCommon::getEffectivePriority() const
 {
 	return getThreadControlBlock().getEffectivePriority();
@@ -71,16 +84,38 @@ uint8_t ThreadCommon::getPriority() const
 	return getThreadControlBlock().getPriority();
 }
 
+TickClock::duration ThreadCommon::getRoundRobinQuantum() const
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	return getThreadControlBlock().getRoundRobinQuantum().getLength();
+}
+
 SchedulingPolicy ThreadCommon::getSchedulingPolicy() const
 {
 	return getThreadControlBlock().getSchedulingPolicy();
 }
 
+size_t ThreadCommon::getStackHighWaterMark() const
+{
+	return getThreadControlBlock().getStack().getHighWaterMark();
+}
+
+size_t ThreadCommon::getStackSize() const
+{
+	return getThreadControlBlock().getStack().getSize();
+}
+
 ThreadState ThreadCommon::getState() const
 {
 	return getThreadControlBlock().getState();
 }
 
+TickClock::duration ThreadCommon::getTimerSlack() const
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	return getThreadControlBlock().getTimerSlack();
+}
+
 int ThreadCommon::join()
 {
 	if (&getThreadControlBlock() == &internal::getScheduler().getCurrentThreadControlBlock())
@@ -101,16 +136,45 @@ int ThreadCommon::queueSignal(const uint8_t signalNumber, const sigval value)
 	return signalsReceiverControlBlock->queueSignal(signalNumber, value, threadControlBlock);
 }
 
+void ThreadCommon::setDeadline(const TickClock::duration relativeDeadline, const TickClock::duration period)
+{
+	getThreadControlBlock().setDeadline(relativeDeadline, period);
+}
+
 void ThreadCommon::setPriority(const uint8_t priority, const bool alwaysBehind)
 {
 	getThreadControlBlock().setPriority(priority, alwaysBehind);
 }
 
+int ThreadCommon::setRoundRobinQuantum(const TickClock::duration roundRobinQuantum)
+{
+	using internal::RoundRobinQuantum;
+
+	if (roundRobinQuantum < TickClock::duration{} || roundRobinQuantum > RoundRobinQuantum::getMax())
+		return EINVAL;
+
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	getThreadControlBlock().getRoundRobinQuantum().setLength(roundRobinQuantum != TickClock::duration{} ?
+			RoundRobinQuantum::Duration{roundRobinQuantum.count()} : RoundRobinQuantum::getInitial());
+	return 0;
+}
+
 void ThreadCommon::setSchedulingPolicy(const SchedulingPolicy schedulingPolicy)
 {
 	getThreadControlBlock().setSchedulingPolicy(schedulingPolicy);
 }
 
+int ThreadCommon::setThreadGroup(ThreadGroup& threadGroup)
+{
+	return getThreadControlBlock().setThreadGroupControlBlock(threadGroup.threadGroupControlBlock_);
+}
+
+void ThreadCommon::setTimerSlack(const TickClock::duration timerSlack)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	getThreadControlBlock().setTimerSlack(timerSlack);
+}
+
 int ThreadCommon::start()
 {
 	return internal::getScheduler().add(getThreadControlBlock());
@@ -0,0 +1,72 @@
+/**
+ * \file
+ * \brief trace API implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/trace.hpp"
+
+#ifdef CONFIG_TRACE_ENABLE
+
+#include "distortos/architecture/getCycleCount.hpp"
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include "distortos/chip/clocks.hpp"
+
+namespace distortos
+{
+
+namespace trace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+Buffer buffer
+{
+		Buffer::magicValue,
+		Buffer::versionValue,
+		sizeof(Record),
+		CONFIG_TRACE_BUFFER_SIZE,
+		chip::ahbFrequency,
+		{},
+		{},
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void record(const Event event, const void* const object, const uint32_t argument)
+{
+	uint32_t index;
+	uint32_t timestamp;
+
+	{
+		architecture::InterruptMaskingLock interruptMaskingLock;
+		index = buffer.writeIndex++;
+		timestamp = architecture::getCycleCount();
+	}
+
+	auto& record = buffer.records[index % buffer.records.size()];
+	record.timestamp = timestamp;
+	record.object = reinterpret_cast<uintptr_t>(object);
+	record.argument = argument;
+	record.event = event;
+	record.reserved = {};
+	// sequence must be written last, so that the reader can detect records which are incomplete
+	asm volatile ("" ::: "memory");
+	record.sequence = static_cast<uint16_t>(index);
+}
+
+}	// namespace trace
+
+}	// namespace distortos
+
+#endif	// def CONFIG_TRACE_ENABLE
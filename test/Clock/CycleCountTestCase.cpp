@@ -0,0 +1,100 @@
+/**
+ * \file
+ * \brief CycleCountTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "CycleCountTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/architecture/getCycleCount.hpp"
+
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of ticks in which number of cycles in a tick is measured
+constexpr TickClock::duration measurementDuration {10};
+
+/// durations of sleep, the longest one exceeds the longest period of suppressed tick interrupt of typical chips
+constexpr TickClock::duration sleepDurations[]
+{
+		TickClock::duration{1},
+		TickClock::duration{2},
+		TickClock::duration{10},
+		TickClock::duration{150},
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Measures number of cycles in a tick while test thread is busy.
+ *
+ * \return number of core clock cycles in a tick
+ */
+
+uint32_t measureCyclesPerTick()
+{
+	waitForNextTick();
+
+	const auto start = TickClock::now() + TickClock::duration{1};
+	while (TickClock::now() < start);
+	const auto startCycles = architecture::getCycleCount();
+
+	while (TickClock::now() < start + measurementDuration);
+	const auto cycles = architecture::getCycleCount() - startCycles;
+
+	return cycles / measurementDuration.count();
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool CycleCountTestCase::run_() const
+{
+	const auto cyclesPerTick = measureCyclesPerTick();
+	if (cyclesPerTick == 0)
+		return false;
+
+	for (const auto sleepDuration : sleepDurations)
+	{
+		waitForNextTick();
+
+		const auto start = TickClock::now();
+		const auto startCycles = architecture::getCycleCount();
+		const auto ret = ThisThread::sleepUntil(start + sleepDuration);
+		const auto cycles = architecture::getCycleCount() - startCycles;
+		const auto elapsedTicks = (TickClock::now() - start).count();
+
+		if (ret != 0 || cycles == 0 || cycles > (elapsedTicks + 1) * cyclesPerTick)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
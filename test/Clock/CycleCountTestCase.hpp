@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief CycleCountTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_CLOCK_CYCLECOUNTTESTCASE_HPP_
+#define TEST_CLOCK_CYCLECOUNTTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests architecture::getCycleCount() across sleep of idle thread.
+ *
+ * Number of core clock cycles in a tick is measured while test thread is busy. Then test thread sleeps for various
+ * durations (so that tick interrupt may be suppressed in tickless idle mode) - cycle count read after each sleep must
+ * be greater than the one read before it, and the difference must not exceed the number of cycles in elapsed ticks
+ * (with a margin of one tick). Core clock may be stopped during sleep, so the difference is not required to match
+ * the duration of sleep.
+ */
+
+class CycleCountTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_CLOCK_CYCLECOUNTTESTCASE_HPP_
@@ -0,0 +1,185 @@
+/**
+ * \file
+ * \brief HighPrecisionTimerTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "HighPrecisionTimerTestCase.hpp"
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/HighResolutionClock.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+namespace distortos
+{
+
+namespace test
+{
+
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// duration of one tick
+constexpr auto tickDuration = std::chrono::duration_cast<HighResolutionClock::duration>(TickClock::duration{1});
+
+/// tested durations of waits
+const HighResolutionClock::duration durations[]
+{
+		tickDuration / 4,
+		tickDuration / 2,
+		tickDuration * 3 / 4,
+		tickDuration * 3 / 2,
+};
+
+/// maximal accepted latency of expiration
+constexpr HighResolutionClock::duration maxLatency {std::chrono::microseconds{100}};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks whether expiration time point is correct.
+ *
+ * \param [in] expected is the requested time point of expiration
+ * \param [in] actual is the time point at which the expiration was detected
+ *
+ * \return true if \a actual is not earlier than \a expected and not later than \a expected + maxLatency
+ */
+
+bool checkExpiration(const HighResolutionClock::time_point expected, const HighResolutionClock::time_point actual)
+{
+	return actual >= expected && actual - expected <= maxLatency;
+}
+
+/**
+ * \brief Tests ThisThread::sleepUntilPrecise() and ThisThread::sleepForPrecise().
+ *
+ * Additionally checks that template variant of ThisThread::sleepFor() keeps tick resolution for sub-tick durations.
+ *
+ * \param [in] duration is the duration of sleep
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testSleep(const HighResolutionClock::duration duration)
+{
+	{
+		waitForNextTick();
+		const auto timePoint = HighResolutionClock::now() + duration;
+		if (ThisThread::sleepUntilPrecise(timePoint) != 0)
+			return false;
+		if (checkExpiration(timePoint, HighResolutionClock::now()) == false)
+			return false;
+	}
+	{
+		waitForNextTick();
+		const auto start = HighResolutionClock::now();
+		if (ThisThread::sleepForPrecise(duration) != 0)
+			return false;
+		if (checkExpiration(start + duration, HighResolutionClock::now()) == false)
+			return false;
+	}
+	{
+		// sub-tick precision must be requested explicitly - one additional tick is added as usual
+		waitForNextTick();
+		const auto start = TickClock::now();
+		if (ThisThread::sleepFor(std::chrono::nanoseconds{duration}) != 0)
+			return false;
+		if (TickClock::now() < start + TickClock::duration{1})
+			return false;
+	}
+	return true;
+}
+
+/**
+ * \brief Tests timeout of Semaphore::tryWaitForPrecise().
+ *
+ * \param [in] duration is the duration of timeout
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testSemaphore(const HighResolutionClock::duration duration)
+{
+	Semaphore semaphore {0};
+	waitForNextTick();
+	const auto start = HighResolutionClock::now();
+	if (semaphore.tryWaitForPrecise(duration) != ETIMEDOUT)
+		return false;
+	return checkExpiration(start + duration, HighResolutionClock::now());
+}
+
+/**
+ * \brief Tests software timer started with HighResolutionClock's time point.
+ *
+ * \param [in] duration is the duration after which the software timer expires
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testSoftwareTimer(const HighResolutionClock::duration duration)
+{
+	HighResolutionClock::time_point expiration {};
+	auto softwareTimer = makeStaticSoftwareTimer([&expiration]()
+			{
+				expiration = HighResolutionClock::now();
+			});
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	softwareTimer.setInterruptContext(true);
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	waitForNextTick();
+	const auto timePoint = HighResolutionClock::now() + duration;
+	softwareTimer.start(timePoint);
+	ThisThread::sleepUntil(HighResolutionClock::toTickClock(timePoint) + TickClock::duration{2});
+	return softwareTimer.isRunning() == false && checkExpiration(timePoint, expiration);
+}
+
+}	// namespace
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool HighPrecisionTimerTestCase::run_() const
+{
+#ifdef CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	for (const auto duration : durations)
+		if (testSleep(duration) == false || testSemaphore(duration) == false || testSoftwareTimer(duration) == false)
+			return false;
+
+#endif	// def CONFIG_HIGH_PRECISION_TIMER_ENABLE
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
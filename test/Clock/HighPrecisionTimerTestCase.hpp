@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief HighPrecisionTimerTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_CLOCK_HIGHPRECISIONTIMERTESTCASE_HPP_
+#define TEST_CLOCK_HIGHPRECISIONTIMERTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests sub-tick precision of sleeps, timeouts and software timers handled by high precision timer.
+ *
+ * Sleeps, semaphore timeouts and software timers with durations which are fractions of tick must expire not earlier
+ * than requested and with latency much smaller than one tick. Template variant of ThisThread::sleepFor() must keep tick
+ * resolution for such durations.
+ *
+ * \note If high precision timer is not enabled, this test case does nothing.
+ */
+
+class HighPrecisionTimerTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_CLOCK_HIGHPRECISIONTIMERTESTCASE_HPP_
@@ -0,0 +1,103 @@
+/**
+ * \file
+ * \brief HighResolutionClockTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "HighResolutionClockTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/HighResolutionClock.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of ticks during which HighResolutionClock is tested
+constexpr TickClock::duration testDuration {5};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests conversions between time points of HighResolutionClock and TickClock.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testConversions()
+{
+	const auto tickClockTimePoint = TickClock::now();
+	const auto highResolutionClockTimePoint = HighResolutionClock::fromTickClock(tickClockTimePoint);
+	if (HighResolutionClock::toTickClock(highResolutionClockTimePoint) != tickClockTimePoint)
+		return false;
+
+	// any time point in the tick is converted to this tick
+	const auto lastInTick = HighResolutionClock::fromTickClock(tickClockTimePoint + TickClock::duration{1}) -
+			HighResolutionClock::duration{1};
+	return HighResolutionClock::toTickClock(lastInTick) == tickClockTimePoint;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool HighResolutionClockTestCase::run_() const
+{
+	if (testConversions() == false)
+		return false;
+
+	waitForNextTick();
+	const auto end = TickClock::now() + testDuration;
+	auto previous = HighResolutionClock::now();
+	auto previousTick = HighResolutionClock::toTickClock(previous);
+	size_t valuesInTick {1};
+	size_t maxValuesInTick {};
+	while (previousTick < end)
+	{
+		const auto before = TickClock::now();
+		const auto now = HighResolutionClock::now();
+		const auto after = TickClock::now();
+
+		const auto tick = HighResolutionClock::toTickClock(now);
+		if (now < previous || tick < before || tick > after)
+			return false;
+
+		if (tick != previousTick)
+		{
+			valuesInTick = 0;
+			previousTick = tick;
+		}
+		if (now != previous)
+			++valuesInTick;
+		if (valuesInTick > maxValuesInTick)
+			maxValuesInTick = valuesInTick;
+
+		previous = now;
+	}
+
+	// resolution must be better than one tick
+	return maxValuesInTick > 1;
+}
+
+}	// namespace test
+
+}	// namespace distortos
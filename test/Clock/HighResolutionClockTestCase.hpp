@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief HighResolutionClockTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_CLOCK_HIGHRESOLUTIONCLOCKTESTCASE_HPP_
+#define TEST_CLOCK_HIGHRESOLUTIONCLOCKTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests HighResolutionClock.
+ *
+ * HighResolutionClock::now() is called repeatedly for several ticks - values must never decrease, must always be in
+ * the tick returned by TickClock::now() and there must be more than one value in a tick. Conversions between time
+ * points of HighResolutionClock and TickClock are also tested.
+ */
+
+class HighResolutionClockTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_CLOCK_HIGHRESOLUTIONCLOCKTESTCASE_HPP_
@@ -0,0 +1,153 @@
+/**
+ * \file
+ * \brief TickClockNowTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "TickClockNowTestCase.hpp"
+
+#include "cycleMeasurement.hpp"
+#include "waitForNextTick.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include "distortos/TickClock.hpp"
+
+#include <limits>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of ticks during which consistency of TickClock::now() is tested
+constexpr TickClock::duration testDuration {5};
+
+/// number of iterations of measurement
+constexpr size_t iterations {1000};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// tick count read by baselineNow()
+volatile uint64_t baselineTickCount;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Baseline variant of internal::Scheduler::getTickCount().
+ *
+ * Copy of the implementation which read tick count with interrupt masking enabled.
+ *
+ * \return value of baselineTickCount
+ */
+
+__attribute__ ((noinline))
+uint64_t baselineGetTickCount()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	return baselineTickCount;
+}
+
+/**
+ * \brief Baseline variant of TickClock::now().
+ *
+ * Copy of the implementation which used baselineGetTickCount() to read tick count.
+ *
+ * \return time point with value of baselineTickCount
+ */
+
+__attribute__ ((noinline))
+TickClock::time_point baselineNow()
+{
+	const auto tickCount = baselineGetTickCount();
+	return TickClock::time_point{TickClock::duration{tickCount}};
+}
+
+/**
+ * \brief Tests consistency of values returned by TickClock::now().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testConsistency()
+{
+	waitForNextTick();
+	const auto end = TickClock::now() + testDuration;
+	auto previous = TickClock::now();
+	while (previous < end)
+	{
+		const auto now = TickClock::now();
+		if (now < previous || now > previous + TickClock::duration{1})
+			return false;
+		previous = now;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Measures minimal duration of function.
+ *
+ * \param [in] function is the function which will be measured
+ *
+ * \return minimal number of core clock cycles used by \a function and by measurement itself
+ */
+
+uint32_t measure(TickClock::time_point (& function)())
+{
+	auto minCycles = std::numeric_limits<uint32_t>::max();
+	for (size_t i {}; i < iterations; ++i)
+	{
+		const auto start = getCycleCount();
+		function();
+		const auto cycles = getCycleCount() - start;
+		if (cycles < minCycles)
+			minCycles = cycles;
+	}
+
+	return minCycles;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool TickClockNowTestCase::run_() const
+{
+	if (testConsistency() == false)
+		return false;
+
+	const auto cycles = measure(TickClock::now);
+	reportCycles("TickClock::now()", cycles);
+	const auto baselineCycles = measure(baselineNow);
+	reportCycles("TickClock::now() with interrupt masking", baselineCycles);
+
+	// reading without interrupt masking must not be slower than the baseline implementation
+	if (cycles > baselineCycles)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
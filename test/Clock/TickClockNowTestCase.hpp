@@ -0,0 +1,51 @@
+/**
+ * \file
+ * \brief TickClockNowTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_CLOCK_TICKCLOCKNOWTESTCASE_HPP_
+#define TEST_CLOCK_TICKCLOCKNOWTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests TickClock::now() and measures its duration.
+ *
+ * TickClock::now() is called repeatedly for several ticks - values must never decrease and must never increase by
+ * more than one tick between consecutive calls (which would be the case if a torn 64-bit value was read).
+ *
+ * Minimal duration of TickClock::now() is measured and compared with baseline implementation, which reads tick count
+ * with interrupt masking enabled. Both values are reported with reportCycles(). Reading without interrupt masking must
+ * not be slower than the baseline.
+ */
+
+class TickClockNowTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_CLOCK_TICKCLOCKNOWTESTCASE_HPP_
@@ -0,0 +1,88 @@
+/**
+ * \file
+ * \brief TickClockTicklessIdleTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "TickClockTicklessIdleTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/HighResolutionClock.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// durations of sleep, the longest ones exceed the longest period of suppressed tick interrupt of typical chips
+constexpr TickClock::duration sleepDurations[]
+{
+		TickClock::duration{1},
+		TickClock::duration{2},
+		TickClock::duration{3},
+		TickClock::duration{10},
+		TickClock::duration{99},
+		TickClock::duration{150},
+		TickClock::duration{500},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool TickClockTicklessIdleTestCase::run_() const
+{
+	TickClock::time_point expiredTimePoint {};
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&expiredTimePoint]()
+			{
+				expiredTimePoint = TickClock::now();
+			});
+
+	for (const auto sleepDuration : sleepDurations)
+	{
+		waitForNextTick();
+
+		const auto start = TickClock::now();
+		const auto wakeUpTimePoint = start + sleepDuration;
+		const auto expirationTimePoint = start + (sleepDuration + TickClock::duration{1}) / 2;
+		expiredTimePoint = {};
+		softwareTimer.start(expirationTimePoint);
+
+		const auto ret = ThisThread::sleepUntil(wakeUpTimePoint);
+		const auto wokenUpTimePoint = TickClock::now();
+		const auto highResolutionTimePoint = HighResolutionClock::now();
+		if (ret != 0 || wokenUpTimePoint != wakeUpTimePoint || expiredTimePoint != expirationTimePoint ||
+				softwareTimer.isRunning() != false)
+			return false;
+
+		// HighResolutionClock must be in the tick of TickClock, or in the next one if the tick changed in the meantime
+		const auto tickTimePoint = HighResolutionClock::toTickClock(highResolutionTimePoint);
+		if (tickTimePoint < wokenUpTimePoint || tickTimePoint > wokenUpTimePoint + TickClock::duration{1})
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief TickClockTicklessIdleTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_CLOCK_TICKCLOCKTICKLESSIDLETESTCASE_HPP_
+#define TEST_CLOCK_TICKCLOCKTICKLESSIDLETESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests TickClock across sleep of idle thread.
+ *
+ * Test thread sleeps for various durations - from a single tick to periods longer than the longest period of tick
+ * interrupt which can be suppressed in tickless idle mode - so that idle thread is the only runnable thread. Software
+ * timer started before each sleep expires in the middle of it. Both the software timer and the test thread must be
+ * woken up exactly at the requested time point of TickClock, and HighResolutionClock must be consistent with TickClock
+ * after the sleep. The test case is also valid when tickless idle mode is disabled.
+ */
+
+class TickClockTicklessIdleTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_CLOCK_TICKCLOCKTICKLESSIDLETESTCASE_HPP_
@@ -0,0 +1,70 @@
+/**
+ * \file
+ * \brief clockTestCases object definition
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "clockTestCases.hpp"
+
+#include "TickClockNowTestCase.hpp"
+#include "HighResolutionClockTestCase.hpp"
+#include "HighPrecisionTimerTestCase.hpp"
+#include "TickClockTicklessIdleTestCase.hpp"
+#include "CycleCountTestCase.hpp"
+
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// TickClockNowTestCase instance
+const TickClockNowTestCase tickClockNowTestCase;
+
+/// HighResolutionClockTestCase instance
+const HighResolutionClockTestCase highResolutionClockTestCase;
+
+/// HighPrecisionTimerTestCase instance
+const HighPrecisionTimerTestCase highPrecisionTimerTestCase;
+
+/// TickClockTicklessIdleTestCase instance
+const TickClockTicklessIdleTestCase tickClockTicklessIdleTestCase;
+
+/// CycleCountTestCase instance
+const CycleCountTestCase cycleCountTestCase;
+
+/// array with references to TestCase objects related to clocks
+const TestCaseGroup::Range::value_type clockTestCases_[]
+{
+		TestCaseGroup::Range::value_type{tickClockNowTestCase},
+		TestCaseGroup::Range::value_type{highResolutionClockTestCase},
+		TestCaseGroup::Range::value_type{highPrecisionTimerTestCase},
+		TestCaseGroup::Range::value_type{tickClockTicklessIdleTestCase},
+		TestCaseGroup::Range::value_type{cycleCountTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup clockTestCases {TestCaseGroup::Range{clockTestCases_}};
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,201 @@
+/**
+ * \file
+ * \brief ConditionVariableWaitMorphingTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ConditionVariableWaitMorphingTestCase.hpp"
+
+#include "priorityTestPhases.hpp"
+#include "SequenceAsserter.hpp"
+
+#include "distortos/ConditionVariable.hpp"
+#include "distortos/DynamicThread.hpp"
+#include "distortos/Mutex.hpp"
+#include "distortos/statistics.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// expected number of context switches after unlocking the mutex with Protocol::none: 1 context switch for each test
+/// thread which gets the ownership of the mutex and one final context switch when all test threads terminate
+constexpr decltype(statistics::getContextSwitchCount()) unlockContextSwitchCount {totalThreads + 1};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Test thread
+ *
+ * Locks the mutex, waits for condition variable, marks the sequence point in SequenceAsserter and unlocks the mutex.
+ *
+ * \param [in] sequenceAsserter is a reference to SequenceAsserter shared object
+ * \param [in] sequencePoint is the sequence point of this instance
+ * \param [in] conditionVariable is a reference to shared condition variable
+ * \param [in] mutex is a reference to shared mutex
+ */
+
+void thread(SequenceAsserter& sequenceAsserter, const unsigned int sequencePoint, ConditionVariable& conditionVariable,
+		Mutex& mutex)
+{
+	mutex.lock();
+	conditionVariable.wait(mutex);
+	sequenceAsserter.sequencePoint(sequencePoint);
+	mutex.unlock();
+}
+
+/**
+ * \brief Builder of test threads
+ *
+ * \param [in] threadParameters is a reference to ThreadParameters object
+ * \param [in] sequenceAsserter is a reference to SequenceAsserter shared object
+ * \param [in] conditionVariable is a reference to shared condition variable
+ * \param [in] mutex is a reference to shared mutex
+ *
+ * \return constructed DynamicThread object
+ */
+
+DynamicThread makeTestThread(const ThreadParameters& threadParameters, SequenceAsserter& sequenceAsserter,
+		ConditionVariable& conditionVariable, Mutex& mutex)
+{
+	return makeDynamicThread({testThreadStackSize, threadParameters.first}, thread, std::ref(sequenceAsserter),
+			threadParameters.second, std::ref(conditionVariable), std::ref(mutex));
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ConditionVariableWaitMorphingTestCase::run_() const
+{
+	// mutexes with PriorityInheritance protocol are not supported by wait morphing
+	using Parameters = std::tuple<Mutex::Type, Mutex::Protocol, uint8_t>;
+	static const std::array<Parameters, 6> parametersArray
+	{{
+			Parameters{Mutex::Type::normal, Mutex::Protocol::none, {}},
+			Parameters{Mutex::Type::normal, Mutex::Protocol::priorityProtect, UINT8_MAX},
+			Parameters{Mutex::Type::errorChecking, Mutex::Protocol::none, {}},
+			Parameters{Mutex::Type::errorChecking, Mutex::Protocol::priorityProtect, UINT8_MAX},
+			Parameters{Mutex::Type::recursive, Mutex::Protocol::none, {}},
+			Parameters{Mutex::Type::recursive, Mutex::Protocol::priorityProtect, UINT8_MAX},
+	}};
+
+	for (const auto& parameters : parametersArray)
+		for (const auto& phase : priorityTestPhases)
+		{
+			SequenceAsserter sequenceAsserter;
+			ConditionVariable conditionVariable;
+			Mutex mutex {std::get<0>(parameters), std::get<1>(parameters), std::get<2>(parameters)};
+
+			std::array<DynamicThread, totalThreads> threads
+			{{
+					makeTestThread(phase.first[phase.second[0]], sequenceAsserter, conditionVariable, mutex),
+					makeTestThread(phase.first[phase.second[1]], sequenceAsserter, conditionVariable, mutex),
+					makeTestThread(phase.first[phase.second[2]], sequenceAsserter, conditionVariable, mutex),
+					makeTestThread(phase.first[phase.second[3]], sequenceAsserter, conditionVariable, mutex),
+					makeTestThread(phase.first[phase.second[4]], sequenceAsserter, conditionVariable, mutex),
+					makeTestThread(phase.first[phase.second[5]], sequenceAsserter, conditionVariable, mutex),
+					makeTestThread(phase.first[phase.second[6]], sequenceAsserter, conditionVariable, mutex),
+					makeTestThread(phase.first[phase.second[7]], sequenceAsserter, conditionVariable, mutex),
+					makeTestThread(phase.first[phase.second[8]], sequenceAsserter, conditionVariable, mutex),
+					makeTestThread(phase.first[phase.second[9]], sequenceAsserter, conditionVariable, mutex),
+			}};
+
+			bool result {true};
+
+			for (auto& thread : threads)
+				thread.start();
+
+			for (const auto& thread : threads)
+				if (thread.getState() != ThreadState::blockedOnConditionVariable)
+					result = false;
+
+			if (mutex.lock() != 0)
+				result = false;
+
+			{
+				const auto contextSwitchCount = statistics::getContextSwitchCount();
+				conditionVariable.notifyAll(mutex);
+				// all threads are transferred to the mutex held by main thread, so none of them is unblocked
+				if (statistics::getContextSwitchCount() != contextSwitchCount)
+					result = false;
+			}
+
+			for (const auto& thread : threads)
+				if (thread.getState() != ThreadState::blockedOnMutex)
+					result = false;
+
+			{
+				const auto contextSwitchCount = statistics::getContextSwitchCount();
+				if (mutex.unlock() != 0)
+					result = false;
+				// with PriorityProtect protocol each transfer of lock preempts the previous owner, so the number of
+				// context switches is checked only for Protocol::none
+				if (std::get<1>(parameters) == Mutex::Protocol::none &&
+						statistics::getContextSwitchCount() - contextSwitchCount != unlockContextSwitchCount)
+					result = false;
+			}
+
+			for (auto& thread : threads)
+				thread.join();
+
+			if (result == false || sequenceAsserter.assertSequence(totalThreads) == false)
+				return false;
+		}
+
+	{
+		// waiting thread with priority raised above priority ceiling must be unblocked and get EINVAL from lock()
+		constexpr uint8_t priorityCeiling {testCasePriority_ + 1};
+		ConditionVariable conditionVariable;
+		Mutex mutex {Mutex::Type::normal, Mutex::Protocol::priorityProtect, priorityCeiling};
+		int waitRet {-1};
+		auto thread = makeAndStartDynamicThread({testThreadStackSize, priorityCeiling},
+				[&conditionVariable, &mutex, &waitRet]()
+				{
+					mutex.lock();
+					waitRet = conditionVariable.wait(mutex);
+				});
+
+		bool result {thread.getState() == ThreadState::blockedOnConditionVariable};
+		thread.setPriority(priorityCeiling + 1);
+
+		if (mutex.lock() != 0)
+			result = false;
+		conditionVariable.notifyAll(mutex);
+		if (mutex.unlock() != 0)
+			result = false;
+
+		thread.join();
+		if (result == false || waitRet != EINVAL)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,67 @@
+/**
+ * \file
+ * \brief ConditionVariableWaitMorphingTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_CONDITIONVARIABLE_CONDITIONVARIABLEWAITMORPHINGTESTCASE_HPP_
+#define TEST_CONDITIONVARIABLE_CONDITIONVARIABLEWAITMORPHINGTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests ConditionVariable::notifyAll(Mutex&) ("wait morphing").
+ *
+ * Starts 10 small threads (in various order) with varying priorities which lock the same mutex and wait on the same
+ * condition variable. Main thread locks the mutex and notifies all threads, asserting that they are transferred to the
+ * mutex without any context switch and that - when the mutex is unlocked - they continue in the right order, each
+ * already owning the mutex.
+ *
+ * Additionally waiting thread with priority raised above priority ceiling of the mutex with PriorityProtect protocol
+ * must not be transferred to the mutex - it must be unblocked and get EINVAL when locking the mutex.
+ */
+
+class ConditionVariableWaitMorphingTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {1};
+
+public:
+
+	/**
+	 * \brief ConditionVariableWaitMorphingTestCase's constructor
+	 */
+
+	constexpr ConditionVariableWaitMorphingTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_CONDITIONVARIABLE_CONDITIONVARIABLEWAITMORPHINGTESTCASE_HPP_
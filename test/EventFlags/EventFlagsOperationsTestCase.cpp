@@ -0,0 +1,321 @@
+/**
+ * \file
+ * \brief EventFlagsOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "EventFlagsOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/EventFlags.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// first flag used in tests
+constexpr EventFlags::Flags flag0 {1 << 0};
+
+/// second flag used in tests
+constexpr EventFlags::Flags flag1 {1 << 5};
+
+/// flag which is never waited for
+constexpr EventFlags::Flags otherFlag {UINT32_C(1) << 31};
+
+/// expected number of context switches in waitForNextTick(): main -> idle -> main
+constexpr decltype(statistics::getContextSwitchCount()) waitForNextTickContextSwitchCount {2};
+
+/// expected number of context switches in phase2 block involving tryWaitFor() or tryWaitUntil() (excluding
+/// waitForNextTick()): 1 - main thread blocks on event flags (main -> idle), 2 - main thread wakes up (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase2TryWaitForUntilContextSwitchCount {2};
+
+/// expected number of context switches in phase3 block involving test thread (excluding waitForNextTick()): 1 - test
+/// thread starts (main -> test), 2 - test thread goes to sleep (test -> main), 3 - main thread blocks on event flags
+/// (main -> idle), 4 - test thread wakes (idle -> test), 5 - test thread terminates (test -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase3ThreadContextSwitchCount {5};
+
+/// expected number of context switches in phase4 block involving software timer (excluding waitForNextTick()): 1 - main
+/// thread blocks on event flags (main -> idle), 2 - main thread is unblocked by interrupt (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase4SoftwareTimerContextSwitchCount {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests EventFlags::tryWait() when the wait cannot be satisfied - it must fail immediately, return EAGAIN and
+ * not modify the flags
+ *
+ * \param [in] eventFlags is a reference to event flags that will be tested
+ * \param [in] mask selects flags which will be waited for
+ * \param [in] waitMode selects whether any or all of selected flags must be set
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testTryWaitWhenNotSatisfied(EventFlags& eventFlags, const EventFlags::Flags mask,
+		const EventFlags::WaitMode waitMode)
+{
+	waitForNextTick();
+	const auto flags = eventFlags.get();
+	const auto start = TickClock::now();
+	const auto ret = eventFlags.tryWait(mask, waitMode, true);
+	return ret.first == EAGAIN && ret.second == flags && TickClock::now() == start && eventFlags.get() == flags;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether tryWait(), set(), clear() and get() properly handle the flags, in both wait modes, with and without
+ * clearing flags on exit.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	EventFlags eventFlags;
+
+	if (eventFlags.get() != 0)
+		return false;
+
+	{
+		// mask must not be 0
+		const auto ret = eventFlags.tryWait({}, EventFlags::WaitMode::any);
+		if (ret.first != EINVAL || ret.second != 0)
+			return false;
+	}
+
+	if (testTryWaitWhenNotSatisfied(eventFlags, flag0 | flag1, EventFlags::WaitMode::any) == false)
+		return false;
+
+	if (eventFlags.set(flag0) != flag0)
+		return false;
+
+	if (testTryWaitWhenNotSatisfied(eventFlags, flag0 | flag1, EventFlags::WaitMode::all) == false)
+		return false;
+
+	{
+		// one of flags is set, so "any" wait without clearing must succeed and not modify the flags
+		const auto ret = eventFlags.tryWait(flag0 | flag1, EventFlags::WaitMode::any);
+		if (ret.first != 0 || ret.second != flag0 || eventFlags.get() != flag0)
+			return false;
+	}
+
+	if (eventFlags.set(flag1 | otherFlag) != (flag0 | flag1 | otherFlag))
+		return false;
+
+	{
+		// both flags are set, so "all" wait must succeed and clear only the flags which were waited for
+		const auto ret = eventFlags.tryWait(flag0 | flag1, EventFlags::WaitMode::all, true);
+		if (ret.first != 0 || ret.second != (flag0 | flag1 | otherFlag) || eventFlags.get() != otherFlag)
+			return false;
+	}
+
+	if (testTryWaitWhenNotSatisfied(eventFlags, flag0 | flag1, EventFlags::WaitMode::any) == false)
+		return false;
+
+	if (eventFlags.clear(otherFlag | flag0) != otherFlag || eventFlags.get() != 0)
+		return false;
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests whether tryWaitFor() and tryWaitUntil() properly return ETIMEDOUT when the wait cannot be satisfied, also when
+ * only some of the flags are set in "all" wait mode.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	EventFlags eventFlags {flag0};
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// flag1 is not set, so tryWaitFor() should time-out at expected time
+		const auto start = TickClock::now();
+		const auto ret = eventFlags.tryWaitFor(singleDuration, flag1, EventFlags::WaitMode::any, true);
+		const auto realDuration = TickClock::now() - start;
+		if (ret.first != ETIMEDOUT || ret.second != flag0 || eventFlags.get() != flag0 ||
+				realDuration != singleDuration + decltype(singleDuration){1} ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase2TryWaitForUntilContextSwitchCount)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// only one of flags is set, so tryWaitUntil() should time-out at exact expected time
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		const auto ret = eventFlags.tryWaitUntil(requestedTimePoint, flag0 | flag1, EventFlags::WaitMode::all, true);
+		if (ret.first != ETIMEDOUT || ret.second != flag0 || requestedTimePoint != TickClock::now() ||
+				eventFlags.get() != flag0 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase2TryWaitForUntilContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests thread-thread signaling scenario. Main (current) thread waits for all of flags, one of which is already set.
+ * Test thread sets the other flag at specified time point, main thread is expected to be unblocked (with wait(),
+ * tryWaitFor() and tryWaitUntil()) in the same moment and to clear the flags on exit.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	constexpr size_t testThreadStackSize {512};
+
+	EventFlags eventFlags;
+
+	const auto sleepUntilFunctor = [&eventFlags](const TickClock::time_point timePoint)
+			{
+				ThisThread::sleepUntil(timePoint);
+				eventFlags.set(flag1);
+			};
+
+	for (size_t i {}; i < 3; ++i)
+	{
+		eventFlags.set(flag0);
+
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		auto thread = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, sleepUntilFunctor, wakeUpTimePoint);
+
+		ThisThread::yield();
+
+		// only one of flags is currently set, but the wait should be satisfied at expected time
+		const auto ret = i == 0 ? eventFlags.wait(flag0 | flag1, EventFlags::WaitMode::all, true) :
+				i == 1 ? eventFlags.tryWaitFor(wakeUpTimePoint - TickClock::now() + longDuration, flag0 | flag1,
+						EventFlags::WaitMode::all, true) :
+				eventFlags.tryWaitUntil(wakeUpTimePoint + longDuration, flag0 | flag1, EventFlags::WaitMode::all, true);
+		const auto wokenUpTimePoint = TickClock::now();
+		thread.join();
+		if (ret.first != 0 || ret.second != (flag0 | flag1) || wakeUpTimePoint != wokenUpTimePoint ||
+				eventFlags.get() != 0 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase3ThreadContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 4 of test case.
+ *
+ * Tests interrupt-thread signaling scenario. Main (current) thread waits for any of flags. Software timer is used to
+ * set one of them at specified time point from interrupt context, main thread is expected to be unblocked (with
+ * wait(), tryWaitFor() and tryWaitUntil()) in the same moment. Flags are not cleared on exit.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase4()
+{
+	EventFlags eventFlags;
+	auto softwareTimer = makeStaticSoftwareTimer(&EventFlags::set, std::ref(eventFlags), flag1);
+
+	for (size_t i {}; i < 3; ++i)
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+
+		softwareTimer.start(wakeUpTimePoint);
+
+		// none of flags is currently set, but the wait should be satisfied at expected time
+		const auto ret = i == 0 ? eventFlags.wait(flag0 | flag1, EventFlags::WaitMode::any) :
+				i == 1 ? eventFlags.tryWaitFor(wakeUpTimePoint - TickClock::now() + longDuration, flag0 | flag1,
+						EventFlags::WaitMode::any) :
+				eventFlags.tryWaitUntil(wakeUpTimePoint + longDuration, flag0 | flag1, EventFlags::WaitMode::any);
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret.first != 0 || ret.second != flag1 || wakeUpTimePoint != wokenUpTimePoint || eventFlags.get() != flag1 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase4SoftwareTimerContextSwitchCount)
+			return false;
+
+		eventFlags.clear(flag1);
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool EventFlagsOperationsTestCase::run_() const
+{
+	constexpr auto phase1ExpectedContextSwitchCount = 3 * waitForNextTickContextSwitchCount;
+	constexpr auto phase2ExpectedContextSwitchCount = 2 * waitForNextTickContextSwitchCount +
+			2 * phase2TryWaitForUntilContextSwitchCount;
+	constexpr auto phase3ExpectedContextSwitchCount = 3 * waitForNextTickContextSwitchCount +
+			3 * phase3ThreadContextSwitchCount;
+	constexpr auto phase4ExpectedContextSwitchCount = 3 * waitForNextTickContextSwitchCount +
+			3 * phase4SoftwareTimerContextSwitchCount;
+	constexpr auto expectedContextSwitchCount = phase1ExpectedContextSwitchCount + phase2ExpectedContextSwitchCount +
+			phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount;
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+	for (const auto& function : {phase1, phase2, phase3, phase4})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	if (statistics::getContextSwitchCount() - contextSwitchCount != expectedContextSwitchCount)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
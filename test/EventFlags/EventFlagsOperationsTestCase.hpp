@@ -0,0 +1,47 @@
+/**
+ * \file
+ * \brief EventFlagsOperationsTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_EVENTFLAGS_EVENTFLAGSOPERATIONSTESTCASE_HPP_
+#define TEST_EVENTFLAGS_EVENTFLAGSOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various event flags operations.
+ *
+ * Tests waiting for any or all of selected flags (wait(), tryWait(), tryWaitFor() and tryWaitUntil()), with and without
+ * clearing them on exit, and setting and clearing of flags - both from thread and from interrupt context.
+ */
+
+class EventFlagsOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_EVENTFLAGS_EVENTFLAGSOPERATIONSTESTCASE_HPP_
@@ -0,0 +1,164 @@
+/**
+ * \file
+ * \brief EventFlagsPriorityTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "EventFlagsPriorityTestCase.hpp"
+
+#include "priorityTestPhases.hpp"
+#include "SequenceAsserter.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/EventFlags.hpp"
+#include "distortos/statistics.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// pair of sequence points
+using SequencePoints = std::pair<unsigned int, unsigned int>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// value of flags with one flag for each test thread
+constexpr EventFlags::Flags allFlags {(1 << totalThreads) - 1};
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Test thread
+ *
+ * Marks the first sequence point in SequenceAsserter, waits for its own flag - which is cleared on exit - and marks the
+ * last sequence point in SequenceAsserter. The last sequence point is skipped if the wait failed or if it was not
+ * satisfied by the value of flags with all flags set.
+ *
+ * \param [in] sequenceAsserter is a reference to SequenceAsserter shared object
+ * \param [in] sequencePoints is a pair of sequence points for this instance
+ * \param [in] eventFlags is a reference to shared event flags
+ */
+
+void thread(SequenceAsserter& sequenceAsserter, const SequencePoints sequencePoints, EventFlags& eventFlags)
+{
+	sequenceAsserter.sequencePoint(sequencePoints.first);
+	const auto ret = eventFlags.wait(1 << sequencePoints.first, EventFlags::WaitMode::any, true);
+	if (ret.first != 0 || ret.second != allFlags)
+		return;
+	sequenceAsserter.sequencePoint(sequencePoints.second);
+}
+
+/**
+ * \brief Builder of test threads
+ *
+ * \param [in] firstSequencePoint is the first sequence point for this instance - equal to the order in which this
+ * thread will be started
+ * \param [in] threadParameters is a reference to ThreadParameters object
+ * \param [in] sequenceAsserter is a reference to SequenceAsserter shared object
+ * \param [in] eventFlags is a reference to shared event flags
+ *
+ * \return constructed DynamicThread object
+ */
+
+DynamicThread makeTestThread(const unsigned int firstSequencePoint, const ThreadParameters& threadParameters,
+		SequenceAsserter& sequenceAsserter, EventFlags& eventFlags)
+{
+	return makeDynamicThread({testThreadStackSize, threadParameters.first}, thread, std::ref(sequenceAsserter),
+			SequencePoints{firstSequencePoint, threadParameters.second + totalThreads}, std::ref(eventFlags));
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool EventFlagsPriorityTestCase::run_() const
+{
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+	std::remove_const<decltype(contextSwitchCount)>::type expectedContextSwitchCount {};
+
+	for (const auto& phase : priorityTestPhases)
+	{
+		SequenceAsserter sequenceAsserter;
+		EventFlags eventFlags;
+
+		std::array<DynamicThread, totalThreads> threads
+		{{
+				makeTestThread(0, phase.first[phase.second[0]], sequenceAsserter, eventFlags),
+				makeTestThread(1, phase.first[phase.second[1]], sequenceAsserter, eventFlags),
+				makeTestThread(2, phase.first[phase.second[2]], sequenceAsserter, eventFlags),
+				makeTestThread(3, phase.first[phase.second[3]], sequenceAsserter, eventFlags),
+				makeTestThread(4, phase.first[phase.second[4]], sequenceAsserter, eventFlags),
+				makeTestThread(5, phase.first[phase.second[5]], sequenceAsserter, eventFlags),
+				makeTestThread(6, phase.first[phase.second[6]], sequenceAsserter, eventFlags),
+				makeTestThread(7, phase.first[phase.second[7]], sequenceAsserter, eventFlags),
+				makeTestThread(8, phase.first[phase.second[8]], sequenceAsserter, eventFlags),
+				makeTestThread(9, phase.first[phase.second[9]], sequenceAsserter, eventFlags),
+		}};
+
+		bool result {true};
+
+		for (auto& thread : threads)
+		{
+			thread.start();
+			// 2 context switches: "into" the thread and "back" to main thread when test thread blocks on event flags
+			expectedContextSwitchCount += 2;
+			if (statistics::getContextSwitchCount() - contextSwitchCount != expectedContextSwitchCount)
+				result = false;
+		}
+
+		for (const auto& thread : threads)
+			if (thread.getState() != ThreadState::blockedOnEventFlags)
+				result = false;
+
+		if (sequenceAsserter.assertSequence(totalThreads) == false || eventFlags.get() != 0)
+			result = false;
+
+		// all flags are cleared on exit, but only after all threads are unblocked
+		if (eventFlags.set(allFlags) != 0)
+			result = false;
+
+		// all threads are unblocked at once: "into" each unblocked thread and "back" to main thread when the last test
+		// thread terminates
+		expectedContextSwitchCount += totalThreads + 1;
+		if (statistics::getContextSwitchCount() - contextSwitchCount != expectedContextSwitchCount)
+			result = false;
+
+		for (auto& thread : threads)
+			thread.join();
+
+		if (result == false || sequenceAsserter.assertSequence(totalThreads * 2) == false || eventFlags.get() != 0)
+			return false;
+	}
+
+	if (statistics::getContextSwitchCount() - contextSwitchCount != (3 * totalThreads + 1) * priorityTestPhases.size())
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
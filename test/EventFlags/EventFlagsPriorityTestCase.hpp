@@ -0,0 +1,64 @@
+/**
+ * \file
+ * \brief EventFlagsPriorityTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_EVENTFLAGS_EVENTFLAGSPRIORITYTESTCASE_HPP_
+#define TEST_EVENTFLAGS_EVENTFLAGSPRIORITYTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests priority scheduling of event flags.
+ *
+ * Starts 10 small threads (in various order) with varying priorities which wait for different flags of the same event
+ * flags object. All flags are set at once, asserting that all threads are unblocked by single operation, that they
+ * start and finish in the expected order, using exact number of context switches, and that the flags cleared on exit
+ * from wait are cleared only after all threads are unblocked.
+ */
+
+class EventFlagsPriorityTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {1};
+
+public:
+
+	/**
+	 * \brief EventFlagsPriorityTestCase's constructor
+	 */
+
+	constexpr EventFlagsPriorityTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_EVENTFLAGS_EVENTFLAGSPRIORITYTESTCASE_HPP_
@@ -0,0 +1,55 @@
+/**
+ * \file
+ * \brief eventFlagsTestCases object definition
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "eventFlagsTestCases.hpp"
+
+#include "EventFlagsPriorityTestCase.hpp"
+#include "EventFlagsOperationsTestCase.hpp"
+
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// EventFlagsPriorityTestCase instance
+const EventFlagsPriorityTestCase priorityTestCase;
+
+/// EventFlagsOperationsTestCase instance
+const EventFlagsOperationsTestCase operationsTestCase;
+
+/// array with references to TestCase objects related to event flags
+const TestCaseGroup::Range::value_type eventFlagsTestCases_[]
+{
+		TestCaseGroup::Range::value_type{priorityTestCase},
+		TestCaseGroup::Range::value_type{operationsTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup eventFlagsTestCases {TestCaseGroup::Range{eventFlagsTestCases_}};
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,334 @@
+/**
+ * \file
+ * \brief FifoQueueBatchOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "FifoQueueBatchOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/StaticRawFifoQueue.hpp"
+#include "distortos/statistics.hpp"
+
+#include <array>
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// maximum number of elements in tested queues
+constexpr size_t queueSize {4};
+
+/// type of tested FifoQueue
+using TestFifoQueue = StaticFifoQueue<uint32_t, queueSize>;
+
+/// type of tested RawFifoQueue
+using TestRawFifoQueue = StaticRawFifoQueue<uint32_t, queueSize>;
+
+/// type of array with elements
+using Values = std::array<uint32_t, queueSize * 2>;
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// expected number of context switches in waitForNextTick(): main -> idle -> main
+constexpr decltype(statistics::getContextSwitchCount()) waitForNextTickContextSwitchCount {2};
+
+/// expected number of context switches in phase2 block involving timed function (excluding waitForNextTick()): 1 - main
+/// thread blocks on queue (main -> idle), 2 - main thread wakes up (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase2TryForUntilContextSwitchCount {2};
+
+/// expected number of context switches in phase3 block involving test thread (excluding waitForNextTick()): 1 - test
+/// thread starts (main -> test), 2 - test thread blocks on queue (test -> main), 3 - test thread is unblocked by whole
+/// batch of elements (main -> test), 4 - test thread terminates (test -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase3ThreadContextSwitchCount {4};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Makes array with consecutive values.
+ *
+ * \param [in] firstValue is the value of first element
+ *
+ * \return array with consecutive values, starting with \a firstValue
+ */
+
+Values makeValues(const uint32_t firstValue)
+{
+	Values values;
+	for (size_t i {}; i < values.size(); ++i)
+		values[i] = firstValue + i;
+	return values;
+}
+
+/**
+ * \brief Checks whether the array contains consecutive values.
+ *
+ * \param [in] values is a reference to checked array
+ * \param [in] count is the number of checked elements
+ * \param [in] firstValue is the expected value of first element
+ *
+ * \return true if first \a count elements of \a values are consecutive values starting with \a firstValue, false
+ * otherwise
+ */
+
+bool checkValues(const Values& values, const size_t count, const uint32_t firstValue)
+{
+	for (size_t i {}; i < count; ++i)
+		if (values[i] != firstValue + i)
+			return false;
+
+	return true;
+}
+
+/**
+ * \brief Tests non-blocking batched operations of the queue.
+ *
+ * \tparam Queue is the type of tested queue
+ *
+ * \param [in] queue is a reference to tested queue, it must be empty
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<typename Queue>
+bool testTryPopNTryPushN(Queue& queue)
+{
+	const auto pushedValues = makeValues(0);
+	Values poppedValues {};
+
+	{
+		const auto ret = queue.tryPopN(poppedValues.data(), poppedValues.size());
+		if (ret.first != EAGAIN || ret.second != 0)
+			return false;
+	}
+	{
+		const auto ret = queue.tryPushN(pushedValues.data(), 0);
+		if (ret.first != EINVAL || ret.second != 0)
+			return false;
+	}
+	{
+		// only queueSize elements fit in the queue
+		const auto ret = queue.tryPushN(pushedValues.data(), pushedValues.size());
+		if (ret.first != 0 || ret.second != queueSize)
+			return false;
+	}
+	{
+		const auto ret = queue.tryPushN(pushedValues.data(), pushedValues.size());
+		if (ret.first != EAGAIN || ret.second != 0)
+			return false;
+	}
+	{
+		const auto ret = queue.tryPopN(poppedValues.data(), 0);
+		if (ret.first != EINVAL || ret.second != 0)
+			return false;
+	}
+	{
+		const auto ret = queue.tryPopN(poppedValues.data(), queueSize - 1);
+		if (ret.first != 0 || ret.second != queueSize - 1 || checkValues(poppedValues, queueSize - 1, 0) == false)
+			return false;
+	}
+	{
+		// positions of the queue wrap around
+		const auto ret = queue.tryPushN(pushedValues.data() + queueSize, queueSize - 1);
+		if (ret.first != 0 || ret.second != queueSize - 1)
+			return false;
+	}
+	{
+		const auto ret = queue.tryPopN(poppedValues.data(), poppedValues.size());
+		if (ret.first != 0 || ret.second != queueSize ||
+				checkValues(poppedValues, queueSize, queueSize - 1) == false)
+			return false;
+	}
+
+	const auto ret = queue.tryPopN(poppedValues.data(), poppedValues.size());
+	return ret.first == EAGAIN && ret.second == 0;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether tryPopN() and tryPushN() of FifoQueue and RawFifoQueue transfer as many elements as possible in FIFO
+ * order - also when positions of the queue wrap around - and whether they fail with EAGAIN when the queue is empty or
+ * full and with EINVAL when count is zero, without any context switch. Tests whether RawFifoQueue's functions fail with
+ * EMSGSIZE when size doesn't match the size of element.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	TestFifoQueue fifoQueue;
+	TestRawFifoQueue rawFifoQueue;
+
+	waitForNextTick();
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+	const auto start = TickClock::now();
+
+	if (testTryPopNTryPushN(fifoQueue) == false || testTryPopNTryPushN(rawFifoQueue) == false)
+		return false;
+
+	{
+		const uint16_t values[queueSize] {};
+		const auto ret = rawFifoQueue.tryPushN(values, queueSize);
+		if (ret.first != EMSGSIZE || ret.second != 0)
+			return false;
+	}
+	{
+		uint16_t values[queueSize];
+		const auto ret = rawFifoQueue.tryPopN(values, queueSize);
+		if (ret.first != EMSGSIZE || ret.second != 0)
+			return false;
+	}
+
+	return TickClock::now() == start && statistics::getContextSwitchCount() == contextSwitchCount;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests whether tryPopNFor(), tryPopNUntil(), tryPushNFor() and tryPushNUntil() properly return ETIMEDOUT without
+ * transferring any element when the queue is empty or full.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	TestFifoQueue fifoQueue;
+	TestRawFifoQueue rawFifoQueue;
+	auto values = makeValues(0);
+
+	for (size_t i {}; i < 4; ++i)
+	{
+		// the queues must be full for tests of "push" functions
+		if (i == 2)
+		{
+			const auto fifoQueueRet = fifoQueue.tryPushN(values.data(), queueSize);
+			const auto rawFifoQueueRet = rawFifoQueue.tryPushN(values.data(), queueSize);
+			if (fifoQueueRet.first != 0 || fifoQueueRet.second != queueSize || rawFifoQueueRet.first != 0 ||
+					rawFifoQueueRet.second != queueSize)
+				return false;
+		}
+
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto start = TickClock::now();
+		const auto ret = i == 0 ? fifoQueue.tryPopNFor(singleDuration, values.data(), values.size()) :
+				i == 1 ? rawFifoQueue.tryPopNUntil(start + singleDuration, values.data(), values.size()) :
+				i == 2 ? fifoQueue.tryPushNFor(singleDuration, values.data(), values.size()) :
+				rawFifoQueue.tryPushNUntil(start + singleDuration, values.data(), values.size());
+		const auto realDuration = TickClock::now() - start;
+		const auto expectedDuration = i % 2 == 0 ? singleDuration + decltype(singleDuration){1} : singleDuration;
+		if (ret.first != ETIMEDOUT || ret.second != 0 || realDuration != expectedDuration ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase2TryForUntilContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests whether test thread with higher priority, which is blocked in popN() on empty queue, receives whole batch of
+ * elements pushed by main (current) thread with single pushN() - the test thread must be woken only once and must not
+ * be preempted before all elements are transferred.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	TestFifoQueue fifoQueue;
+	TestRawFifoQueue rawFifoQueue;
+
+	for (size_t i {}; i < 2; ++i)
+	{
+		Values poppedValues {};
+		std::pair<int, size_t> popRet {};
+		const auto popFunctor = [i, &fifoQueue, &rawFifoQueue, &poppedValues, &popRet]()
+				{
+					popRet = i == 0 ? fifoQueue.popN(poppedValues.data(), poppedValues.size()) :
+							rawFifoQueue.popN(poppedValues.data(), poppedValues.size());
+				};
+
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		auto thread = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, popFunctor);
+
+		const auto pushedValues = makeValues(i * queueSize);
+		const auto pushRet = i == 0 ? fifoQueue.pushN(pushedValues.data(), queueSize) :
+				rawFifoQueue.pushN(pushedValues.data(), queueSize);
+		thread.join();
+
+		if (pushRet.first != 0 || pushRet.second != queueSize || popRet.first != 0 || popRet.second != queueSize ||
+				checkValues(poppedValues, queueSize, i * queueSize) == false ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase3ThreadContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool FifoQueueBatchOperationsTestCase::run_() const
+{
+	constexpr auto phase1ExpectedContextSwitchCount = waitForNextTickContextSwitchCount;
+	constexpr auto phase2ExpectedContextSwitchCount = 4 * waitForNextTickContextSwitchCount +
+			4 * phase2TryForUntilContextSwitchCount;
+	constexpr auto phase3ExpectedContextSwitchCount = 2 * waitForNextTickContextSwitchCount +
+			2 * phase3ThreadContextSwitchCount;
+	constexpr auto expectedContextSwitchCount = phase1ExpectedContextSwitchCount + phase2ExpectedContextSwitchCount +
+			phase3ExpectedContextSwitchCount;
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+	for (const auto& function : {phase1, phase2, phase3})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	if (statistics::getContextSwitchCount() - contextSwitchCount != expectedContextSwitchCount)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
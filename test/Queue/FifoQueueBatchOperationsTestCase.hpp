@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief FifoQueueBatchOperationsTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_FIFOQUEUEBATCHOPERATIONSTESTCASE_HPP_
+#define TEST_QUEUE_FIFOQUEUEBATCHOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests batched operations of FifoQueue and RawFifoQueue.
+ *
+ * Tests partial transfers and order of elements in popN() and pushN() family of functions (also when positions of the
+ * queue wrap around), their errors, timeouts and whether a thread blocked in popN() receives whole batch transferred
+ * with pushN() with single context switch.
+ */
+
+class FifoQueueBatchOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_FIFOQUEUEBATCHOPERATIONSTESTCASE_HPP_
@@ -0,0 +1,442 @@
+/**
+ * \file
+ * \brief FifoQueueZeroCopyTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "FifoQueueZeroCopyTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/StaticRawFifoQueue.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// maximum number of elements in tested queues
+constexpr size_t queueSize {2};
+
+/// type of tested FifoQueue
+using TestFifoQueue = StaticFifoQueue<uint32_t, queueSize>;
+
+/// type of tested RawFifoQueue
+using TestRawFifoQueue = StaticRawFifoQueue<uint32_t, queueSize>;
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// expected number of context switches in waitForNextTick(): main -> idle -> main
+constexpr decltype(statistics::getContextSwitchCount()) waitForNextTickContextSwitchCount {2};
+
+/// expected number of context switches in phase2 block involving timed function (excluding waitForNextTick()): 1 - main
+/// thread blocks on queue (main -> idle), 2 - main thread wakes up (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase2TryForUntilContextSwitchCount {2};
+
+/// expected number of context switches in phase3 block involving test thread (excluding waitForNextTick()): 1 - test
+/// thread starts (main -> test), 2 - test thread goes to sleep (test -> main), 3 - main thread blocks on queue (main ->
+/// idle), 4 - test thread wakes (idle -> test), 5 - test thread terminates (test -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase3ThreadContextSwitchCount {5};
+
+/// expected number of context switches in phase4 block involving test thread (excluding waitForNextTick()): 1 - test
+/// thread starts (main -> test), 2 - test thread blocks on queue (test -> main), 3 - test thread is unblocked by main
+/// thread (main -> test), 4 - test thread terminates (test -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase4ThreadContextSwitchCount {4};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Releases the slot of peeked element in FifoQueue.
+ *
+ * \param [in] fifoQueue is a reference to FifoQueue in which the slot will be released
+ * \param [in] element is a pointer to peeked element
+ *
+ * \return value returned by FifoQueue::release()
+ */
+
+int release(TestFifoQueue& fifoQueue, uint32_t* const element)
+{
+	return fifoQueue.release(element);
+}
+
+/**
+ * \brief Releases the slot of peeked element in RawFifoQueue.
+ *
+ * \param [in] rawFifoQueue is a reference to RawFifoQueue in which the slot will be released
+ *
+ * \return value returned by RawFifoQueue::release()
+ */
+
+int release(TestRawFifoQueue& rawFifoQueue, void*)
+{
+	return rawFifoQueue.release();
+}
+
+/**
+ * \brief Tests non-blocking in-place access to storage of the queue.
+ *
+ * \tparam Queue is the type of tested queue
+ *
+ * \param [in] queue is a reference to tested queue, it must be empty
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<typename Queue>
+bool testTryReserveTryPeek(Queue& queue)
+{
+	if (queue.commit() != EPERM || queue.tryPeek().first != EAGAIN)
+		return false;
+
+	uint32_t value {};
+
+	{
+		const auto ret = queue.tryReserve();
+		if (ret.first != 0 || ret.second == nullptr)
+			return false;
+		*static_cast<uint32_t*>(ret.second) = 1;
+	}
+
+	// element pushed after reservation must not be available before the reserved one is committed
+	if (queue.tryPush(uint32_t{2}) != 0 || queue.tryPop(value) != EAGAIN || queue.commit() != 0)
+		return false;
+
+	const auto peekRet = queue.tryPeek();
+	if (peekRet.first != 0 || *static_cast<const uint32_t*>(peekRet.second) != 1 || queue.tryReserve().first != EAGAIN)
+		return false;
+
+	// slot freed after peek must not be available before the peeked one is released
+	if (queue.tryPop(value) != 0 || value != 2 || queue.tryPush(uint32_t{}) != EAGAIN ||
+			release(queue, peekRet.second) != 0)
+		return false;
+
+	for (uint32_t i {}; i < queueSize; ++i)
+		if (queue.tryPush(3 + i) != 0)
+			return false;
+	if (queue.tryPush(uint32_t{}) != EAGAIN)
+		return false;
+
+	for (uint32_t i {}; i < queueSize; ++i)
+		if (queue.tryPop(value) != 0 || value != 3 + i)
+			return false;
+
+	// only the last slot taken for writing may be returned with cancel()
+	{
+		const auto first = queue.tryReserve();
+		const auto second = queue.tryReserve();
+		if (first.first != 0 || second.first != 0 || queue.cancel(first.second) != EBUSY ||
+				queue.cancel(second.second) != 0)
+			return false;
+		*static_cast<uint32_t*>(first.second) = 5;
+
+		// element pushed to returned slot must not be available before the remaining reservation is committed
+		if (queue.tryPush(uint32_t{6}) != 0 || queue.tryPop(value) != EAGAIN || queue.cancel(first.second) != EBUSY ||
+				queue.commit() != 0 || queue.cancel(first.second) != EPERM)
+			return false;
+	}
+
+	for (uint32_t i {}; i < queueSize; ++i)
+		if (queue.tryPop(value) != 0 || value != 5 + i)
+			return false;
+
+	return queue.tryPop(value) == EAGAIN;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether tryReserve(), commit(), tryPeek() and release() of FifoQueue and RawFifoQueue preserve FIFO order of
+ * elements, whether elements and slots are published to the other side only when there are no outstanding
+ * reservations or peeks and whether commit() and release() fail with EPERM when there is nothing to commit or
+ * release. Tests also whether cancel() returns only the last slot taken for writing. No context switch is expected.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	TestFifoQueue fifoQueue;
+	TestRawFifoQueue rawFifoQueue;
+
+	waitForNextTick();
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+	const auto start = TickClock::now();
+
+	if (rawFifoQueue.release() != EPERM)
+		return false;
+
+	if (testTryReserveTryPeek(fifoQueue) == false || testTryReserveTryPeek(rawFifoQueue) == false)
+		return false;
+
+	return TickClock::now() == start && statistics::getContextSwitchCount() == contextSwitchCount;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests whether tryPeekFor(), tryPeekUntil(), tryReserveFor() and tryReserveUntil() properly return ETIMEDOUT when the
+ * queue is empty or full.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	TestFifoQueue fifoQueue;
+	TestRawFifoQueue rawFifoQueue;
+
+	for (size_t i {}; i < 4; ++i)
+	{
+		// the queues must be full for tests of "reserve" functions
+		if (i == 2)
+			for (uint32_t j {}; j < queueSize; ++j)
+				if (fifoQueue.tryPush(j) != 0 || rawFifoQueue.tryPush(j) != 0)
+					return false;
+
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto start = TickClock::now();
+		const auto ret = i == 0 ? fifoQueue.tryPeekFor(singleDuration).first :
+				i == 1 ? rawFifoQueue.tryPeekUntil(start + singleDuration).first :
+				i == 2 ? fifoQueue.tryReserveFor(singleDuration).first :
+				rawFifoQueue.tryReserveUntil(start + singleDuration).first;
+		const auto realDuration = TickClock::now() - start;
+		const auto expectedDuration = i % 2 == 0 ? singleDuration + decltype(singleDuration){1} : singleDuration;
+		if (ret != ETIMEDOUT || realDuration != expectedDuration ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase2TryForUntilContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests thread-thread communication scenario. Main (current) thread waits with peek() and tryPeekFor() on empty queue,
+ * then with reserve() and tryReserveUntil() on full queue. Test thread - which is the other side of the queue - commits
+ * reserved element or releases peeked slot at specified time point. Main thread is expected to be unblocked in the
+ * same moment.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	TestFifoQueue fifoQueue;
+
+	const auto commitFunctor = [&fifoQueue](const TickClock::time_point timePoint)
+			{
+				const auto ret = fifoQueue.tryReserve();
+				if (ret.first != 0)
+					return;
+				new (ret.second) uint32_t{static_cast<uint32_t>(timePoint.time_since_epoch().count())};
+				ThisThread::sleepUntil(timePoint);
+				fifoQueue.commit();
+			};
+	const auto releaseFunctor = [&fifoQueue](const TickClock::time_point timePoint)
+			{
+				const auto ret = fifoQueue.tryPeek();
+				if (ret.first != 0)
+					return;
+				ThisThread::sleepUntil(timePoint);
+				fifoQueue.release(ret.second);
+			};
+
+	for (size_t i {}; i < 4; ++i)
+	{
+		const auto reserve = i >= 2;
+		// the queue must be full for tests of "reserve" functions
+		if (i == 2)
+			for (uint32_t j {}; j < queueSize; ++j)
+				if (fifoQueue.tryPush(j) != 0)
+					return false;
+
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		auto thread = reserve == false ?
+				makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, commitFunctor, wakeUpTimePoint) :
+				makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, releaseFunctor, wakeUpTimePoint);
+
+		ThisThread::yield();
+
+		const auto timeout = wakeUpTimePoint - TickClock::now() + longDuration;
+		const auto ret = i == 0 ? fifoQueue.peek() :
+				i == 1 ? fifoQueue.tryPeekFor(timeout) :
+				i == 2 ? std::pair<int, uint32_t*>{fifoQueue.reserve().first, nullptr} :
+				std::pair<int, uint32_t*>{fifoQueue.tryReserveUntil(wakeUpTimePoint + longDuration).first, nullptr};
+		const auto wokenUpTimePoint = TickClock::now();
+		thread.join();
+		if (ret.first != 0 || wakeUpTimePoint != wokenUpTimePoint ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase3ThreadContextSwitchCount)
+			return false;
+
+		if (reserve == false)
+		{
+			const auto value = *ret.second;
+			if (fifoQueue.release(ret.second) != 0 ||
+					value != static_cast<uint32_t>(wakeUpTimePoint.time_since_epoch().count()))
+				return false;
+		}
+		else if (fifoQueue.commit() != 0)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 4 of test case.
+ *
+ * Tests push() and pop() which block while the reservation (or peek) on the same side is outstanding, and which are
+ * unblocked after that reservation is committed (or released). Element pushed (or slot freed by pop) by test thread
+ * must be published to the other side, even though there was an outstanding reservation when the operation was
+ * started.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase4()
+{
+	{
+		TestFifoQueue fifoQueue;
+
+		if (fifoQueue.tryPush(0) != 0)
+			return false;
+		const auto reservation = fifoQueue.tryReserve();
+		if (reservation.first != 0)
+			return false;
+		new (reservation.second) uint32_t{1};
+
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		// test thread blocks on full queue while the reservation is outstanding
+		auto thread = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX},
+				[&fifoQueue]()
+				{
+					fifoQueue.push(2);
+				});
+
+		// commit the reservation and unblock test thread by popping one element
+		uint32_t value {};
+		if (fifoQueue.commit() != 0 || fifoQueue.tryPop(value) != 0 || value != 0)
+			return false;
+
+		thread.join();
+		if (statistics::getContextSwitchCount() - contextSwitchCount != phase4ThreadContextSwitchCount)
+			return false;
+
+		for (uint32_t i {1}; i < 3; ++i)
+			if (fifoQueue.tryPop(value) != 0 || value != i)
+				return false;
+		if (fifoQueue.tryPop(value) != EAGAIN)
+			return false;
+	}
+	{
+		TestFifoQueue fifoQueue;
+
+		if (fifoQueue.tryPush(0) != 0)
+			return false;
+		const auto peek = fifoQueue.tryPeek();
+		if (peek.first != 0 || *peek.second != 0)
+			return false;
+
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		uint32_t poppedValue {};
+		// test thread blocks on empty queue while the peek is outstanding
+		auto thread = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX},
+				[&fifoQueue, &poppedValue]()
+				{
+					fifoQueue.pop(poppedValue);
+				});
+
+		// release the peeked slot and unblock test thread by pushing one element
+		if (fifoQueue.release(peek.second) != 0 || fifoQueue.tryPush(1) != 0)
+			return false;
+
+		thread.join();
+		if (statistics::getContextSwitchCount() - contextSwitchCount != phase4ThreadContextSwitchCount ||
+				poppedValue != 1)
+			return false;
+
+		for (uint32_t i {}; i < queueSize; ++i)
+			if (fifoQueue.tryPush(i) != 0)
+				return false;
+		if (fifoQueue.tryPush(uint32_t{}) != EAGAIN)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool FifoQueueZeroCopyTestCase::run_() const
+{
+	constexpr auto phase1ExpectedContextSwitchCount = waitForNextTickContextSwitchCount;
+	constexpr auto phase2ExpectedContextSwitchCount = 4 * waitForNextTickContextSwitchCount +
+			4 * phase2TryForUntilContextSwitchCount;
+	constexpr auto phase3ExpectedContextSwitchCount = 4 * waitForNextTickContextSwitchCount +
+			4 * phase3ThreadContextSwitchCount;
+	constexpr auto phase4ExpectedContextSwitchCount = 2 * waitForNextTickContextSwitchCount +
+			2 * phase4ThreadContextSwitchCount;
+	constexpr auto expectedContextSwitchCount = phase1ExpectedContextSwitchCount + phase2ExpectedContextSwitchCount +
+			phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount;
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+	for (const auto& function : {phase1, phase2, phase3, phase4})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	if (statistics::getContextSwitchCount() - contextSwitchCount != expectedContextSwitchCount)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
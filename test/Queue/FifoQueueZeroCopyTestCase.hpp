@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief FifoQueueZeroCopyTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_FIFOQUEUEZEROCOPYTESTCASE_HPP_
+#define TEST_QUEUE_FIFOQUEUEZEROCOPYTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests in-place access to storage of FifoQueue and RawFifoQueue.
+ *
+ * Tests reserve() + commit() and peek() + release() families of functions - order of elements, deferred publishing of
+ * elements and slots while a reservation or peek is outstanding, cancelling of reservations, errors, timeouts and
+ * waking of blocked side of the queue.
+ */
+
+class FifoQueueZeroCopyTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_FIFOQUEUEZEROCOPYTESTCASE_HPP_
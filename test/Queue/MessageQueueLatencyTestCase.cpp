@@ -0,0 +1,182 @@
+/**
+ * \file
+ * \brief MessageQueueLatencyTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "MessageQueueLatencyTestCase.hpp"
+
+#include "cycleMeasurement.hpp"
+
+#include "distortos/StaticMessageQueue.hpp"
+#include "distortos/StaticRawMessageQueue.hpp"
+
+#include <algorithm>
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// maximum number of elements in tested queues
+constexpr size_t queueSize {32};
+
+/// number of measurements for each queue, the shortest time is used
+constexpr size_t measurements {4};
+
+/// number of distinct priorities used in test of order of elements
+constexpr uint8_t orderPriorities {5};
+
+/// max allowed increase of duration of push to almost full queue with priority buckets, percent of duration of push to
+/// empty queue
+constexpr uint32_t maxDepthIncrease {25};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests order of elements in the queue.
+ *
+ * Queue is filled with elements with priorities that repeat in a cycle, so that each priority is used several times.
+ * Elements are expected to be popped in descending order of priority, with FIFO order among elements with the same
+ * priority. The queue is also partially emptied and refilled, so that elements are inserted between existing ones.
+ *
+ * \tparam Queue is the type of tested queue
+ *
+ * \param [in] queue is a reference to tested queue, it must be empty
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<typename Queue>
+bool testOrder(Queue& queue)
+{
+	for (uint32_t i {}; i < queueSize; ++i)
+		if (queue.tryPush(i % orderPriorities, i) != 0)
+			return false;
+
+	uint8_t priority;
+	uint32_t value;
+
+	// pop half of the elements - all of them have the highest priorities
+	for (uint32_t i {}; i < queueSize / 2; ++i)
+		if (queue.tryPop(priority, value) != 0)
+			return false;
+
+	for (uint32_t i {}; i < queueSize / 2; ++i)
+		if (queue.tryPush((queueSize + i) % orderPriorities, queueSize + i) != 0)
+			return false;
+
+	auto previousPriority = UINT8_MAX;
+	uint32_t previousValue {};
+	for (size_t i {}; i < queueSize; ++i)
+	{
+		if (queue.tryPop(priority, value) != 0 || value % orderPriorities != priority ||
+				priority > previousPriority || (priority == previousPriority && value <= previousValue))
+			return false;
+
+		previousPriority = priority;
+		previousValue = value;
+	}
+
+	return queue.tryPop(priority, value) == EAGAIN;
+}
+
+/**
+ * \brief Measures time of worst-case push to the queue.
+ *
+ * The queue is filled with queueSize - 1 elements with distinct priorities in descending order, then the element with
+ * lowest priority is pushed - for sorted list of entries this requires traversal of whole list.
+ *
+ * \tparam Queue is the type of tested queue
+ *
+ * \param [in] queue is a reference to tested queue, it must be empty
+ * \param [in] empty selects whether the measured push is done to empty queue (true) or to almost full queue (false)
+ *
+ * \return the shortest time of push, core clock cycles, 0 if any operation failed
+ */
+
+template<typename Queue>
+uint32_t measurePushCycles(Queue& queue, const bool empty)
+{
+	auto cycles = UINT32_MAX;
+	for (size_t i {}; i < measurements; ++i)
+	{
+		const auto elements = empty == false ? queueSize - 1 : 0;
+		for (size_t j {}; j < elements; ++j)
+			if (queue.tryPush(UINT8_MAX - j, uint32_t{}) != 0)
+				return 0;
+
+		const auto begin = getCycleCount();
+		const auto ret = queue.tryPush(0, uint32_t{});
+		cycles = std::min(cycles, getCycleCount() - begin);
+		if (ret != 0)
+			return 0;
+
+		uint8_t priority;
+		uint32_t value;
+		for (size_t j {}; j < elements + 1; ++j)
+			if (queue.tryPop(priority, value) != 0)
+				return 0;
+	}
+
+	return cycles;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MessageQueueLatencyTestCase::run_() const
+{
+	{
+		StaticMessageQueue<uint32_t, queueSize, true> messageQueue;
+		StaticRawMessageQueue<uint32_t, queueSize, true> rawMessageQueue;
+		if (testOrder(messageQueue) == false || testOrder(rawMessageQueue) == false)
+			return false;
+	}
+	{
+		StaticRawMessageQueue<uint32_t, queueSize> rawMessageQueue;
+		const auto cycles = measurePushCycles(rawMessageQueue, false);
+		if (cycles == 0)
+			return false;
+		reportCycles("sorted list push", cycles);
+	}
+	{
+		StaticRawMessageQueue<uint32_t, queueSize, true> rawMessageQueue;
+		const auto cycles = measurePushCycles(rawMessageQueue, false);
+		const auto emptyCycles = measurePushCycles(rawMessageQueue, true);
+		if (cycles == 0 || emptyCycles == 0)
+			return false;
+		reportCycles("priority buckets push", cycles);
+		reportCycles("priority buckets push to empty queue", emptyCycles);
+
+		// with priority buckets duration of push must not depend on the number of elements in the queue
+		if (cycles * 100 > emptyCycles * (100 + maxDepthIncrease))
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,51 @@
+/**
+ * \file
+ * \brief MessageQueueLatencyTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_MESSAGEQUEUELATENCYTESTCASE_HPP_
+#define TEST_QUEUE_MESSAGEQUEUELATENCYTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests order of elements and worst-case latency of message queues with priority buckets.
+ *
+ * Checks whether message queues with priority buckets pop elements in the same order as message queues with sorted list
+ * of entries - highest priority first, FIFO order among elements with the same priority. Measures time (in core clock
+ * cycles) of worst-case push - element with lowest priority pushed to almost full queue with elements of distinct
+ * higher priorities - for both variants. Measured values are reported with reportCycles(). For priority buckets the
+ * worst-case push must take about the same time as push to empty queue, as its duration must not depend on the number
+ * of elements in the queue.
+ */
+
+class MessageQueueLatencyTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_MESSAGEQUEUELATENCYTESTCASE_HPP_
@@ -0,0 +1,327 @@
+/**
+ * \file
+ * \brief SpscQueueOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "SpscQueueOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/StaticSpscQueue.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// maximum number of elements in tested queue
+constexpr size_t queueSize {3};
+
+/// type of tested queue
+using TestSpscQueue = StaticSpscQueue<uint32_t, queueSize>;
+
+/// number of elements transferred in phase1 - enough to wrap around positions of the queue a few times
+constexpr size_t phase1Elements {queueSize * 5};
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// expected number of context switches in waitForNextTick(): main -> idle -> main
+constexpr decltype(statistics::getContextSwitchCount()) waitForNextTickContextSwitchCount {2};
+
+/// expected number of context switches in phase2 block involving timed function (excluding waitForNextTick()): 1 - main
+/// thread blocks on queue (main -> idle), 2 - main thread wakes up (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase2TryForUntilContextSwitchCount {2};
+
+/// expected number of context switches in phase3 block involving test thread (excluding waitForNextTick()): 1 - test
+/// thread starts (main -> test), 2 - test thread goes to sleep (test -> main), 3 - main thread blocks on queue (main ->
+/// idle), 4 - test thread wakes (idle -> test), 5 - test thread terminates (test -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase3ThreadContextSwitchCount {5};
+
+/// expected number of context switches in phase4 block involving software timer (excluding waitForNextTick()): 1 - main
+/// thread blocks on queue (main -> idle), 2 - main thread is unblocked by interrupt (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase4SoftwareTimerContextSwitchCount {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Converts time point to value that can be pushed to the queue.
+ *
+ * \param [in] timePoint is the time point that will be converted
+ *
+ * \return \a timePoint converted to value of element
+ */
+
+uint32_t toValue(const TickClock::time_point timePoint)
+{
+	return timePoint.time_since_epoch().count();
+}
+
+/**
+ * \brief Fills the queue with consecutive values.
+ *
+ * \param [in] spscQueue is a reference to queue that will be filled
+ * \param [in] firstValue is the value of first element
+ *
+ * \return true if the queue was filled and no more elements could be pushed, false otherwise
+ */
+
+bool fill(TestSpscQueue& spscQueue, const uint32_t firstValue)
+{
+	for (size_t i {}; i < queueSize; ++i)
+		if (spscQueue.tryPush(firstValue + i) != 0)
+			return false;
+
+	return spscQueue.tryPush(uint32_t{}) == EAGAIN;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether tryPop() and tryPush() transfer elements in FIFO order - also when positions of the queue wrap around -
+ * and whether they fail with EAGAIN when the queue is empty or full, without any context switch.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	TestSpscQueue spscQueue;
+
+	waitForNextTick();
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+	const auto start = TickClock::now();
+
+	uint32_t value {};
+	if (spscQueue.tryPop(value) != EAGAIN)
+		return false;
+
+	if (fill(spscQueue, 0) == false)
+		return false;
+
+	for (uint32_t i {}; i < queueSize; ++i)
+		if (spscQueue.tryPop(value) != 0 || value != i)
+			return false;
+
+	if (spscQueue.tryPop(value) != EAGAIN)
+		return false;
+
+	// push and pop with queue partially filled, so that positions wrap around
+	if (spscQueue.tryPush(0) != 0)
+		return false;
+	for (uint32_t i {1}; i < phase1Elements; ++i)
+		if (spscQueue.tryPush(i) != 0 || spscQueue.tryPop(value) != 0 || value != i - 1)
+			return false;
+	if (spscQueue.tryPop(value) != 0 || value != phase1Elements - 1 || spscQueue.tryPop(value) != EAGAIN)
+		return false;
+
+	return TickClock::now() == start && statistics::getContextSwitchCount() == contextSwitchCount;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests whether tryPopFor(), tryPopUntil(), tryPushFor() and tryPushUntil() properly return ETIMEDOUT when the queue is
+ * empty or full.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	TestSpscQueue spscQueue;
+
+	for (size_t i {}; i < 4; ++i)
+	{
+		// the queue must be full for tests of "push" functions
+		if (i == 2 && fill(spscQueue, 0) == false)
+			return false;
+
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto start = TickClock::now();
+		uint32_t value {};
+		const auto ret = i == 0 ? spscQueue.tryPopFor(singleDuration, value) :
+				i == 1 ? spscQueue.tryPopUntil(start + singleDuration, value) :
+				i == 2 ? spscQueue.tryPushFor(singleDuration, value) :
+				spscQueue.tryPushUntil(start + singleDuration, value);
+		const auto realDuration = TickClock::now() - start;
+		const auto expectedDuration = i % 2 == 0 ? singleDuration + decltype(singleDuration){1} : singleDuration;
+		if (ret != ETIMEDOUT || realDuration != expectedDuration ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase2TryForUntilContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests thread-thread communication scenario. Main (current) thread waits with pop(), tryPopFor() and tryPopUntil() on
+ * empty queue, then with push(), tryPushFor() and tryPushUntil() on full queue. Test thread - which is the other side
+ * of the queue - pushes or pops one element at specified time point. Main thread is expected to be unblocked in the
+ * same moment.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	TestSpscQueue spscQueue;
+
+	const auto pushFunctor = [&spscQueue](const TickClock::time_point timePoint)
+			{
+				ThisThread::sleepUntil(timePoint);
+				spscQueue.tryPush(toValue(timePoint));
+			};
+	const auto popFunctor = [&spscQueue](const TickClock::time_point timePoint)
+			{
+				ThisThread::sleepUntil(timePoint);
+				uint32_t value;
+				spscQueue.tryPop(value);
+			};
+
+	for (size_t i {}; i < 6; ++i)
+	{
+		const auto push = i >= 3;
+		// the queue must be full for tests of "push" functions
+		if (i == 3 && fill(spscQueue, 0) == false)
+			return false;
+
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		auto thread = push == false ?
+				makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, pushFunctor, wakeUpTimePoint) :
+				makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, popFunctor, wakeUpTimePoint);
+
+		ThisThread::yield();
+
+		uint32_t value {};
+		const auto timeout = wakeUpTimePoint - TickClock::now() + longDuration;
+		const auto ret = i == 0 ? spscQueue.pop(value) :
+				i == 1 ? spscQueue.tryPopFor(timeout, value) :
+				i == 2 ? spscQueue.tryPopUntil(wakeUpTimePoint + longDuration, value) :
+				i == 3 ? spscQueue.push(value) :
+				i == 4 ? spscQueue.tryPushFor(timeout, value) :
+				spscQueue.tryPushUntil(wakeUpTimePoint + longDuration, value);
+		const auto wokenUpTimePoint = TickClock::now();
+		thread.join();
+		if (ret != 0 || wakeUpTimePoint != wokenUpTimePoint ||
+				(push == false && value != toValue(wakeUpTimePoint)) ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase3ThreadContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 4 of test case.
+ *
+ * Tests interrupt-thread communication scenario. Main (current) thread waits with pop(), tryPopFor() and tryPopUntil()
+ * on empty queue. Software timer is used to push an element at specified time point from interrupt context, main
+ * thread is expected to be unblocked in the same moment.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase4()
+{
+	TestSpscQueue spscQueue;
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&spscQueue]()
+			{
+				spscQueue.tryPush(toValue(TickClock::now()));
+			});
+
+	for (size_t i {}; i < 3; ++i)
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+
+		softwareTimer.start(wakeUpTimePoint);
+
+		uint32_t value {};
+		const auto ret = i == 0 ? spscQueue.pop(value) :
+				i == 1 ? spscQueue.tryPopFor(wakeUpTimePoint - TickClock::now() + longDuration, value) :
+				spscQueue.tryPopUntil(wakeUpTimePoint + longDuration, value);
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret != 0 || value != toValue(wakeUpTimePoint) || wakeUpTimePoint != wokenUpTimePoint ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase4SoftwareTimerContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SpscQueueOperationsTestCase::run_() const
+{
+	constexpr auto phase1ExpectedContextSwitchCount = waitForNextTickContextSwitchCount;
+	constexpr auto phase2ExpectedContextSwitchCount = 4 * waitForNextTickContextSwitchCount +
+			4 * phase2TryForUntilContextSwitchCount;
+	constexpr auto phase3ExpectedContextSwitchCount = 6 * waitForNextTickContextSwitchCount +
+			6 * phase3ThreadContextSwitchCount;
+	constexpr auto phase4ExpectedContextSwitchCount = 3 * waitForNextTickContextSwitchCount +
+			3 * phase4SoftwareTimerContextSwitchCount;
+	constexpr auto expectedContextSwitchCount = phase1ExpectedContextSwitchCount + phase2ExpectedContextSwitchCount +
+			phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount;
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+	for (const auto& function : {phase1, phase2, phase3, phase4})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	if (statistics::getContextSwitchCount() - contextSwitchCount != expectedContextSwitchCount)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,47 @@
+/**
+ * \file
+ * \brief SpscQueueOperationsTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_SPSCQUEUEOPERATIONSTESTCASE_HPP_
+#define TEST_QUEUE_SPSCQUEUEOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various SpscQueue operations.
+ *
+ * Tests order of elements, behaviour of non-blocking functions when the queue is empty or full, timeouts and waking of
+ * blocked side of the queue - both from thread and from interrupt context.
+ */
+
+class SpscQueueOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_SPSCQUEUEOPERATIONSTESTCASE_HPP_
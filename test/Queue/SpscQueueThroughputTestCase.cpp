@@ -0,0 +1,111 @@
+/**
+ * \file
+ * \brief SpscQueueThroughputTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "SpscQueueThroughputTestCase.hpp"
+
+#include "cycleMeasurement.hpp"
+
+#include "distortos/StaticRawFifoQueue.hpp"
+#include "distortos/StaticSpscQueue.hpp"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// maximum number of elements in tested queues
+constexpr size_t queueSize {64};
+
+/// number of measurements for each queue, the shortest time is used
+constexpr size_t measurements {4};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Measures time of transfer of bytes through the queue.
+ *
+ * The queue is filled with queueSize bytes using tryPush() and then emptied using tryPop(), which is the pattern of
+ * interrupt handler (producer) and thread (consumer) processing a burst of data.
+ *
+ * \tparam Queue is the type of tested queue
+ *
+ * \param [in] queue is a reference to tested queue
+ *
+ * \return the shortest time of transfer of queueSize bytes, core clock cycles, 0 if transfer failed
+ */
+
+template<typename Queue>
+uint32_t measureCycles(Queue& queue)
+{
+	auto cycles = UINT32_MAX;
+	for (size_t i {}; i < measurements; ++i)
+	{
+		const auto begin = getCycleCount();
+
+		for (size_t j {}; j < queueSize; ++j)
+			if (queue.tryPush(static_cast<uint8_t>(j)) != 0)
+				return 0;
+
+		for (size_t j {}; j < queueSize; ++j)
+		{
+			uint8_t value;
+			if (queue.tryPop(value) != 0 || value != static_cast<uint8_t>(j))
+				return 0;
+		}
+
+		cycles = std::min(cycles, getCycleCount() - begin);
+	}
+
+	return cycles;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SpscQueueThroughputTestCase::run_() const
+{
+	StaticSpscQueue<uint8_t, queueSize> spscQueue;
+	const auto spscQueueCycles = measureCycles(spscQueue);
+	if (spscQueueCycles == 0)
+		return false;
+	reportCycles("SpscQueue transfer", spscQueueCycles);
+
+	StaticRawFifoQueue<uint8_t, queueSize> rawFifoQueue;
+	const auto rawFifoQueueCycles = measureCycles(rawFifoQueue);
+	if (rawFifoQueueCycles == 0)
+		return false;
+	reportCycles("RawFifoQueue transfer", rawFifoQueueCycles);
+
+	// SpscQueue doesn't use kernel for transfers which don't block, so it must be faster than RawFifoQueue
+	if (spscQueueCycles >= rawFifoQueueCycles)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief SpscQueueThroughputTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_SPSCQUEUETHROUGHPUTTESTCASE_HPP_
+#define TEST_QUEUE_SPSCQUEUETHROUGHPUTTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Benchmark of throughput of SpscQueue.
+ *
+ * Measures time (in core clock cycles) of transfer of a burst of bytes through SpscQueue and through RawFifoQueue with
+ * non-blocking functions. Measured values are reported with reportCycles(). The test case fails if any transfer fails,
+ * returns wrong values or if SpscQueue is not faster than RawFifoQueue.
+ */
+
+class SpscQueueThroughputTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_SPSCQUEUETHROUGHPUTTESTCASE_HPP_
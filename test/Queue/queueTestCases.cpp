@@ -2,7 +2,7 @@
  * \file
  * \brief queueTestCases object definition
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,8 +12,13 @@
 #include "queueTestCases.hpp"
 
 #include "QueueOperationsTestCase.hpp"
+#include "FifoQueueBatchOperationsTestCase.hpp"
+#include "FifoQueueZeroCopyTestCase.hpp"
 #include "FifoQueuePriorityTestCase.hpp"
 #include "MessageQueuePriorityTestCase.hpp"
+#include "MessageQueueLatencyTestCase.hpp"
+#include "SpscQueueOperationsTestCase.hpp"
+#include "SpscQueueThroughputTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -33,18 +38,38 @@ namespace
 /// QueueOperationsTestCase instance
 const QueueOperationsTestCase operationsTestCase;
 
+/// FifoQueueBatchOperationsTestCase instance
+const FifoQueueBatchOperationsTestCase fifoQueueBatchOperationsTestCase;
+
+/// FifoQueueZeroCopyTestCase instance
+const FifoQueueZeroCopyTestCase fifoQueueZeroCopyTestCase;
+
 /// FifoQueuePriorityTestCase instance
 const FifoQueuePriorityTestCase fifoQueuePriorityTestCase;
 
 /// MessageQueuePriorityTestCase instance
 const MessageQueuePriorityTestCase messageQueuePriorityTestCase;
 
+/// MessageQueueLatencyTestCase instance
+const MessageQueueLatencyTestCase messageQueueLatencyTestCase;
+
+/// SpscQueueOperationsTestCase instance
+const SpscQueueOperationsTestCase spscQueueOperationsTestCase;
+
+/// SpscQueueThroughputTestCase instance
+const SpscQueueThroughputTestCase spscQueueThroughputTestCase;
+
 /// array with references to TestCase objects related to queue
 const TestCaseGroup::Range::value_type queueTestCases_[]
 {
 		TestCaseGroup::Range::value_type{operationsTestCase},
+		TestCaseGroup::Range::value_type{fifoQueueBatchOperationsTestCase},
+		TestCaseGroup::Range::value_type{fifoQueueZeroCopyTestCase},
 		TestCaseGroup::Range::value_type{fifoQueuePriorityTestCase},
 		TestCaseGroup::Range::value_type{messageQueuePriorityTestCase},
+		TestCaseGroup::Range::value_type{messageQueueLatencyTestCase},
+		TestCaseGroup::Range::value_type{spscQueueOperationsTestCase},
+		TestCaseGroup::Range::value_type{spscQueueThroughputTestCase},
 };
 
 }	// namespace
@@ -29,6 +29,7 @@
 #include "distortos/statistics.hpp"
 #include "distortos/ThisThread.hpp"
 #include "distortos/ThisThread-Signals.hpp"
+#include "distortos/waitAny.hpp"
 
 #include <cerrno>
 
@@ -629,6 +630,92 @@ private:
 	Type type_;
 };
 
+/// test step for waiting for any of objects
+class WaitAnyTestStep : public TestStep
+{
+public:
+
+	/// type of waitAny() test step
+	enum class Type : uint8_t
+	{
+		/// uses waitAny()
+		waitAny,
+		/// uses tryWaitAnyFor()
+		tryWaitAnyFor,
+		/// uses tryWaitAnyUntil()
+		tryWaitAnyUntil,
+	};
+
+	/**
+	 * \brief WaitAnyTestStep's constructor
+	 *
+	 * \param [in] type is the type of test step
+	 */
+
+	explicit WaitAnyTestStep(const Type type) :
+			TestStep{4, 6, 0, 1, 2, 3},
+			firstSemaphore_{0},
+			secondSemaphore_{0},
+			type_{type}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Executes the action that will block current thread.
+	 *
+	 * Calls waitAny(), tryWaitAnyFor() or tryWaitAnyUntil() - depending on the type of test step - and ensures that the
+	 * function returns with EINTR error code.
+	 *
+	 * \return true if execution of blocking action succeeded, false otherwise
+	 */
+
+	bool block() override
+	{
+		const WaitAnyObject objects[] {firstSemaphore_, secondSemaphore_};
+		const auto ret = type_ == Type::waitAny ? waitAny(WaitAnyObjects{objects}) :
+				type_ == Type::tryWaitAnyFor ? tryWaitAnyFor(longDuration, WaitAnyObjects{objects}) :
+				tryWaitAnyUntil(TickClock::now() + longDuration, WaitAnyObjects{objects});
+		return ret.first == EINTR;
+	}
+
+	/**
+	 * \brief Checks postcondition of the test step.
+	 *
+	 * Checks state of semaphores after interruption.
+	 *
+	 * \return true if postcondition was satisfied, false otherwise
+	 */
+
+	bool postcondition() override
+	{
+		if (firstSemaphore_.getValue() != 0 || secondSemaphore_.getValue() != 0)	// semaphores must not be modified
+			return false;
+		if (secondSemaphore_.post() != 0)	// interrupted thread must not be waiting anymore
+			return false;
+
+		const WaitAnyObject objects[] {firstSemaphore_, secondSemaphore_};
+		const auto ret = tryWaitAnyFor(TickClock::duration{}, WaitAnyObjects{objects});
+		if (ret.first != 0 || ret.second != 1)	// after single "post", second semaphore must be "ready" immediately
+			return false;
+		if (secondSemaphore_.tryWait() != 0 || secondSemaphore_.tryWait() != EAGAIN)
+			return false;
+
+		return true;
+	}
+
+	/// first tested object
+	Semaphore firstSemaphore_;
+
+	/// second tested object
+	Semaphore secondSemaphore_;
+
+	/// type of test step
+	Type type_;
+};
+
 /// type of test step
 enum class TestStepType : uint8_t
 {
@@ -662,6 +749,12 @@ enum class TestStepType : uint8_t
 	sleepFor,
 	/// SleepTestStep, SleepTestStep::Type::sleepUntil
 	sleepUntil,
+	/// WaitAnyTestStep, WaitAnyTestStep::Type::waitAny
+	waitAny,
+	/// WaitAnyTestStep, WaitAnyTestStep::Type::tryWaitAnyFor
+	tryWaitAnyFor,
+	/// WaitAnyTestStep, WaitAnyTestStep::Type::tryWaitAnyUntil
+	tryWaitAnyUntil,
 };
 
 /// uninitialized storage for any of test steps
@@ -680,6 +773,8 @@ union TestStepStorage
 	std::aligned_storage<sizeof(SignalsTestStep), alignof(SignalsTestStep)>::type signalsTestStepStorage;
 	/// storage for SleepTestStep
 	std::aligned_storage<sizeof(SleepTestStep), alignof(SleepTestStep)>::type sleepTestStepStorage;
+	/// storage for WaitAnyTestStep
+	std::aligned_storage<sizeof(WaitAnyTestStep), alignof(WaitAnyTestStep)>::type waitAnyTestStepStorage;
 };
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -704,6 +799,9 @@ const TestStepType testStepTypes[]
 		TestStepType::signalsTryWaitUntil,
 		TestStepType::sleepFor,
 		TestStepType::sleepUntil,
+		TestStepType::waitAny,
+		TestStepType::tryWaitAnyFor,
+		TestStepType::tryWaitAnyUntil,
 };
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -751,8 +849,14 @@ TestStep& makeTestStep(const TestStepType testStepType, TestStepStorage& testSte
 		return *new (&testStepStorage) SignalsTestStep {SignalsTestStep::Type::tryWaitUntil};
 	else if (testStepType == TestStepType::sleepFor)
 		return *new (&testStepStorage) SleepTestStep {SleepTestStep::Type::sleepFor};
-	else // if (testStepType == TestStepType::sleepUntil)
+	else if (testStepType == TestStepType::sleepUntil)
 		return *new (&testStepStorage) SleepTestStep {SleepTestStep::Type::sleepUntil};
+	else if (testStepType == TestStepType::waitAny)
+		return *new (&testStepStorage) WaitAnyTestStep {WaitAnyTestStep::Type::waitAny};
+	else if (testStepType == TestStepType::tryWaitAnyFor)
+		return *new (&testStepStorage) WaitAnyTestStep {WaitAnyTestStep::Type::tryWaitAnyFor};
+	else // if (testStepType == TestStepType::tryWaitAnyUntil)
+		return *new (&testStepStorage) WaitAnyTestStep {WaitAnyTestStep::Type::tryWaitAnyUntil};
 }
 
 }	// namespace
@@ -0,0 +1,201 @@
+/**
+ * \file
+ * \brief SoftwareTimerSlackTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "SoftwareTimerSlackTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/ThisThread.hpp"
+#include "distortos/Thread.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// alignment of tick in which coalesced software timers expire, all windows contain exactly one such tick
+constexpr TickClock::rep alignment {64};
+
+/// slack used in test case
+constexpr TickClock::duration slack {16};
+
+/// total number of one-shot software timers used in test case
+constexpr size_t totalSoftwareTimers {4};
+
+/// offset of requested time point of each one-shot software timer, before aligned tick
+constexpr TickClock::duration offsets[totalSoftwareTimers] {TickClock::duration{10}, TickClock::duration{7},
+		TickClock::duration{4}, TickClock::duration{1}};
+
+/// period of periodic software timer
+constexpr TickClock::duration period {10};
+
+/// slack of periodic software timer
+constexpr TickClock::duration periodicSlack {3};
+
+/// number of executions of periodic software timer
+constexpr size_t totalExecutions {10};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \return first aligned tick which is at least "alignment" ticks in the future
+ */
+
+TickClock::time_point getAlignedTimePoint()
+{
+	const auto now = TickClock::now().time_since_epoch().count();
+	return TickClock::time_point{TickClock::duration{(now / alignment + 2) * alignment}};
+}
+
+/**
+ * \brief Function executed by one-shot software timers.
+ *
+ * \param [out] timePoint is a reference to variable in which time point of execution will be saved
+ */
+
+void saveTimePoint(TickClock::time_point& timePoint)
+{
+	timePoint = TickClock::now();
+}
+
+/**
+ * \brief Function executed by periodic software timer.
+ *
+ * \param [out] timePoints is a reference to array in which time points of executions will be saved
+ * \param [in,out] counter is a reference to counter of executions
+ */
+
+void saveTimePoints(std::array<TickClock::time_point, totalExecutions>& timePoints, size_t& counter)
+{
+	if (counter < timePoints.size())
+		timePoints[counter] = TickClock::now();
+	++counter;
+}
+
+/**
+ * \brief Tests coalescing of one-shot software timers.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testOneShot()
+{
+	std::array<TickClock::time_point, totalSoftwareTimers> timePoints {};
+	using TestSoftwareTimer = decltype(makeStaticSoftwareTimer(saveTimePoint,
+			std::ref(std::declval<TickClock::time_point&>())));
+	std::array<TestSoftwareTimer, totalSoftwareTimers> softwareTimers
+	{{
+			makeStaticSoftwareTimer(saveTimePoint, std::ref(timePoints[0])),
+			makeStaticSoftwareTimer(saveTimePoint, std::ref(timePoints[1])),
+			makeStaticSoftwareTimer(saveTimePoint, std::ref(timePoints[2])),
+			makeStaticSoftwareTimer(saveTimePoint, std::ref(timePoints[3])),
+	}};
+
+	waitForNextTick();
+	const auto alignedTimePoint = getAlignedTimePoint();
+	for (size_t i {}; i < softwareTimers.size(); ++i)
+	{
+		softwareTimers[i].setSlack(slack);
+		softwareTimers[i].start(alignedTimePoint - offsets[i]);
+	}
+
+	ThisThread::sleepUntil(alignedTimePoint + slack * 2);
+
+	// all software timers must be executed in the single tick which is in all windows
+	for (const auto timePoint : timePoints)
+		if (timePoint != alignedTimePoint)
+			return false;
+
+	return true;
+}
+
+/**
+ * \brief Tests periodic software timer with slack.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testPeriodic()
+{
+	std::array<TickClock::time_point, totalExecutions> timePoints {};
+	size_t counter {};
+	auto softwareTimer = makeStaticSoftwareTimer(saveTimePoints, std::ref(timePoints), std::ref(counter));
+	softwareTimer.setSlack(periodicSlack);
+
+	waitForNextTick();
+	const auto start = TickClock::now() + period;
+	softwareTimer.start(start, period);
+	ThisThread::sleepUntil(start + period * (totalExecutions - 1) + periodicSlack + TickClock::duration{1});
+	softwareTimer.stop();
+
+	if (counter != totalExecutions)
+		return false;
+
+	// each execution must be in its own window - periods are not accumulating delays caused by slack
+	for (size_t i {}; i < timePoints.size(); ++i)
+	{
+		const auto requestedTimePoint = start + period * i;
+		if (timePoints[i] < requestedTimePoint || timePoints[i] > requestedTimePoint + periodicSlack)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Tests coalescing of timeouts of blocking functions.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testTimeout()
+{
+	auto& thread = ThisThread::get();
+	if (thread.getTimerSlack() != TickClock::duration{})
+		return false;
+
+	thread.setTimerSlack(slack);
+	waitForNextTick();
+	const auto alignedTimePoint = getAlignedTimePoint();
+	const auto ret = ThisThread::sleepUntil(alignedTimePoint - offsets[0]);
+	const auto wokenUpTimePoint = TickClock::now();
+	thread.setTimerSlack({});
+
+	return ret == 0 && wokenUpTimePoint == alignedTimePoint;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SoftwareTimerSlackTestCase::run_() const
+{
+	return testOneShot() == true && testPeriodic() == true && testTimeout() == true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
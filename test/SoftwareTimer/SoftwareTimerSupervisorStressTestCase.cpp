@@ -0,0 +1,191 @@
+/**
+ * \file
+ * \brief SoftwareTimerSupervisorStressTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "SoftwareTimerSupervisorStressTestCase.hpp"
+
+#include "cycleMeasurement.hpp"
+
+#include "distortos/architecture/getCycleCount.hpp"
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+#include "distortos/internal/scheduler/SoftwareTimerControlBlock.hpp"
+#include "distortos/internal/scheduler/SoftwareTimerWheel.hpp"
+
+#include "distortos/StaticSoftwareTimer.hpp"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <malloc.h>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// SoftwareTimerControlBlock with public access to expiration time point
+class TestSoftwareTimerControlBlock : public internal::SoftwareTimerControlBlock
+{
+public:
+
+	using SoftwareTimerControlBlock::SoftwareTimerControlBlock;
+	using SoftwareTimerListNode::setTimePoint;
+};
+
+/// vector of TestSoftwareTimerControlBlock objects
+using TestSoftwareTimerControlBlocks = std::vector<TestSoftwareTimerControlBlock>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of software timers in each container
+constexpr size_t softwareTimers {100};
+
+/// range of pseudo-random expiration time points, spans a few levels of the wheel
+constexpr TickClock::rep timePointRange {5000};
+
+/// minimal ratio of worst-case insertion durations of sorted list and timing wheel
+constexpr uint32_t minimalSpeedup {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Dummy runner of software timer's function.
+ */
+
+void dummyFunctionRunner(SoftwareTimer&)
+{
+
+}
+
+/**
+ * \brief Creates software timers with pseudo-random expiration time points.
+ *
+ * The same sequence of time points is generated on each call.
+ *
+ * \param [in] owner is a reference to SoftwareTimer object used as owner of all created software timers
+ *
+ * \return vector with created software timers
+ */
+
+TestSoftwareTimerControlBlocks makeSoftwareTimers(SoftwareTimer& owner)
+{
+	TestSoftwareTimerControlBlocks softwareTimerControlBlocks;
+	softwareTimerControlBlocks.reserve(softwareTimers);
+
+	std::minstd_rand generator;
+	std::uniform_int_distribution<TickClock::rep> distribution {1, timePointRange};
+	for (size_t i {}; i < softwareTimers; ++i)
+	{
+		softwareTimerControlBlocks.emplace_back(dummyFunctionRunner, owner);
+		softwareTimerControlBlocks.back().setTimePoint(TickClock::time_point{TickClock::duration{
+				distribution(generator)}});
+	}
+
+	return softwareTimerControlBlocks;
+}
+
+/**
+ * \brief Inserts software timers into container and measures worst-case duration of insertion.
+ *
+ * \tparam Container is the type of container, internal::SoftwareTimerList or internal::SoftwareTimerWheel
+ *
+ * \param [in] container is a reference to container into which software timers will be inserted
+ * \param [in] softwareTimerControlBlocks is a reference to vector with software timers
+ *
+ * \return worst-case duration of single insertion, core clock cycles
+ */
+
+template<typename Container>
+uint32_t insertSoftwareTimers(Container& container, TestSoftwareTimerControlBlocks& softwareTimerControlBlocks)
+{
+	uint32_t maxCycles {};
+	for (auto& softwareTimerControlBlock : softwareTimerControlBlocks)
+	{
+		const architecture::InterruptMaskingLock interruptMaskingLock;
+		const auto start = architecture::getCycleCount();
+		container.insert(softwareTimerControlBlock);
+		const auto cycles = architecture::getCycleCount() - start;
+		if (cycles > maxCycles)
+			maxCycles = cycles;
+	}
+
+	return maxCycles;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SoftwareTimerSupervisorStressTestCase::run_() const
+{
+	const auto allocatedMemory = mallinfo().uordblks;
+
+	{
+		auto owner = makeStaticSoftwareTimer([](){});
+
+		auto listSoftwareTimerControlBlocks = makeSoftwareTimers(owner);
+		internal::SoftwareTimerList list;
+		const auto listCycles = insertSoftwareTimers(list, listSoftwareTimerControlBlocks);
+		reportCycles("SoftwareTimerList::insert()", listCycles);
+
+		auto wheelSoftwareTimerControlBlocks = makeSoftwareTimers(owner);
+		std::unique_ptr<internal::SoftwareTimerWheel> wheel {new internal::SoftwareTimerWheel};
+		const auto wheelCycles = insertSoftwareTimers(*wheel, wheelSoftwareTimerControlBlocks);
+		reportCycles("SoftwareTimerWheel::insert()", wheelCycles);
+
+		if (wheelCycles * minimalSpeedup > listCycles)
+			return false;
+
+		// both containers must expire software timers in the same order of time points
+		TickClock::time_point previousTimePoint {};
+		for (size_t i {}; i < softwareTimers; ++i)
+		{
+			const auto softwareTimerControlBlock =
+					wheel->getExpired(TickClock::time_point{TickClock::duration{timePointRange}});
+			if (softwareTimerControlBlock == nullptr || list.empty() == true)
+				return false;
+
+			const auto timePoint = softwareTimerControlBlock->getTimePoint();
+			if (timePoint != list.front().getTimePoint() || timePoint < previousTimePoint)
+				return false;
+
+			list.pop_front();
+			previousTimePoint = timePoint;
+		}
+
+		if (wheel->getExpired(TickClock::time_point{TickClock::duration{timePointRange}}) != nullptr ||
+				wheel->getNextTimePoint().first != false || list.empty() != true)
+			return false;
+	}
+
+	if (mallinfo().uordblks != allocatedMemory)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief SoftwareTimerSupervisorStressTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_SOFTWARETIMER_SOFTWARETIMERSUPERVISORSTRESSTESTCASE_HPP_
+#define TEST_SOFTWARETIMER_SOFTWARETIMERSUPERVISORSTRESSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Compares sorted list and timing wheel of software timers.
+ *
+ * Many software timers with pseudo-random expiration time points are inserted into internal::SoftwareTimerList and
+ * into internal::SoftwareTimerWheel. Worst-case duration of single insertion (done with interrupts masked, just like
+ * in internal::SoftwareTimerSupervisor) is measured for both containers and reported with reportCycles(). Worst case
+ * of timing wheel must be at least a few times shorter than worst case of sorted list, which has to traverse most of
+ * the software timers. Both containers must return the software timers in the same order of expiration time points.
+ */
+
+class SoftwareTimerSupervisorStressTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_SOFTWARETIMER_SOFTWARETIMERSUPERVISORSTRESSTESTCASE_HPP_
@@ -0,0 +1,130 @@
+/**
+ * \file
+ * \brief SoftwareTimerThreadTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "SoftwareTimerThreadTestCase.hpp"
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/architecture/isInInterruptContext.hpp"
+
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/ThisThread.hpp"
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+namespace distortos
+{
+
+namespace test
+{
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests context in which software timer's function is executed.
+ *
+ * \param [in] interruptContext selects whether software timer's function should be executed in interrupt context
+ * (true) or in software timer thread (false)
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testContext(const bool interruptContext)
+{
+	bool executed {};
+	bool inInterruptContext {};
+	const Thread* thread {};
+	auto softwareTimer = makeStaticSoftwareTimer([&executed, &inInterruptContext, &thread]()
+			{
+				executed = true;
+				inInterruptContext = architecture::isInInterruptContext();
+				thread = &ThisThread::get();
+			});
+	softwareTimer.setInterruptContext(interruptContext);
+
+	waitForNextTick();
+	softwareTimer.start(TickClock::duration{1});
+	ThisThread::sleepFor(TickClock::duration{2});
+
+	if (executed == false || softwareTimer.isRunning() == true || inInterruptContext != interruptContext)
+		return false;
+
+	// in thread context the function must be executed by software timer thread, not by the thread that started it
+	return interruptContext == true || thread != &ThisThread::get();
+}
+
+/**
+ * \brief Tests stopping of software timer which expired, but its function was not yet executed.
+ *
+ * Two software timers expire in the same tick, so both are pending when software timer thread starts executing their
+ * functions. Function of each software timer stops the other one, so only one of them may be executed.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testStopWhilePending()
+{
+	SoftwareTimer* otherSoftwareTimers[2] {};
+	unsigned int executions {};
+	auto softwareTimer0 = makeStaticSoftwareTimer([&otherSoftwareTimers, &executions]()
+			{
+				++executions;
+				otherSoftwareTimers[0]->stop();
+			});
+	auto softwareTimer1 = makeStaticSoftwareTimer([&otherSoftwareTimers, &executions]()
+			{
+				++executions;
+				otherSoftwareTimers[1]->stop();
+			});
+	otherSoftwareTimers[0] = &softwareTimer1;
+	otherSoftwareTimers[1] = &softwareTimer0;
+
+	waitForNextTick();
+	const auto timePoint = TickClock::now() + TickClock::duration{1};
+	softwareTimer0.start(timePoint);
+	softwareTimer1.start(timePoint);
+	ThisThread::sleepUntil(timePoint + TickClock::duration{2});
+
+	return executions == 1 && softwareTimer0.isRunning() == false && softwareTimer1.isRunning() == false;
+}
+
+}	// namespace
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SoftwareTimerThreadTestCase::run_() const
+{
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	if (testContext(false) == false || testContext(true) == false || testStopWhilePending() == false)
+		return false;
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,51 @@
+/**
+ * \file
+ * \brief SoftwareTimerThreadTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_SOFTWARETIMER_SOFTWARETIMERTHREADTESTCASE_HPP_
+#define TEST_SOFTWARETIMER_SOFTWARETIMERTHREADTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests execution of software timers' functions in software timer thread.
+ *
+ * Checks that functions of software timers are executed in software timer thread, that functions of software timers
+ * selected with SoftwareTimerCommon::setInterruptContext() are still executed in "tick" interrupt and that software
+ * timer which is stopped after expiration, but before its function is executed by software timer thread, is not
+ * executed.
+ *
+ * \note Test case is empty when CONFIG_SOFTWARE_TIMER_THREAD_ENABLE is not selected.
+ */
+
+class SoftwareTimerThreadTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_SOFTWARETIMER_SOFTWARETIMERTHREADTESTCASE_HPP_
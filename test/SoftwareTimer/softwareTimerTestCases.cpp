@@ -15,6 +15,9 @@
 #include "SoftwareTimerOperationsTestCase.hpp"
 #include "SoftwareTimerFunctionTypesTestCase.hpp"
 #include "SoftwareTimerPeriodicTestCase.hpp"
+#include "SoftwareTimerSlackTestCase.hpp"
+#include "SoftwareTimerSupervisorStressTestCase.hpp"
+#include "SoftwareTimerThreadTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -43,6 +46,15 @@ const SoftwareTimerFunctionTypesTestCase functionTypesTestCase;
 /// SoftwareTimerPeriodicTestCase instance
 const SoftwareTimerPeriodicTestCase periodicTestCase;
 
+/// SoftwareTimerSlackTestCase instance
+const SoftwareTimerSlackTestCase slackTestCase;
+
+/// SoftwareTimerSupervisorStressTestCase instance
+const SoftwareTimerSupervisorStressTestCase supervisorStressTestCase;
+
+/// SoftwareTimerThreadTestCase instance
+const SoftwareTimerThreadTestCase threadTestCase;
+
 /// array with references to TestCase objects related to software timers
 const TestCaseGroup::Range::value_type softwareTimerTestCases_[]
 {
@@ -50,6 +62,9 @@ const TestCaseGroup::Range::value_type softwareTimerTestCases_[]
 		TestCaseGroup::Range::value_type{operationsTestCase},
 		TestCaseGroup::Range::value_type{functionTypesTestCase},
 		TestCaseGroup::Range::value_type{periodicTestCase},
+		TestCaseGroup::Range::value_type{slackTestCase},
+		TestCaseGroup::Range::value_type{supervisorStressTestCase},
+		TestCaseGroup::Range::value_type{threadTestCase},
 };
 
 }	// namespace
@@ -0,0 +1,72 @@
+/**
+ * \file
+ * \brief IdleTickCountTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "IdleTickCountTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// duration of each phase of the test
+constexpr TickClock::duration testDuration {50};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool IdleTickCountTestCase::run_() const
+{
+	{
+		waitForNextTick();
+
+		const auto idleTickCount = statistics::getIdleTickCount();
+		const auto end = TickClock::now() + testDuration;
+		while (TickClock::now() < end);
+
+		if (statistics::getIdleTickCount() != idleTickCount)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto idleTickCount = statistics::getIdleTickCount();
+		const auto ret = ThisThread::sleepUntil(TickClock::now() + testDuration);
+		const auto idleTicks = statistics::getIdleTickCount() - idleTickCount;
+
+		// tick in which test thread was blocked may be accounted to test thread
+		if (ret != 0 || idleTicks > static_cast<uint64_t>(testDuration.count()) ||
+				idleTicks < static_cast<uint64_t>(testDuration.count()) - 1)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief IdleTickCountTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_STATISTICS_IDLETICKCOUNTTESTCASE_HPP_
+#define TEST_STATISTICS_IDLETICKCOUNTTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests statistics::getIdleTickCount().
+ *
+ * While test thread is busy for a few ticks, idle tick count must not change. While test thread sleeps for a few
+ * ticks (with tickless idle mode possibly suppressing tick interrupts), idle tick count must increase by the number of
+ * ticks of the sleep.
+ */
+
+class IdleTickCountTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_STATISTICS_IDLETICKCOUNTTESTCASE_HPP_
@@ -0,0 +1,194 @@
+/**
+ * \file
+ * \brief InterruptMaskingProfilerTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "InterruptMaskingProfilerTestCase.hpp"
+
+#include "distortos/statistics.hpp"
+
+#ifdef CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
+
+#include "distortos/architecture/getCycleCount.hpp"
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <numeric>
+
+#endif	// def CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
+
+namespace distortos
+{
+
+namespace test
+{
+
+#ifdef CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// duration of short section, cycles
+constexpr uint32_t shortDuration {1000};
+
+/// duration of long section, cycles - much longer than any section of the kernel
+constexpr uint32_t longDuration {20000};
+
+/// number of short sections
+constexpr uint32_t shortSections {3};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Enables interrupt masking for given number of cycles.
+ *
+ * All sections started by this function are accounted to the same place in code.
+ *
+ * \param [in] duration is the duration of section with interrupt masking enabled, cycles
+ */
+
+__attribute__ ((noinline))
+void maskInterrupts(const uint32_t duration)
+{
+	const architecture::InterruptMaskingLock interruptMaskingLock;
+	const auto begin = architecture::getCycleCount();
+	while (architecture::getCycleCount() - begin < duration);
+}
+
+/**
+ * \brief Enables interrupt masking and calls maskInterrupts() in this section.
+ *
+ * \param [in] duration is the duration of nested section, cycles
+ */
+
+__attribute__ ((noinline))
+void maskInterruptsNested(const uint32_t duration)
+{
+	const architecture::InterruptMaskingLock interruptMaskingLock;
+	maskInterrupts(duration);
+}
+
+/**
+ * \brief Checks whether statistics are consistent.
+ *
+ * \param [in] buffer is a pointer to buffer with statistics
+ * \param [in] size is the number of valid elements in \a buffer
+ *
+ * \return true if \a buffer is sorted by maximal duration and histograms of all entries match their counts
+ */
+
+bool checkConsistency(const statistics::InterruptMaskingStatistics* const buffer, const size_t size)
+{
+	for (size_t i {}; i < size; ++i)
+	{
+		const auto& entry = buffer[i];
+		if (i != 0 && entry.maxCycles > buffer[i - 1].maxCycles)
+			return false;
+		if (std::accumulate(entry.histogram.begin(), entry.histogram.end(), uint32_t{}) != entry.count)
+			return false;
+		if (entry.totalCycles < entry.maxCycles)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Finds statistics of given place in code.
+ *
+ * \param [in] buffer is a pointer to buffer with statistics
+ * \param [in] size is the number of valid elements in \a buffer
+ * \param [in] callSite is the place in code
+ *
+ * \return pointer to statistics of \a callSite, nullptr if not found
+ */
+
+const statistics::InterruptMaskingStatistics* findSite(const statistics::InterruptMaskingStatistics* const buffer,
+		const size_t size, const void* const callSite)
+{
+	for (size_t i {}; i < size; ++i)
+		if (buffer[i].callSite == callSite)
+			return buffer + i;
+
+	return nullptr;
+}
+
+}	// namespace
+
+#endif	// def CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool InterruptMaskingProfilerTestCase::run_() const
+{
+#ifdef CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
+
+	statistics::resetInterruptMaskingStatistics();
+
+	maskInterrupts(longDuration);
+	for (uint32_t i {}; i < shortSections; ++i)
+		maskInterrupts(shortDuration);
+
+	statistics::InterruptMaskingStatistics buffer[4];
+
+	{
+		const auto size = statistics::getInterruptMaskingStatistics(buffer, sizeof(buffer) / sizeof(*buffer));
+		if (size == 0 || checkConsistency(buffer, size) == false)
+			return false;
+
+		// the longest section must be the one from maskInterrupts()
+		const auto& entry = buffer[0];
+		if (entry.count != shortSections + 1 || entry.maxCycles < longDuration ||
+				entry.totalCycles < longDuration + shortSections * shortDuration)
+			return false;
+	}
+
+	const auto maskInterruptsCallSite = buffer[0].callSite;
+
+	maskInterruptsNested(longDuration * 2);
+
+	{
+		const auto size = statistics::getInterruptMaskingStatistics(buffer, sizeof(buffer) / sizeof(*buffer));
+		if (size < 2 || checkConsistency(buffer, size) == false)
+			return false;
+
+		// nested section must be accounted only to the outermost one
+		const auto& entry = buffer[0];
+		if (entry.callSite == maskInterruptsCallSite || entry.count != 1 || entry.maxCycles < longDuration * 2)
+			return false;
+
+		const auto maskInterruptsEntry = findSite(buffer, size, maskInterruptsCallSite);
+		if (maskInterruptsEntry == nullptr || maskInterruptsEntry->count != shortSections + 1)
+			return false;
+	}
+
+	statistics::resetInterruptMaskingStatistics();
+
+	{
+		// reset must remove all entries which were tracked before
+		const auto size = statistics::getInterruptMaskingStatistics(buffer, sizeof(buffer) / sizeof(*buffer));
+		if (findSite(buffer, size, maskInterruptsCallSite) != nullptr)
+			return false;
+	}
+
+#endif	// def CONFIG_INTERRUPT_MASKING_PROFILER_ENABLE
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
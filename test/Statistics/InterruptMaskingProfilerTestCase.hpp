@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief InterruptMaskingProfilerTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_STATISTICS_INTERRUPTMASKINGPROFILERTESTCASE_HPP_
+#define TEST_STATISTICS_INTERRUPTMASKINGPROFILERTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests profiler of interrupt masking.
+ *
+ * Sections with interrupt masking enabled of known durations must be accounted to the place in code which started
+ * them, nested sections must be accounted only to the outermost one.
+ *
+ * \note If profiler of interrupt masking is not enabled, this test case does nothing.
+ */
+
+class InterruptMaskingProfilerTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_STATISTICS_INTERRUPTMASKINGPROFILERTESTCASE_HPP_
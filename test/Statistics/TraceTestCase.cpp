@@ -0,0 +1,176 @@
+/**
+ * \file
+ * \brief TraceTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "TraceTestCase.hpp"
+
+#include "distortos/trace.hpp"
+
+#ifdef CONFIG_TRACE_ENABLE
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+
+#include <climits>
+
+#endif	// def CONFIG_TRACE_ENABLE
+
+namespace distortos
+{
+
+namespace test
+{
+
+#ifdef CONFIG_TRACE_ENABLE
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// delay after which software timer posts the semaphore
+constexpr TickClock::duration postDelay {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Gets record from trace buffer.
+ *
+ * \param [in] index is the index of record
+ *
+ * \return reference to record with \a index
+ */
+
+const trace::Record& getRecord(const uint32_t index)
+{
+	return trace::buffer.records[index % trace::buffer.records.size()];
+}
+
+/**
+ * \brief Finds record of given event in trace buffer.
+ *
+ * \param [in] begin is the index of first searched record
+ * \param [in] end is the index one past the last searched record
+ * \param [in] event is the type of searched event
+ * \param [in] object is a pointer to object related to searched event
+ *
+ * \return index of first matching record, \a end if not found
+ */
+
+uint32_t findRecord(uint32_t begin, const uint32_t end, const trace::Event event, const void* const object)
+{
+	for (; begin != end; ++begin)
+	{
+		const auto& record = getRecord(begin);
+		if (record.event == event && record.object == reinterpret_cast<uintptr_t>(object))
+			return begin;
+	}
+
+	return end;
+}
+
+/**
+ * \brief Checks whether records in trace buffer are consistent.
+ *
+ * \param [in] begin is the index of first checked record
+ * \param [in] end is the index one past the last checked record
+ *
+ * \return true if no record was overwritten, all records are complete and their timestamps don't decrease, false
+ * otherwise
+ */
+
+bool checkRecords(const uint32_t begin, const uint32_t end)
+{
+	if (end - begin > trace::buffer.records.size())
+		return false;
+
+	for (auto index = begin; index != end; ++index)
+	{
+		const auto& record = getRecord(index);
+		if (record.sequence != static_cast<uint16_t>(index))
+			return false;
+
+		// timestamps are 32-bit, so they are compared assuming less than 2^31 cycles between consecutive records
+		if (index != begin && record.timestamp - getRecord(index - 1).timestamp > INT32_MAX)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+#endif	// def CONFIG_TRACE_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool TraceTestCase::run_() const
+{
+#ifdef CONFIG_TRACE_ENABLE
+
+	Semaphore semaphore {1};
+
+	{
+		const auto begin = trace::buffer.writeIndex;
+		if (semaphore.wait() != 0)
+			return false;
+		const auto end = trace::buffer.writeIndex;
+
+		const auto waitIndex = findRecord(begin, end, trace::Event::semaphoreWait, &semaphore);
+		if (waitIndex == end || getRecord(waitIndex).argument != 0 || checkRecords(begin, end) == false)
+			return false;
+	}
+
+	{
+		auto softwareTimer = makeStaticSoftwareTimer(
+				[&semaphore]()
+				{
+					semaphore.post();
+				});
+
+		waitForNextTick();
+
+		const auto begin = trace::buffer.writeIndex;
+		softwareTimer.start(postDelay);
+		if (semaphore.wait() != 0)
+			return false;
+		const auto end = trace::buffer.writeIndex;
+
+		// records of blocking wait for semaphore must appear in this order
+		const auto& threadControlBlock = internal::getScheduler().getCurrentThreadControlBlock();
+		const auto blockIndex = findRecord(begin, end, trace::Event::threadBlock, &threadControlBlock);
+		const auto unblockIndex = findRecord(blockIndex, end, trace::Event::threadUnblock, &threadControlBlock);
+		const auto postIndex = findRecord(unblockIndex, end, trace::Event::semaphorePost, &semaphore);
+		const auto waitIndex = findRecord(postIndex, end, trace::Event::semaphoreWait, &semaphore);
+		if (waitIndex == end || getRecord(waitIndex).argument != 0 ||
+				getRecord(blockIndex).argument != static_cast<uint32_t>(ThreadState::blockedOnSemaphore) ||
+				checkRecords(begin, end) == false)
+			return false;
+	}
+
+#endif	// def CONFIG_TRACE_ENABLE
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,51 @@
+/**
+ * \file
+ * \brief TraceTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_STATISTICS_TRACETESTCASE_HPP_
+#define TEST_STATISTICS_TRACETESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests kernel event trace.
+ *
+ * Semaphore is locked without blocking and then with blocking - in the second case it is posted by a software timer.
+ * Trace buffer must contain semaphoreWait records for both waits, with threadBlock, threadUnblock and semaphorePost
+ * records in correct order before the second one. All records written during the test must be complete and their
+ * timestamps must not decrease.
+ *
+ * \note If kernel event trace is not enabled, this test case does nothing.
+ */
+
+class TraceTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_STATISTICS_TRACETESTCASE_HPP_
@@ -0,0 +1,60 @@
+/**
+ * \file
+ * \brief statisticsTestCases object definition
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "statisticsTestCases.hpp"
+
+#include "InterruptMaskingProfilerTestCase.hpp"
+#include "IdleTickCountTestCase.hpp"
+#include "TraceTestCase.hpp"
+
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// InterruptMaskingProfilerTestCase instance
+const InterruptMaskingProfilerTestCase interruptMaskingProfilerTestCase;
+
+/// IdleTickCountTestCase instance
+const IdleTickCountTestCase idleTickCountTestCase;
+
+/// TraceTestCase instance
+const TraceTestCase traceTestCase;
+
+/// array with references to TestCase objects related to statistics
+const TestCaseGroup::Range::value_type statisticsTestCases_[]
+{
+		TestCaseGroup::Range::value_type{interruptMaskingProfilerTestCase},
+		TestCaseGroup::Range::value_type{idleTickCountTestCase},
+		TestCaseGroup::Range::value_type{traceTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup statisticsTestCases {TestCaseGroup::Range{statisticsTestCases_}};
+
+}	// namespace test
+
+}	// namespace distortos
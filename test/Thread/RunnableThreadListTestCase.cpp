@@ -0,0 +1,234 @@
+/**
+ * \file
+ * \brief RunnableThreadListTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "RunnableThreadListTestCase.hpp"
+
+#include "distortos/internal/scheduler/RunnableThreadList.hpp"
+#include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+
+#include "distortos/ThisThread.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <malloc.h>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// priorities of thread control blocks
+constexpr uint8_t priorities[] {1, 3, 2, 3, 1, 3, 2};
+
+/// number of thread control blocks
+constexpr size_t threadControlBlocksCount {sizeof(priorities) / sizeof(*priorities)};
+
+/// number of pseudo-random operations
+constexpr size_t operations {200};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// ThreadList with the same interface as internal::RunnableThreadList, used as reference
+class ReferenceThreadList : public internal::ThreadList
+{
+public:
+
+	/**
+	 * \return pointer to this list as ThreadList
+	 */
+
+	ThreadList* getThreadList()
+	{
+		return this;
+	}
+
+	/**
+	 * \brief Transfers the element to the end of the group of elements with the same effective priority.
+	 *
+	 * \param [in] splicedElement is an iterator of the element that will be spliced
+	 */
+
+	void splice(const iterator splicedElement)
+	{
+		if (splicedElement->getList() == this)
+			erase(splicedElement);
+
+		ThreadList::splice(splicedElement);
+	}
+};
+
+/// array with thread control blocks
+using ThreadControlBlocks = std::array<std::unique_ptr<internal::ThreadControlBlock>, threadControlBlocksCount>;
+
+/// order of elements on the list - indexes of thread control blocks, unused entries are set to UINT8_MAX
+using Order = std::array<uint8_t, threadControlBlocksCount>;
+
+/// vector with orders of elements on the list after each operation
+using Orders = std::vector<Order>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Gets order of elements on the list.
+ *
+ * \tparam List is the type of list, internal::RunnableThreadList or ReferenceThreadList
+ *
+ * \param [in] list is a reference to list
+ * \param [in] threadControlBlocks is a reference to array with thread control blocks
+ *
+ * \return order of elements on \a list
+ */
+
+template<typename List>
+Order getOrder(const List& list, const ThreadControlBlocks& threadControlBlocks)
+{
+	Order order;
+	order.fill(UINT8_MAX);
+
+	size_t i {};
+	for (auto iterator = list.begin(); iterator != list.end() && i < order.size(); ++iterator, ++i)
+	{
+		const auto& threadControlBlock = *iterator;
+		const auto match = std::find_if(threadControlBlocks.begin(), threadControlBlocks.end(),
+				[&threadControlBlock](const std::unique_ptr<internal::ThreadControlBlock>& element)
+				{
+					return element.get() == &threadControlBlock;
+				});
+		order[i] = match - threadControlBlocks.begin();
+	}
+
+	return order;
+}
+
+/**
+ * \brief Executes pseudo-random sequence of operations with the list.
+ *
+ * All thread control blocks start on the list of "blocked" threads. The same sequence of operations is executed on
+ * each call.
+ *
+ * \tparam List is the type of list, internal::RunnableThreadList or ReferenceThreadList
+ *
+ * \param [in] list is a reference to list
+ * \param [in] threadControlBlocks is a reference to array with thread control blocks
+ *
+ * \return orders of elements on \a list after each operation
+ */
+
+template<typename List>
+Orders executeOperations(List& list, const ThreadControlBlocks& threadControlBlocks)
+{
+	internal::ThreadList blockedList;
+	for (auto& threadControlBlock : threadControlBlocks)
+	{
+		blockedList.insert(*threadControlBlock);
+		threadControlBlock->setList(&blockedList);
+	}
+
+	Orders orders;
+	orders.reserve(operations);
+
+	std::minstd_rand generator;
+	std::uniform_int_distribution<size_t> indexDistribution {0, threadControlBlocksCount - 1};
+	std::bernoulli_distribution choiceDistribution;
+	for (size_t i {}; i < operations; ++i)
+	{
+		auto& threadControlBlock = *threadControlBlocks[indexDistribution(generator)];
+		const internal::ThreadList::iterator iterator {threadControlBlock};
+		const auto choice = choiceDistribution(generator);
+		if (threadControlBlock.getList() == list.getThreadList())
+		{
+			if (choice == true)	// block, just like internal::Scheduler::blockInternal()
+			{
+				list.erase(iterator);
+				blockedList.splice(iterator);
+				threadControlBlock.setList(&blockedList);
+			}
+			else	// round-robin rotation, just like internal::Scheduler::tickInterruptHandler()
+				list.splice(iterator);
+		}
+		else
+		{
+			if (choice == true)	// unblock, just like internal::Scheduler::unblockInternal()
+				list.splice(iterator);
+			else	// add, just like internal::Scheduler::addInternal()
+			{
+				internal::ThreadList::erase(iterator);
+				list.insert(threadControlBlock);
+			}
+			threadControlBlock.setList(list.getThreadList());
+		}
+
+		orders.emplace_back(getOrder(list, threadControlBlocks));
+	}
+
+	for (auto& threadControlBlock : threadControlBlocks)
+	{
+		const internal::ThreadList::iterator iterator {*threadControlBlock};
+		if (threadControlBlock->getList() == list.getThreadList())
+			list.erase(iterator);
+		else
+			internal::ThreadList::erase(iterator);
+		threadControlBlock->setList(nullptr);
+	}
+
+	return orders;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool RunnableThreadListTestCase::run_() const
+{
+	const auto allocatedMemory = mallinfo().uordblks;
+
+	{
+		ThreadControlBlocks threadControlBlocks;
+		for (size_t i {}; i < threadControlBlocksCount; ++i)
+			threadControlBlocks[i].reset(new internal::ThreadControlBlock{architecture::Stack{nullptr, 0},
+					priorities[i], SchedulingPolicy::roundRobin, nullptr, nullptr, ThisThread::get()});
+
+		internal::RunnableThreadList runnableThreadList;
+		const auto runnableOrders = executeOperations(runnableThreadList, threadControlBlocks);
+
+		ReferenceThreadList referenceThreadList;
+		const auto referenceOrders = executeOperations(referenceThreadList, threadControlBlocks);
+
+		if (runnableOrders != referenceOrders)
+			return false;
+	}
+
+	if (mallinfo().uordblks != allocatedMemory)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,51 @@
+/**
+ * \file
+ * \brief RunnableThreadListTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_RUNNABLETHREADLISTTESTCASE_HPP_
+#define TEST_THREAD_RUNNABLETHREADLISTTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Compares internal::RunnableThreadList with plain internal::ThreadList.
+ *
+ * A few thread control blocks (which are never started) with pseudo-random priorities are moved between a list of
+ * "blocked" threads and the tested list with a pseudo-random sequence of operations used by internal::Scheduler -
+ * insertion, unblocking (splice from another list), blocking (erase) and round-robin rotation (splice within the same
+ * list). The sequence is executed once with internal::RunnableThreadList and once with plain internal::ThreadList,
+ * where rotation is done with erase and insertion. After each operation the order of elements on both lists must be
+ * identical.
+ */
+
+class RunnableThreadListTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_RUNNABLETHREADLISTTESTCASE_HPP_
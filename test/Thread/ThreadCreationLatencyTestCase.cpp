@@ -0,0 +1,150 @@
+/**
+ * \file
+ * \brief ThreadCreationLatencyTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadCreationLatencyTestCase.hpp"
+
+#include "cycleMeasurement.hpp"
+
+#include "distortos/architecture/paintStack.hpp"
+
+#include "distortos/DynamicThread.hpp"
+
+#include <algorithm>
+#include <memory>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of small stack for test thread, bytes
+constexpr size_t smallStackSize {512};
+
+/// size of large stack for test thread, bytes
+constexpr size_t largeStackSize {4096};
+
+/// priority of test thread - higher than priority of current thread, so test thread runs immediately when started
+constexpr uint8_t testThreadPriority {UINT8_MAX};
+
+/// number of measurements for each size of stack, the shortest latency is used
+constexpr size_t measurements {4};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Test thread
+ *
+ * Saves value of cycle counter at the beginning of thread's function.
+ *
+ * \param [out] end is a reference to variable for value of cycle counter
+ */
+
+void thread(uint32_t& end)
+{
+	end = getCycleCount();
+}
+
+/**
+ * \brief Measures latency of thread creation.
+ *
+ * \param [in] stackSize is the size of stack for test thread, bytes
+ *
+ * \return the shortest time from the beginning of construction of test thread to the first instruction of its function,
+ * core clock cycles
+ */
+
+uint32_t measureLatency(const size_t stackSize)
+{
+	auto latency = UINT32_MAX;
+	for (size_t i {}; i < measurements; ++i)
+	{
+		uint32_t end {};
+		const auto begin = getCycleCount();
+		auto testThread = makeAndStartDynamicThread({stackSize, testThreadPriority}, thread, std::ref(end));
+		testThread.join();
+		latency = std::min(latency, end - begin);
+	}
+
+	return latency;
+}
+
+#ifndef CONFIG_STACK_PAINTING_FULL
+
+/**
+ * \brief Measures duration of painting of the part of large stack which is not present in small stack.
+ *
+ * This is the additional cost of creation of thread with large stack when whole stack is painted.
+ *
+ * \return the shortest duration of painting of (largeStackSize - smallStackSize) bytes, core clock cycles
+ */
+
+uint32_t measurePainting()
+{
+	constexpr size_t words {(largeStackSize - smallStackSize) / sizeof(uint32_t)};
+	std::unique_ptr<uint32_t[]> buffer {new uint32_t[words]};
+
+	auto duration = UINT32_MAX;
+	for (size_t i {}; i < measurements; ++i)
+	{
+		const auto begin = getCycleCount();
+		architecture::paintStack(buffer.get(), buffer.get() + words);
+		duration = std::min(duration, getCycleCount() - begin);
+	}
+
+	return duration;
+}
+
+#endif	// !def CONFIG_STACK_PAINTING_FULL
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadCreationLatencyTestCase::run_() const
+{
+	const auto smallStackLatency = measureLatency(smallStackSize);
+	const auto largeStackLatency = measureLatency(largeStackSize);
+
+	if (smallStackLatency == 0 || largeStackLatency == 0)
+		return false;
+
+	reportCycles("thread creation with small stack", smallStackLatency);
+	reportCycles("thread creation with large stack", largeStackLatency);
+
+#ifndef CONFIG_STACK_PAINTING_FULL
+
+	const auto paintingDuration = measurePainting();
+	reportCycles("painting of difference of stacks", paintingDuration);
+
+	// with whole stack painted, creation of thread with large stack would take additional paintingDuration
+	if (largeStackLatency >= smallStackLatency + paintingDuration)
+		return false;
+
+#endif	// !def CONFIG_STACK_PAINTING_FULL
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief ThreadCreationLatencyTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADCREATIONLATENCYTESTCASE_HPP_
+#define TEST_THREAD_THREADCREATIONLATENCYTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Benchmark of latency of thread creation.
+ *
+ * Measures time (in core clock cycles) from the beginning of construction of dynamic thread to the first instruction
+ * of its function, for a small and a large stack. Measured values are reported with reportCycles(), so the selected
+ * mode of stack painting can be compared with the other ones by running this test case with each of them.
+ *
+ * If whole stack is not painted, duration of painting of the additional part of large stack is also measured. Creation
+ * of thread with large stack must be cheaper than it would be with whole stack painted - the difference of latencies
+ * for large and small stack must be lower than this duration.
+ */
+
+class ThreadCreationLatencyTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADCREATIONLATENCYTESTCASE_HPP_
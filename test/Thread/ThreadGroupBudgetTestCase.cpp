@@ -0,0 +1,135 @@
+/**
+ * \file
+ * \brief ThreadGroupBudgetTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadGroupBudgetTestCase.hpp"
+
+#include "wasteTime.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+#include "distortos/ThreadGroup.hpp"
+
+#include <malloc.h>
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {256};
+
+/// CPU budget of thread group
+constexpr TickClock::duration budget {2};
+
+/// replenishment period of thread group
+constexpr TickClock::duration period {10};
+
+/// duration of time wasted by test thread, ticks
+constexpr TickClock::duration wastedDuration {5};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Test thread
+ *
+ * Wastes time until given time point.
+ *
+ * \param [in] timePoint is the time point at which the function will return
+ */
+
+void thread(const TickClock::time_point timePoint)
+{
+	wasteTime(timePoint);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadGroupBudgetTestCase::run_() const
+{
+	const auto allocatedMemory = mallinfo().uordblks;
+
+	{
+		ThreadGroup threadGroup;
+
+		if (threadGroup.setBudget(TickClock::duration{-1}, period) != EINVAL)
+			return false;
+
+		if (threadGroup.setBudget(budget, budget) != EINVAL)
+			return false;
+
+		const auto budgetOverrunCount = statistics::getBudgetOverrunCount();
+
+		// wait for beginning of next tick - budget is set and test thread is started in the same tick
+		ThisThread::sleepFor({});
+		const auto start = TickClock::now();
+
+		if (threadGroup.setBudget(budget, period) != 0)
+			return false;
+
+		auto testThread = makeDynamicThread({testThreadStackSize, UINT8_MAX}, thread, start + wastedDuration);
+		if (testThread.setThreadGroup(threadGroup) != 0)
+			return false;
+
+		testThread.start();
+
+		// this thread runs only when test thread is throttled
+		const auto throttledAfter = TickClock::now() - start;
+		const auto throttled = threadGroup.isThrottled();
+		const auto overrunCount = threadGroup.getOverrunCount();
+
+		const auto setThreadGroupRet = testThread.setThreadGroup(threadGroup);
+
+		testThread.join();
+
+		if (throttledAfter < budget || throttledAfter > budget + TickClock::duration{1})
+			return false;
+
+		if (throttled != true || overrunCount != 1)
+			return false;
+
+		if (statistics::getBudgetOverrunCount() - budgetOverrunCount != 1)
+			return false;
+
+		if (setThreadGroupRet != EINVAL)
+			return false;
+
+		// test thread finishes in background, before the end of replenishment period
+		if (TickClock::now() - start < wastedDuration || TickClock::now() - start >= period)
+			return false;
+	}
+
+	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
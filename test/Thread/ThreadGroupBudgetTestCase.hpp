@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \brief ThreadGroupBudgetTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADGROUPBUDGETTESTCASE_HPP_
+#define TEST_THREAD_THREADGROUPBUDGETTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests CPU budget of thread groups.
+ *
+ * Starts high-priority thread which wastes time in a thread group with CPU budget, asserting that the group is
+ * throttled after it uses its budget - test case's thread is able to run at that moment - and that the overrun is
+ * counted. Invalid budget parameters and changing thread group of started thread are also tested.
+ */
+
+class ThreadGroupBudgetTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {1};
+
+public:
+
+	/**
+	 * \brief ThreadGroupBudgetTestCase's constructor
+	 */
+
+	constexpr ThreadGroupBudgetTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADGROUPBUDGETTESTCASE_HPP_
@@ -0,0 +1,151 @@
+/**
+ * \file
+ * \brief ThreadPeriodicTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadPeriodicTestCase.hpp"
+
+#include "wasteTime.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <array>
+
+#include <malloc.h>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// priority of test thread - higher than priority of current thread, so test thread runs immediately when started
+constexpr uint8_t testThreadPriority {UINT8_MAX};
+
+/// number of periods executed by test thread
+constexpr size_t totalPeriods {6};
+
+/// period of test thread
+constexpr TickClock::duration period {5};
+
+/// deadline of test thread, relative to the beginning of each period
+constexpr TickClock::duration relativeDeadline {2};
+
+/// index of period in which test thread misses its deadline
+constexpr size_t overrunPeriod {3};
+
+/// time wasted by test thread in overrunPeriod - past the deadline, but before the beginning of next period
+constexpr TickClock::duration overrunDuration {relativeDeadline};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// array with time points of beginnings of periods, as seen by test thread
+using TimePoints = std::array<TickClock::time_point, totalPeriods>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Test thread
+ *
+ * Saves time point of the beginning of each period and finishes each period with ThisThread::waitForNextPeriod(). In
+ * overrunPeriod the thread wastes time until its deadline is missed.
+ *
+ * \param [out] timePoints is a reference to array for time points of beginnings of periods
+ * \param [out] sharedRet is a reference to variable for storing the first non-zero return value of
+ * ThisThread::waitForNextPeriod()
+ */
+
+void thread(TimePoints& timePoints, int& sharedRet)
+{
+	for (size_t i {}; i < timePoints.size(); ++i)
+	{
+		timePoints[i] = TickClock::now();
+
+		if (i == overrunPeriod)
+			wasteTime(overrunDuration);
+
+		const auto ret = ThisThread::waitForNextPeriod();
+		if (ret != 0 && sharedRet == 0)
+			sharedRet = ret;
+	}
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadPeriodicTestCase::run_() const
+{
+	static_assert(overrunDuration + TickClock::duration{1} < period,
+			"Overrun must end before the beginning of next period!");
+
+	const auto allocatedMemory = mallinfo().uordblks;
+
+	{
+		TimePoints timePoints {{}};
+		int sharedRet {};
+		auto testThread = makeDynamicThread({testThreadStackSize, testThreadPriority,
+				SchedulingPolicy::earliestDeadlineFirst}, thread, std::ref(timePoints), std::ref(sharedRet));
+
+		decltype(TickClock::now()) testStart;
+
+		{
+			architecture::InterruptMaskingLock interruptMaskingLock;
+
+			// wait for beginning of next tick - the first period should begin in the same tick as the test thread
+			ThisThread::sleepFor({});
+
+			testThread.setDeadline(relativeDeadline, period);
+			testThread.start();
+
+			testStart = TickClock::now();
+		}
+
+		testThread.join();
+
+		if (sharedRet != 0)
+			return false;
+
+		// periods begin exactly at multiples of period, also after the overrun
+		for (size_t i {}; i < timePoints.size(); ++i)
+			if (timePoints[i] != testStart + period * i)
+				return false;
+
+		if (testThread.getDeadlineMissCount() != 1)
+			return false;
+	}
+
+	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief ThreadPeriodicTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADPERIODICTESTCASE_HPP_
+#define TEST_THREAD_THREADPERIODICTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests periodic threads with SchedulingPolicy::earliestDeadlineFirst.
+ *
+ * Test thread with deadline parameters set with Thread::setDeadline() runs for several periods, finishing each of them
+ * with ThisThread::waitForNextPeriod(). Beginning of each period must be aligned exactly to the period, even after the
+ * thread misses its deadline by wasting time in one of the periods. Thread::getDeadlineMissCount() must report exactly
+ * one missed deadline.
+ */
+
+class ThreadPeriodicTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADPERIODICTESTCASE_HPP_
@@ -21,6 +21,8 @@
 
 #include <malloc.h>
 
+#include <cerrno>
+
 namespace distortos
 {
 
@@ -53,6 +55,9 @@ constexpr size_t totalThreads {10};
 /// duration of single test thread - significantly longer than single round-robin quantum
 constexpr auto testThreadDuration = internal::RoundRobinQuantum::getInitial() * 2;
 
+/// round-robin quantum longer than duration of single test thread
+constexpr auto longRoundRobinQuantum = testThreadDuration * 2;
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | local functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -80,17 +85,49 @@ void thread(SequenceAsserter& sequenceAsserter, const SequencePoints sequencePoi
  * \param [in] schedulingPolicy is the scheduling policy of the test thread
  * \param [in] sequenceAsserter is a reference to SequenceAsserter shared object
  * \param [in] sequencePoints is a pair of sequence points for this instance
+ * \param [in] roundRobinQuantum is the length of round-robin quantum of the test thread, 0 to use default value
  *
  * \return constructed DynamicThread object
  */
 
 DynamicThread makeTestThread(const SchedulingPolicy schedulingPolicy, SequenceAsserter& sequenceAsserter,
-		const SequencePoints sequencePoints)
+		const SequencePoints sequencePoints, const TickClock::duration roundRobinQuantum = {})
 {
-	return makeDynamicThread({testThreadStackSize, testThreadPriority, schedulingPolicy}, thread,
+	return makeDynamicThread({testThreadStackSize, testThreadPriority, schedulingPolicy, roundRobinQuantum}, thread,
 			std::ref(sequenceAsserter), sequencePoints);
 }
 
+/**
+ * \brief Tests validation of round-robin quantum set with Thread::setRoundRobinQuantum().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testRoundRobinQuantumValidation()
+{
+	SequenceAsserter sequenceAsserter;
+	auto testThread = makeTestThread(SchedulingPolicy::roundRobin, sequenceAsserter, {}, longRoundRobinQuantum);
+	if (testThread.getRoundRobinQuantum() != longRoundRobinQuantum)
+		return false;
+
+	if (testThread.setRoundRobinQuantum(TickClock::duration{-1}) != EINVAL ||
+			testThread.setRoundRobinQuantum(internal::RoundRobinQuantum::getMax() + TickClock::duration{1}) != EINVAL)
+		return false;
+	if (testThread.getRoundRobinQuantum() != longRoundRobinQuantum)	// invalid values must not change the quantum
+		return false;
+
+	if (testThread.setRoundRobinQuantum(internal::RoundRobinQuantum::getMax()) != 0 ||
+			testThread.getRoundRobinQuantum() != internal::RoundRobinQuantum::getMax())
+		return false;
+
+	// 0 restores default value
+	if (testThread.setRoundRobinQuantum({}) != 0 ||
+			testThread.getRoundRobinQuantum() != internal::RoundRobinQuantum::getInitial())
+		return false;
+
+	return true;
+}
+
 }	// namespace
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -101,12 +138,17 @@ bool ThreadSchedulingPolicyTestCase::run_() const
 {
 	const auto allocatedMemory = mallinfo().uordblks;
 
-	// scheduling policy, sequence point multiplier, sequence point step
-	using Parameters = std::tuple<SchedulingPolicy, unsigned int, unsigned int>;
+	if (testRoundRobinQuantumValidation() == false)
+		return false;
+
+	// scheduling policy, sequence point multiplier, sequence point step, round-robin quantum
+	using Parameters = std::tuple<SchedulingPolicy, unsigned int, unsigned int, TickClock::duration>;
 	static const Parameters parametersArray[]
 	{
-			Parameters{SchedulingPolicy::fifo, 2, 1},
-			Parameters{SchedulingPolicy::roundRobin, 1, totalThreads},
+			Parameters{SchedulingPolicy::fifo, 2, 1, {}},
+			Parameters{SchedulingPolicy::roundRobin, 1, totalThreads, {}},
+			// quantum longer than duration of thread - no rotation, same order as with SchedulingPolicy::fifo
+			Parameters{SchedulingPolicy::roundRobin, 2, 1, longRoundRobinQuantum},
 	};
 
 	for (const auto& parameters : parametersArray)
@@ -115,21 +157,32 @@ bool ThreadSchedulingPolicyTestCase::run_() const
 			const auto schedulingPolicy = std::get<0>(parameters);
 			const auto multiplier = std::get<1>(parameters);
 			const auto step = std::get<2>(parameters);
+			const auto roundRobinQuantum = std::get<3>(parameters);
 
 			SequenceAsserter sequenceAsserter;
 
 			std::array<DynamicThread, totalThreads> threads
 			{{
-					makeTestThread(schedulingPolicy, sequenceAsserter, {0 * multiplier, 0 * multiplier + step}),
-					makeTestThread(schedulingPolicy, sequenceAsserter, {1 * multiplier, 1 * multiplier + step}),
-					makeTestThread(schedulingPolicy, sequenceAsserter, {2 * multiplier, 2 * multiplier + step}),
-					makeTestThread(schedulingPolicy, sequenceAsserter, {3 * multiplier, 3 * multiplier + step}),
-					makeTestThread(schedulingPolicy, sequenceAsserter, {4 * multiplier, 4 * multiplier + step}),
-					makeTestThread(schedulingPolicy, sequenceAsserter, {5 * multiplier, 5 * multiplier + step}),
-					makeTestThread(schedulingPolicy, sequenceAsserter, {6 * multiplier, 6 * multiplier + step}),
-					makeTestThread(schedulingPolicy, sequenceAsserter, {7 * multiplier, 7 * multiplier + step}),
-					makeTestThread(schedulingPolicy, sequenceAsserter, {8 * multiplier, 8 * multiplier + step}),
-					makeTestThread(schedulingPolicy, sequenceAsserter, {9 * multiplier, 9 * multiplier + step}),
+					makeTestThread(schedulingPolicy, sequenceAsserter, {0 * multiplier, 0 * multiplier + step},
+							roundRobinQuantum),
+					makeTestThread(schedulingPolicy, sequenceAsserter, {1 * multiplier, 1 * multiplier + step},
+							roundRobinQuantum),
+					makeTestThread(schedulingPolicy, sequenceAsserter, {2 * multiplier, 2 * multiplier + step},
+							roundRobinQuantum),
+					makeTestThread(schedulingPolicy, sequenceAsserter, {3 * multiplier, 3 * multiplier + step},
+							roundRobinQuantum),
+					makeTestThread(schedulingPolicy, sequenceAsserter, {4 * multiplier, 4 * multiplier + step},
+							roundRobinQuantum),
+					makeTestThread(schedulingPolicy, sequenceAsserter, {5 * multiplier, 5 * multiplier + step},
+							roundRobinQuantum),
+					makeTestThread(schedulingPolicy, sequenceAsserter, {6 * multiplier, 6 * multiplier + step},
+							roundRobinQuantum),
+					makeTestThread(schedulingPolicy, sequenceAsserter, {7 * multiplier, 7 * multiplier + step},
+							roundRobinQuantum),
+					makeTestThread(schedulingPolicy, sequenceAsserter, {8 * multiplier, 8 * multiplier + step},
+							roundRobinQuantum),
+					makeTestThread(schedulingPolicy, sequenceAsserter, {9 * multiplier, 9 * multiplier + step},
+							roundRobinQuantum),
 			}};
 
 			decltype(TickClock::now()) testStart;
@@ -163,6 +216,48 @@ bool ThreadSchedulingPolicyTestCase::run_() const
 			return false;
 	}
 
+	{
+		SequenceAsserter sequenceAsserter;
+
+		constexpr auto schedulingPolicy = SchedulingPolicy::earliestDeadlineFirst;
+		std::array<DynamicThread, totalThreads> threads
+		{{
+				makeTestThread(schedulingPolicy, sequenceAsserter, {18, 19}),
+				makeTestThread(schedulingPolicy, sequenceAsserter, {16, 17}),
+				makeTestThread(schedulingPolicy, sequenceAsserter, {14, 15}),
+				makeTestThread(schedulingPolicy, sequenceAsserter, {12, 13}),
+				makeTestThread(schedulingPolicy, sequenceAsserter, {10, 11}),
+				makeTestThread(schedulingPolicy, sequenceAsserter, {8, 9}),
+				makeTestThread(schedulingPolicy, sequenceAsserter, {6, 7}),
+				makeTestThread(schedulingPolicy, sequenceAsserter, {4, 5}),
+				makeTestThread(schedulingPolicy, sequenceAsserter, {2, 3}),
+				makeTestThread(schedulingPolicy, sequenceAsserter, {0, 1}),
+		}};
+
+		{
+			architecture::InterruptMaskingLock interruptMaskingLock;
+
+			// wait for beginning of next tick - deadlines of test threads should be set in the same tick
+			ThisThread::sleepFor({});
+
+			// deadlines are set in reverse order of starting, so the threads should be executed in reverse order
+			for (size_t i {}; i < threads.size(); ++i)
+			{
+				threads[i].setDeadline(testThreadDuration * (totalThreads - i), {});
+				threads[i].start();
+			}
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		if (sequenceAsserter.assertSequence(totalThreads * 2) == false)
+			return false;
+	}
+
+	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		return false;
+
 	return true;
 }
 
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadSchedulingPolicyTestCase class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -21,10 +21,13 @@ namespace test
 {
 
 /**
- * \brief Tests round-robin scheduling of threads.
+ * \brief Tests round-robin and earliest-deadline-first scheduling of threads.
  *
  * Starts 10 small threads which same priority, making sure that they preempt each other (thanks to round-robin
- * scheduling).
+ * scheduling). Repeats this with round-robin quantum of each thread longer than its duration, making sure that threads
+ * are not rotated. Then starts 10 small threads with same priority and earliest-deadline-first scheduling policy, with
+ * deadlines in reverse order of starting, making sure that they are executed in the order of deadlines. Also checks
+ * validation of round-robin quantum set with Thread::setRoundRobinQuantum().
  */
 
 class ThreadSchedulingPolicyTestCase : public TestCaseCommon
@@ -0,0 +1,141 @@
+/**
+ * \file
+ * \brief ThreadStackHighWaterMarkTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadStackHighWaterMarkTestCase.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {1024};
+
+/// size of small buffer written on the stack, bytes
+constexpr size_t smallBufferSize {128};
+
+/// size of large buffer written on the stack, bytes
+constexpr size_t largeBufferSize {512};
+
+/// max number of stacks read with statistics::getStackUsage()
+constexpr size_t maxStacks {16};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Test thread
+ *
+ * Writes whole buffer of given size on the stack.
+ *
+ * \tparam BufferSize is the size of buffer, bytes
+ */
+
+template<size_t BufferSize>
+void thread()
+{
+	volatile uint8_t buffer[BufferSize];
+	for (size_t i {}; i < BufferSize; ++i)
+		buffer[i] = i;
+	static_cast<void>(buffer[0]);	// suppress warning
+}
+
+/**
+ * \brief Runs test thread and gets high-water mark of its stack.
+ *
+ * \tparam BufferSize is the size of buffer written on the stack by test thread, bytes
+ *
+ * \return high-water mark of stack of test thread, 0 if the stack has unexpected size
+ */
+
+template<size_t BufferSize>
+size_t getHighWaterMark()
+{
+	auto testThread = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, thread<BufferSize>);
+	testThread.join();
+
+	const auto stackSize = testThread.getStackSize();
+	if (stackSize > testThreadStackSize || stackSize < testThreadStackSize / 2)
+		return {};
+
+	const auto highWaterMark = testThread.getStackHighWaterMark();
+	return highWaterMark <= stackSize ? highWaterMark : 0;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadStackHighWaterMarkTestCase::run_() const
+{
+	{
+		const auto smallHighWaterMark = getHighWaterMark<smallBufferSize>();
+		const auto largeHighWaterMark = getHighWaterMark<largeBufferSize>();
+
+		if (smallHighWaterMark < smallBufferSize || largeHighWaterMark < largeBufferSize)
+			return false;
+
+#ifdef CONFIG_STACK_PAINTING_FULL
+
+		// the part of stack which is not painted is reported as used, so the difference is exact only in this mode
+		if (largeHighWaterMark - smallHighWaterMark < largeBufferSize - smallBufferSize)
+			return false;
+
+#endif	// def CONFIG_STACK_PAINTING_FULL
+	}
+
+	{
+		statistics::StackUsage stackUsage[maxStacks];
+		const auto count = statistics::getStackUsage(stackUsage, maxStacks);
+		// at least the stack used by interrupts, stack of main thread and stack of idle thread
+		if (count < 3)
+			return false;
+
+		if (stackUsage[0].thread != nullptr)
+			return false;
+
+		const auto& currentThread = ThisThread::get();
+		bool currentThreadFound {};
+		for (size_t i {}; i < std::min(count, maxStacks); ++i)
+		{
+			if (stackUsage[i].highWaterMark == 0 || stackUsage[i].highWaterMark > stackUsage[i].size)
+				return false;
+			if (stackUsage[i].thread == &currentThread)
+				currentThreadFound = true;
+		}
+
+		if (currentThreadFound == false)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief ThreadStackHighWaterMarkTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADSTACKHIGHWATERMARKTESTCASE_HPP_
+#define TEST_THREAD_THREADSTACKHIGHWATERMARKTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests measurement of stack usage.
+ *
+ * Starts threads which write buffers of known sizes on their stacks, making sure that high-water marks of their stacks
+ * are not smaller than these sizes and - if whole stacks are painted - grow with them. Checks that
+ * statistics::getStackUsage() reports the stack used by interrupts and stacks of all threads, including current one.
+ */
+
+class ThreadStackHighWaterMarkTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADSTACKHIGHWATERMARKTESTCASE_HPP_
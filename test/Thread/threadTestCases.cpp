@@ -18,6 +18,11 @@
 #include "ThreadSleepUntilTestCase.hpp"
 #include "ThreadSchedulingPolicyTestCase.hpp"
 #include "ThreadPriorityChangeTestCase.hpp"
+#include "ThreadGroupBudgetTestCase.hpp"
+#include "ThreadStackHighWaterMarkTestCase.hpp"
+#include "ThreadCreationLatencyTestCase.hpp"
+#include "ThreadPeriodicTestCase.hpp"
+#include "RunnableThreadListTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -55,6 +60,21 @@ const ThreadSchedulingPolicyTestCase schedulingPolicyTestCase;
 /// ThreadPriorityChangeTestCase instance
 const ThreadPriorityChangeTestCase priorityChangeTestCase;
 
+/// ThreadGroupBudgetTestCase instance
+const ThreadGroupBudgetTestCase groupBudgetTestCase;
+
+/// ThreadStackHighWaterMarkTestCase instance
+const ThreadStackHighWaterMarkTestCase stackHighWaterMarkTestCase;
+
+/// ThreadCreationLatencyTestCase instance
+const ThreadCreationLatencyTestCase creationLatencyTestCase;
+
+/// ThreadPeriodicTestCase instance
+const ThreadPeriodicTestCase periodicTestCase;
+
+/// RunnableThreadListTestCase instance
+const RunnableThreadListTestCase runnableThreadListTestCase;
+
 /// array with references to TestCase objects related to threads
 const TestCaseGroup::Range::value_type threadTestCases_[]
 {
@@ -65,6 +85,11 @@ const TestCaseGroup::Range::value_type threadTestCases_[]
 		TestCaseGroup::Range::value_type{sleepUntilTestCase},
 		TestCaseGroup::Range::value_type{schedulingPolicyTestCase},
 		TestCaseGroup::Range::value_type{priorityChangeTestCase},
+		TestCaseGroup::Range::value_type{groupBudgetTestCase},
+		TestCaseGroup::Range::value_type{stackHighWaterMarkTestCase},
+		TestCaseGroup::Range::value_type{creationLatencyTestCase},
+		TestCaseGroup::Range::value_type{periodicTestCase},
+		TestCaseGroup::Range::value_type{runnableThreadListTestCase},
 };
 
 }	// namespace
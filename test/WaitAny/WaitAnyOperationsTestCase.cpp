@@ -0,0 +1,370 @@
+/**
+ * \file
+ * \brief WaitAnyOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "WaitAnyOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/StaticRawMessageQueue.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+#include "distortos/waitAny.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// objects used in tests
+struct TestObjects
+{
+	/**
+	 * \brief TestObjects' constructor
+	 */
+
+	TestObjects() :
+			semaphore{0},
+			fifoQueue{},
+			rawMessageQueue{},
+			objects{semaphore, fifoQueue, rawMessageQueue}
+	{
+
+	}
+
+	/**
+	 * \return range of objects which are waited for
+	 */
+
+	WaitAnyObjects getObjects() const
+	{
+		return WaitAnyObjects{objects};
+	}
+
+	/// semaphore, index 0 in \a objects
+	Semaphore semaphore;
+
+	/// FIFO queue, index 1 in \a objects
+	StaticFifoQueue<uint8_t, 1> fifoQueue;
+
+	/// raw message queue, index 2 in \a objects
+	StaticRawMessageQueue<uint8_t, 1> rawMessageQueue;
+
+	/// array with objects which are waited for
+	const WaitAnyObject objects[3];
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// index of semaphore in TestObjects::objects
+constexpr size_t semaphoreIndex {0};
+
+/// index of FIFO queue in TestObjects::objects
+constexpr size_t fifoQueueIndex {1};
+
+/// index of raw message queue in TestObjects::objects
+constexpr size_t rawMessageQueueIndex {2};
+
+/// value used in tests
+constexpr uint8_t testValue {0x5a};
+
+/// expected number of context switches in waitForNextTick(): main -> idle -> main
+constexpr decltype(statistics::getContextSwitchCount()) waitForNextTickContextSwitchCount {2};
+
+/// expected number of context switches in phase2 block involving tryWaitAnyFor() or tryWaitAnyUntil() (excluding
+/// waitForNextTick()): 1 - main thread blocks (main -> idle), 2 - main thread wakes up (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase2TryWaitAnyForUntilContextSwitchCount {2};
+
+/// expected number of context switches in phase3 block involving test thread (excluding waitForNextTick()): 1 - test
+/// thread starts (main -> test), 2 - test thread goes to sleep (test -> main), 3 - main thread blocks (main -> idle),
+/// 4 - test thread wakes (idle -> test), 5 - test thread terminates (test -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase3ThreadContextSwitchCount {5};
+
+/// expected number of context switches in phase4 block involving software timer (excluding waitForNextTick()): 1 - main
+/// thread blocks (main -> idle), 2 - main thread is unblocked by interrupt (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase4SoftwareTimerContextSwitchCount {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests whether waitAny() returns immediately with expected index.
+ *
+ * \param [in] objects is a range of objects which will be waited for
+ * \param [in] expectedIndex is the expected index of "ready" object
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testImmediateReturn(const WaitAnyObjects objects, const size_t expectedIndex)
+{
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+	const auto start = TickClock::now();
+	const auto ret = waitAny(objects);
+	return ret.first == 0 && ret.second == expectedIndex && TickClock::now() == start &&
+			statistics::getContextSwitchCount() == contextSwitchCount;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether all functions return EINVAL for empty range of objects and whether waitAny() returns immediately -
+ * with the lowest index of "ready" object and without modifying any of them - when at least one object is "ready".
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	TestObjects testObjects;
+
+	{
+		const auto emptyObjects = WaitAnyObjects{};
+		if (waitAny(emptyObjects).first != EINVAL || tryWaitAnyFor(singleDuration, emptyObjects).first != EINVAL ||
+				tryWaitAnyUntil(TickClock::now() + singleDuration, emptyObjects).first != EINVAL)
+			return false;
+	}
+
+	waitForNextTick();
+
+	if (testObjects.rawMessageQueue.tryPush(0, testValue) != 0)
+		return false;
+
+	if (testImmediateReturn(testObjects.getObjects(), rawMessageQueueIndex) == false)
+		return false;
+
+	if (testObjects.fifoQueue.tryPush(testValue) != 0)
+		return false;
+
+	if (testImmediateReturn(testObjects.getObjects(), fifoQueueIndex) == false)
+		return false;
+
+	if (testObjects.semaphore.post() != 0)
+		return false;
+
+	if (testImmediateReturn(testObjects.getObjects(), semaphoreIndex) == false)
+		return false;
+
+	// waitAny() must not consume anything
+	if (testObjects.semaphore.tryWait() != 0)
+		return false;
+
+	if (testImmediateReturn(testObjects.getObjects(), fifoQueueIndex) == false)
+		return false;
+
+	{
+		uint8_t value {};
+		if (testObjects.fifoQueue.tryPop(value) != 0 || value != testValue)
+			return false;
+	}
+
+	if (testImmediateReturn(testObjects.getObjects(), rawMessageQueueIndex) == false)
+		return false;
+
+	{
+		uint8_t priority {};
+		uint8_t value {};
+		if (testObjects.rawMessageQueue.tryPop(priority, value) != 0 || value != testValue)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests whether tryWaitAnyFor() and tryWaitAnyUntil() properly return ETIMEDOUT when none of objects becomes "ready".
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	TestObjects testObjects;
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// none of objects is "ready", so tryWaitAnyFor() should time-out at expected time
+		const auto start = TickClock::now();
+		const auto ret = tryWaitAnyFor(singleDuration, testObjects.getObjects());
+		const auto realDuration = TickClock::now() - start;
+		if (ret.first != ETIMEDOUT || realDuration != singleDuration + decltype(singleDuration){1} ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase2TryWaitAnyForUntilContextSwitchCount)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// none of objects is "ready", so tryWaitAnyUntil() should time-out at exact expected time
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		const auto ret = tryWaitAnyUntil(requestedTimePoint, testObjects.getObjects());
+		if (ret.first != ETIMEDOUT || requestedTimePoint != TickClock::now() ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase2TryWaitAnyForUntilContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests thread-thread signaling scenario. Main (current) thread waits for any of objects. Test thread pushes a value to
+ * FIFO queue at specified time point, main thread is expected to be unblocked (with waitAny(), tryWaitAnyFor() and
+ * tryWaitAnyUntil()) in the same moment, with index of FIFO queue.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	constexpr size_t testThreadStackSize {512};
+
+	TestObjects testObjects;
+
+	const auto sleepUntilFunctor = [&testObjects](const TickClock::time_point timePoint)
+			{
+				ThisThread::sleepUntil(timePoint);
+				testObjects.fifoQueue.tryPush(testValue);
+			};
+
+	for (size_t i {}; i < 3; ++i)
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		auto thread = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, sleepUntilFunctor, wakeUpTimePoint);
+
+		ThisThread::yield();
+
+		// none of objects is currently "ready", but the wait should be satisfied at expected time
+		const auto ret = i == 0 ? waitAny(testObjects.getObjects()) :
+				i == 1 ? tryWaitAnyFor(wakeUpTimePoint - TickClock::now() + longDuration, testObjects.getObjects()) :
+				tryWaitAnyUntil(wakeUpTimePoint + longDuration, testObjects.getObjects());
+		const auto wokenUpTimePoint = TickClock::now();
+		thread.join();
+		if (ret.first != 0 || ret.second != fifoQueueIndex || wakeUpTimePoint != wokenUpTimePoint ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase3ThreadContextSwitchCount)
+			return false;
+
+		uint8_t value {};
+		if (testObjects.fifoQueue.tryPop(value) != 0 || value != testValue)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 4 of test case.
+ *
+ * Tests interrupt-thread signaling scenario. Main (current) thread waits for any of objects. Software timer is used to
+ * post the semaphore at specified time point from interrupt context, main thread is expected to be unblocked (with
+ * waitAny(), tryWaitAnyFor() and tryWaitAnyUntil()) in the same moment, with index of semaphore.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase4()
+{
+	TestObjects testObjects;
+	auto softwareTimer = makeStaticSoftwareTimer(&Semaphore::post, std::ref(testObjects.semaphore));
+
+	for (size_t i {}; i < 3; ++i)
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+
+		softwareTimer.start(wakeUpTimePoint);
+
+		// none of objects is currently "ready", but the wait should be satisfied at expected time
+		const auto ret = i == 0 ? waitAny(testObjects.getObjects()) :
+				i == 1 ? tryWaitAnyFor(wakeUpTimePoint - TickClock::now() + longDuration, testObjects.getObjects()) :
+				tryWaitAnyUntil(wakeUpTimePoint + longDuration, testObjects.getObjects());
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret.first != 0 || ret.second != semaphoreIndex || wakeUpTimePoint != wokenUpTimePoint ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase4SoftwareTimerContextSwitchCount)
+			return false;
+
+		if (testObjects.semaphore.tryWait() != 0)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool WaitAnyOperationsTestCase::run_() const
+{
+	constexpr auto phase1ExpectedContextSwitchCount = waitForNextTickContextSwitchCount;
+	constexpr auto phase2ExpectedContextSwitchCount = 2 * waitForNextTickContextSwitchCount +
+			2 * phase2TryWaitAnyForUntilContextSwitchCount;
+	constexpr auto phase3ExpectedContextSwitchCount = 3 * waitForNextTickContextSwitchCount +
+			3 * phase3ThreadContextSwitchCount;
+	constexpr auto phase4ExpectedContextSwitchCount = 3 * waitForNextTickContextSwitchCount +
+			3 * phase4SoftwareTimerContextSwitchCount;
+	constexpr auto expectedContextSwitchCount = phase1ExpectedContextSwitchCount + phase2ExpectedContextSwitchCount +
+			phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount;
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+	for (const auto& function : {phase1, phase2, phase3, phase4})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	if (statistics::getContextSwitchCount() - contextSwitchCount != expectedContextSwitchCount)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
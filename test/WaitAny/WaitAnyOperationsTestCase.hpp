@@ -0,0 +1,47 @@
+/**
+ * \file
+ * \brief WaitAnyOperationsTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_WAITANY_WAITANYOPERATIONSTESTCASE_HPP_
+#define TEST_WAITANY_WAITANYOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests waitAny(), tryWaitAnyFor() and tryWaitAnyUntil().
+ *
+ * Tests waiting for any of semaphore, FIFO queue and raw message queue - with objects which are already "ready", with
+ * timeouts and with objects which become "ready" by actions from thread and from interrupt context.
+ */
+
+class WaitAnyOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_WAITANY_WAITANYOPERATIONSTESTCASE_HPP_
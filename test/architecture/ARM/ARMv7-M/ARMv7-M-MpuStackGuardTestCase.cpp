@@ -0,0 +1,174 @@
+/**
+ * \file
+ * \brief MpuStackGuardTestCase class implementation for ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ARMv7-M-MpuStackGuardTestCase.hpp"
+
+#include "distortos/architecture/ARMv7-M-setStackGuard.hpp"
+
+#ifdef CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+#include "distortos/architecture/getCycleCount.hpp"
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#include "distortos/DynamicThread.hpp"
+
+#endif	// def CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+namespace distortos
+{
+
+namespace test
+{
+
+#ifdef CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// state of stack guard observed by thread
+struct ObservedGuard
+{
+	/// address of stack guard
+	uintptr_t address;
+
+	/// address of local variable of thread which observed the guard
+	uintptr_t local;
+
+	/// true if stack guard was enabled, false otherwise
+	bool enabled;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// max number of cycles needed to move stack guard
+constexpr uint32_t maxStackGuardCycles {64};
+
+/// number of measurements of the cost of moving stack guard
+constexpr size_t measurements {8};
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {1024};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Reads state of stack guard as seen by current thread.
+ *
+ * \return state of stack guard as seen by current thread
+ */
+
+__attribute__ ((noinline)) ObservedGuard observeGuard()
+{
+	ObservedGuard observedGuard {};
+
+	{
+		const architecture::InterruptMaskingLock interruptMaskingLock;
+		MPU->RNR = architecture::stackGuardRegion;
+		observedGuard.address = MPU->RBAR & MPU_RBAR_ADDR_Msk;
+		observedGuard.enabled = (MPU->RASR & MPU_RASR_ENABLE_Msk) != 0;
+	}
+
+	observedGuard.local = reinterpret_cast<uintptr_t>(&observedGuard);
+	return observedGuard;
+}
+
+/**
+ * \brief Checks whether observed state of stack guard is valid.
+ *
+ * \param [in] observedGuard is the observed state of stack guard
+ * \param [in] stackSize is the size of stack of thread which observed the guard, bytes
+ *
+ * \return true if the guard was enabled and it was below the local variable in the same stack, false otherwise
+ */
+
+bool isGuardValid(const ObservedGuard& observedGuard, const size_t stackSize)
+{
+	return observedGuard.enabled == true &&
+			observedGuard.address + architecture::stackGuardSize <= observedGuard.local &&
+			observedGuard.local - observedGuard.address < stackSize;
+}
+
+/**
+ * \brief Test thread
+ *
+ * Saves state of stack guard seen by this thread.
+ *
+ * \param [out] observedGuard is a reference to variable into which the state of stack guard will be written
+ */
+
+void thread(ObservedGuard& observedGuard)
+{
+	observedGuard = observeGuard();
+}
+
+}	// namespace
+
+#endif	// def CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MpuStackGuardTestCase::run_() const
+{
+#ifdef CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+	const auto& stack = internal::getScheduler().getCurrentThreadControlBlock().getStack();
+	const auto mainGuard = observeGuard();
+	if (isGuardValid(mainGuard, stack.getSize()) == false)
+		return false;
+
+	{
+		ObservedGuard threadGuard {};
+		auto testThread = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, thread, std::ref(threadGuard));
+		testThread.join();
+
+		if (isGuardValid(threadGuard, testThreadStackSize) == false || threadGuard.address == mainGuard.address)
+			return false;
+	}
+
+	{
+		const auto restoredGuard = observeGuard();
+		if (restoredGuard.enabled == false || restoredGuard.address != mainGuard.address)
+			return false;
+	}
+
+	for (size_t i {}; i < measurements; ++i)
+	{
+		const architecture::InterruptMaskingLock interruptMaskingLock;
+		const auto begin = architecture::getCycleCount();
+		architecture::setStackGuard(stack);
+		const auto cycles = architecture::getCycleCount() - begin;
+		if (cycles > maxStackGuardCycles)
+			return false;
+	}
+
+#endif	// def CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief MpuStackGuardTestCase class header for ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_ARCHITECTURE_ARM_ARMV7_M_ARMV7_M_MPUSTACKGUARDTESTCASE_HPP_
+#define TEST_ARCHITECTURE_ARM_ARMV7_M_ARMV7_M_MPUSTACKGUARDTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests MPU stack guard.
+ *
+ * Checks whether the guard region follows the stack of current thread across context switches - it must be enabled
+ * and it must lie below currently used part of the stack - and whether the cost of moving the guard, which is added to
+ * each context switch, is bounded.
+ *
+ * \note If MPU stack guard is not enabled, this test case does nothing.
+ */
+
+class MpuStackGuardTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_ARCHITECTURE_ARM_ARMV7_M_ARMV7_M_MPUSTACKGUARDTESTCASE_HPP_
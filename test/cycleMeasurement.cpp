@@ -0,0 +1,54 @@
+/**
+ * \file
+ * \brief Implementation of helpers for measurement of durations in core clock cycles
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "cycleMeasurement.hpp"
+
+#include "distortos/architecture/getCycleCount.hpp"
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <cstring>
+
+namespace distortos
+{
+
+namespace test
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+CycleReport cycleReports[maxCycleReports];
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint32_t getCycleCount()
+{
+	const architecture::InterruptMaskingLock interruptMaskingLock;
+	return architecture::getCycleCount();
+}
+
+void reportCycles(const char* const name, const uint32_t cycles)
+{
+	for (auto& cycleReport : cycleReports)
+		if (cycleReport.name == nullptr || strcmp(cycleReport.name, name) == 0)
+		{
+			cycleReport.name = name;
+			cycleReport.cycles = cycles;
+			return;
+		}
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,69 @@
+/**
+ * \file
+ * \brief Header with helpers for measurement of durations in core clock cycles
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_CYCLEMEASUREMENT_HPP_
+#define TEST_CYCLEMEASUREMENT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace test
+{
+
+/// single duration measured by test case
+struct CycleReport
+{
+	/// name of measured duration, nullptr if the entry is unused
+	const char* name;
+
+	/// the last reported value of measured duration, core clock cycles
+	uint32_t cycles;
+};
+
+/// max number of distinct durations which can be reported with reportCycles()
+constexpr size_t maxCycleReports {16};
+
+/// durations reported with reportCycles() - may be examined with the debugger
+extern CycleReport cycleReports[maxCycleReports];
+
+/**
+ * \brief Gets value of cycle counter.
+ *
+ * Wrapper for architecture::getCycleCount() which can be used in thread context - the counter is read with interrupt
+ * masking enabled.
+ *
+ * \return current value of architecture::getCycleCount()
+ */
+
+uint32_t getCycleCount();
+
+/**
+ * \brief Reports measured duration.
+ *
+ * The value is saved in cycleReports, in the entry with the same name or - if there's none - in the first unused one.
+ * Absolute values of measured durations depend on toolchain, optimization level and memory configuration of the chip,
+ * so test cases should decide their result only by comparing durations measured in the same run, with some margin. If
+ * cycleReports is full, the value is discarded.
+ *
+ * \param [in] name is the name of measured duration, must point to string with static storage duration
+ * \param [in] cycles is the measured duration, core clock cycles
+ */
+
+void reportCycles(const char* name, uint32_t cycles);
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_CYCLEMEASUREMENT_HPP_
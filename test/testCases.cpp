@@ -2,7 +2,7 @@
  * \file
  * \brief testCases object definition
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,12 +13,16 @@
 
 #include "Thread/threadTestCases.hpp"
 #include "SoftwareTimer/softwareTimerTestCases.hpp"
+#include "Clock/clockTestCases.hpp"
 #include "Semaphore/semaphoreTestCases.hpp"
+#include "EventFlags/eventFlagsTestCases.hpp"
 #include "Mutex/mutexTestCases.hpp"
 #include "ConditionVariable/conditionVariableTestCases.hpp"
 #include "Queue/queueTestCases.hpp"
+#include "WaitAny/waitAnyTestCases.hpp"
 #include "Signals/signalsTestCases.hpp"
 #include "CallOnce/callOnceTestCases.hpp"
+#include "Statistics/statisticsTestCases.hpp"
 #include "architecture/architectureTestCases.hpp"
 
 #include "TestCaseGroup.hpp"
@@ -41,12 +45,16 @@ const TestCaseGroup::Range::value_type testCases_[]
 {
 		TestCaseGroup::Range::value_type{threadTestCases},
 		TestCaseGroup::Range::value_type{softwareTimerTestCases},
+		TestCaseGroup::Range::value_type{clockTestCases},
 		TestCaseGroup::Range::value_type{semaphoreTestCases},
+		TestCaseGroup::Range::value_type{eventFlagsTestCases},
 		TestCaseGroup::Range::value_type{mutexTestCases},
 		TestCaseGroup::Range::value_type{conditionVariableTestCases},
 		TestCaseGroup::Range::value_type{queueTestCases},
+		TestCaseGroup::Range::value_type{waitAnyTestCases},
 		TestCaseGroup::Range::value_type{signalsTestCases},
 		TestCaseGroup::Range::value_type{callOnceTestCases},
+		TestCaseGroup::Range::value_type{statisticsTestCases},
 		TestCaseGroup::Range::value_type{architectureTestCases},
 };
 